@@ -9914,6 +9914,32 @@ class AutoTestCopter(vehicle_test_suite.TestSuite):
         self.FETtecESC_btw_mask_checks()
         self.FETtecESC_flight()
 
+    def DroneCANMessageStats(self):
+        '''check per message type DroneCAN statistics over the multicast CAN transport'''
+        self.set_parameters({
+            "CAN_P1_DRIVER": 1,
+            "GPS1_TYPE": 9,
+            "SIM_GPS_DISABLE": 1,
+        })
+        self.reboot_sitl()
+        self.wait_gps_fix_type_gte(3, timeout=60)
+
+        content = self.fetch_file_via_ftp("@SYS/dronecan_msgs.txt")
+        self.progress("Got content (%s)" % str(content))
+
+        def transfers(direction, data_type_id):
+            for line in content.split("\n"):
+                fields = line.split()
+                if len(fields) == 6 and fields[0] == direction and fields[2] == str(data_type_id):
+                    return int(fields[3])
+            return 0
+
+        # uavcan.equipment.gnss.Fix2 from the periph, uavcan.protocol.NodeStatus from us
+        if transfers("RX", 1063) == 0:
+            raise NotAchievedException("Expected received Fix2 transfers")
+        if transfers("TX", 341) == 0:
+            raise NotAchievedException("Expected sent NodeStatus transfers")
+
     def PerfInfo(self):
         '''Test Scheduler PerfInfo output'''
         self.set_parameter('SCHED_OPTIONS', 1)  # enable gathering
@@ -10996,6 +11022,7 @@ class AutoTestCopter(vehicle_test_suite.TestSuite):
     def testcan(self):
         ret = ([
             self.CANGPSCopterMission,
+            self.DroneCANMessageStats,
             self.TestLogDownloadMAVProxyCAN,
         ])
         return ret
@@ -5295,6 +5295,7 @@ Brakes have negligible effect (with=%0.2fm without=%0.2fm delta=%0.2fm)
                 "math.lua",
                 "strings.lua",
                 "mavlink_test.lua",
+                "alloc_benchmark.lua",
         ]:
             self.install_test_script_context(script)
 
@@ -5307,7 +5308,8 @@ Brakes have negligible effect (with=%0.2fm without=%0.2fm delta=%0.2fm)
                 "Internal tests passed",
                 "Math tests passed",
                 "String tests passed",
-                "Received heartbeat from"
+                "Received heartbeat from",
+                "Allocation benchmark passed",
         ]:
             self.wait_statustext(success_text, check_context=True)
 
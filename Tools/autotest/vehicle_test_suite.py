@@ -13827,13 +13827,13 @@ switch value'''
         if abs(new_gpi_alt2 - m.alt) > 100:
             raise NotAchievedException("Failover not detected")
 
-    def fetch_file_via_ftp(self, path, timeout=20):
+    def fetch_file_via_ftp(self, path, timeout=20, binary=False):
         '''returns the content of the FTP'able file at path'''
         self.progress("Retrieving (%s) using MAVProxy" % path)
         mavproxy = self.start_mavproxy()
         mavproxy.expect("Saved .* parameters to")
         ex = None
-        tmpfile = tempfile.NamedTemporaryFile(mode='r', delete=False)
+        tmpfile = tempfile.NamedTemporaryFile(mode='rb' if binary else 'r', delete=False)
         try:
             mavproxy.send("module load ftp\n")
             mavproxy.expect(["Loaded module ftp", "module ftp already loaded"])
@@ -13892,6 +13892,23 @@ switch value'''
         if ex is not None:
             raise ex
 
+        # burst read a file spanning several FTP read-ahead buffers
+        # (AP_MAVLINK_FTP_READ_AHEAD_SIZE) which doesn't end on a
+        # buffer or packet boundary
+        read_ahead_size = 8192
+        content = os.urandom(3 * read_ahead_size + 1234)
+        filename = "mavftp-burst-test.bin"
+        self.write_content_to_filepath(content, filename)
+        try:
+            fetched = self.fetch_file_via_ftp(filename, timeout=60, binary=True)
+        finally:
+            os.unlink(filename)
+        if len(fetched) != len(content):
+            raise NotAchievedException("Fetched %u bytes, expected %u" % (len(fetched), len(content)))
+        if fetched != content:
+            offset = next(i for i in range(len(content)) if fetched[i] != content[i])
+            raise NotAchievedException("Fetched file differs at offset %u" % offset)
+
     def write_content_to_filepath(self, content, filepath):
         '''write biunary content to filepath'''
         with open(filepath, "wb") as f:
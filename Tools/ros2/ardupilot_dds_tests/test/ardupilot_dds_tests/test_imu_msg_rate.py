@@ -0,0 +1,186 @@
+# Copyright 2023 ArduPilot.org.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+"""Bring up ArduPilot SITL over UDP and measure the rate and jitter of the IMU topic."""
+import launch_pytest
+import pytest
+import rclpy
+import rclpy.node
+import threading
+
+from ament_index_python.packages import get_package_share_directory
+
+from launch import LaunchDescription
+from launch import LaunchDescriptionSource
+from launch.actions import IncludeLaunchDescription
+
+from launch_pytest.tools import process as process_tools
+
+from pathlib import Path
+
+from ardupilot_sitl.launch import SITLLaunch
+
+from rclpy.qos import QoSProfile
+from rclpy.qos import QoSReliabilityPolicy
+from rclpy.qos import QoSHistoryPolicy
+
+from sensor_msgs.msg import Imu
+
+# Non-default IMU topic rate and output batching time set for the test
+IMU_RATE_HZ = 50
+BATCH_MS = 20
+
+# Number of messages to measure over, and the allowed relative error of the measured rate
+MEASURE_COUNT = 500
+RATE_TOLERANCE = 0.05
+
+
+class ImuRateListener(rclpy.node.Node):
+    """Subscribe to Imu messages on /ap/imu/experimental/data and record their timestamps."""
+
+    def __init__(self):
+        """Initialise the node."""
+        super().__init__("imu_rate_listener")
+        self.done_event_object = threading.Event()
+        self.stamps = []
+
+        # Declare and acquire `topic` parameter
+        self.declare_parameter("topic", "ap/imu/experimental/data")
+        self.topic = self.get_parameter("topic").get_parameter_value().string_value
+
+    def start_subscriber(self):
+        """Start the subscriber."""
+        qos_profile = QoSProfile(
+            reliability=QoSReliabilityPolicy.BEST_EFFORT,
+            history=QoSHistoryPolicy.KEEP_LAST,
+            depth=10,
+        )
+
+        self.subscription = self.create_subscription(Imu, self.topic, self.subscriber_callback, qos_profile)
+
+        # Add a spin thread.
+        self.ros_spin_thread = threading.Thread(target=lambda node: rclpy.spin(node), args=(self,))
+        self.ros_spin_thread.start()
+
+    def subscriber_callback(self, msg):
+        """Record the timestamp of an Imu message."""
+        if len(self.stamps) < MEASURE_COUNT:
+            # SITL runs faster than real time, so use the vehicle timestamps rather than arrival times
+            self.stamps.append(msg.header.stamp.sec + msg.header.stamp.nanosec * 1e-9)
+        else:
+            self.done_event_object.set()
+
+    def report(self):
+        """Log the measured rate and sample interval statistics, returning the rate."""
+        gaps = sorted(b - a for a, b in zip(self.stamps, self.stamps[1:]))
+        elapsed = self.stamps[-1] - self.stamps[0]
+        rate = (len(self.stamps) - 1) / elapsed
+        self.get_logger().info(
+            "IMU rate {:.1f} Hz, interval p50 {:.2f} ms p99 {:.2f} ms max {:.2f} ms".format(
+                rate,
+                gaps[len(gaps) // 2] * 1000,
+                gaps[int(len(gaps) * 0.99)] * 1000,
+                gaps[-1] * 1000,
+            )
+        )
+        return rate
+
+
+@pytest.fixture
+def sitl_copter_dds_udp_imu_rate(micro_ros_agent_udp, mavproxy, tmp_path):
+    """Fixture to bring up ArduPilot SITL DDS with a non-default IMU rate and output batching."""
+    mra_ld, mra_actions = micro_ros_agent_udp
+    mp_ld, mp_actions = mavproxy
+    sitl_ld, sitl_actions = SITLLaunch.generate_launch_description_with_actions()
+
+    default_params = Path(get_package_share_directory("ardupilot_sitl"), "config", "default_params")
+    rate_params = Path(tmp_path, "dds_imu_rate.parm")
+    rate_params.write_text("DDS_IMU_RATE {}\nDDS_BATCH_MS {}\n".format(IMU_RATE_HZ, BATCH_MS))
+
+    sitl_ld_args = IncludeLaunchDescription(
+        LaunchDescriptionSource(sitl_ld),
+        launch_arguments={
+            "command": "arducopter",
+            "synthetic_clock": "True",
+            "wipe": "False",
+            "model": "quad",
+            "speedup": "10",
+            "slave": "0",
+            "instance": "0",
+            "defaults": ",".join(
+                [
+                    str(Path(default_params, "copter.parm")),
+                    str(Path(default_params, "dds_udp.parm")),
+                    str(rate_params),
+                ]
+            ),
+        }.items(),
+    )
+
+    ld = LaunchDescription(
+        [
+            mra_ld,
+            mp_ld,
+            sitl_ld_args,
+        ]
+    )
+    actions = {}
+    actions.update(mra_actions)
+    actions.update(mp_actions)
+    actions.update(sitl_actions)
+    yield ld, actions
+
+
+@launch_pytest.fixture
+def launch_sitl_copter_dds_udp(sitl_copter_dds_udp_imu_rate):
+    """Fixture to create the launch description."""
+    sitl_ld, sitl_actions = sitl_copter_dds_udp_imu_rate
+
+    ld = LaunchDescription(
+        [
+            sitl_ld,
+            launch_pytest.actions.ReadyToTest(),
+        ]
+    )
+    actions = sitl_actions
+    yield ld, actions
+
+
+@pytest.mark.launch(fixture=launch_sitl_copter_dds_udp)
+def test_dds_udp_imu_msg_rate(launch_context, launch_sitl_copter_dds_udp):
+    """Test Imu messages are published by AP_DDS at the configured rate while batching output."""
+    _, actions = launch_sitl_copter_dds_udp
+    micro_ros_agent = actions["micro_ros_agent"].action
+    mavproxy = actions["mavproxy"].action
+    sitl = actions["sitl"].action
+
+    # Wait for process to start.
+    process_tools.wait_for_start_sync(launch_context, micro_ros_agent, timeout=2)
+    process_tools.wait_for_start_sync(launch_context, mavproxy, timeout=2)
+    process_tools.wait_for_start_sync(launch_context, sitl, timeout=2)
+
+    rclpy.init()
+    try:
+        node = ImuRateListener()
+        node.start_subscriber()
+        msgs_received_flag = node.done_event_object.wait(timeout=60.0)
+        assert msgs_received_flag, "Did not receive {} 'ap/imu/experimental/data' msgs.".format(MEASURE_COUNT)
+        rate = node.report()
+        assert abs(rate - IMU_RATE_HZ) <= IMU_RATE_HZ * RATE_TOLERANCE, "IMU rate {:.1f} Hz, expected {} Hz".format(
+            rate, IMU_RATE_HZ
+        )
+    finally:
+        rclpy.shutdown()
+    yield
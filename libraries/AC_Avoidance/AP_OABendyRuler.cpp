@@ -36,6 +36,7 @@ const float OA_BENDYRULER_LOOKAHEAD_STEP2_RATIO = 1.0f; // step2's lookahead len
 const float OA_BENDYRULER_LOOKAHEAD_STEP2_MIN = 2.0f;   // step2 checks at least this many meters past step1's location
 const float OA_BENDYRULER_LOOKAHEAD_PAST_DEST = 2.0f;   // lookahead length will be at least this many meters past the destination
 const float OA_BENDYRULER_LOW_SPEED_SQUARED = (0.2f * 0.2f);    // when ground course is below this speed squared, vehicle's heading will be used
+const uint8_t OA_BENDYRULER_PROBE_BATCH = 8;    // number of bearings whose margin from the object database is calculated together
 
 #define VERTICAL_ENABLED APM_BUILD_COPTER_OR_HELI
 
@@ -110,6 +111,9 @@ bool AP_OABendyRuler::update(const Location& current_loc, const Location& destin
     // calculate lookahead dist for step2
     const float lookahead_step2_dist = _current_lookahead * OA_BENDYRULER_LOOKAHEAD_STEP2_RATIO;
 
+    // take a copy of the object database to check all paths against
+    update_obstacle_snapshot();
+
     // get ground course
     float ground_course_deg;
     if (ground_speed_vec.length_squared() < OA_BENDYRULER_LOW_SPEED_SQUARED) {
@@ -137,6 +141,14 @@ bool AP_OABendyRuler::update(const Location& current_loc, const Location& destin
     return ret;
 }
 
+// bearing change from the destination of a probe in search_xy_path(). Probes are straight towards
+// the destination, then alternately left and right in OA_BENDYRULER_BEARING_INC_XY degree steps
+static float probe_bearing_delta(uint8_t probe)
+{
+    const uint8_t i = (probe + 1) / 2;
+    return i * OA_BENDYRULER_BEARING_INC_XY * ((probe % 2) ? -1.0f : 1.0f);
+}
+
 // Search for path in the horizontal directions
 bool AP_OABendyRuler::search_xy_path(const Location& current_loc, const Location& destination, float ground_course_deg, Location &destination_new, float lookahead_step1_dist, float lookahead_step2_dist, float bearing_to_dest, float distance_to_dest, bool proximity_only) 
 {
@@ -151,70 +163,79 @@ bool AP_OABendyRuler::search_xy_path(const Location& current_loc, const Location
     float best_margin = -FLT_MAX;
     float best_margin_bearing = best_bearing;
 
-    for (uint8_t i = 0; i <= (170 / OA_BENDYRULER_BEARING_INC_XY); i++) {
-        for (uint8_t bdir = 0; bdir <= 1; bdir++) {
-            // skip duplicate check of bearing straight towards destination
-            if ((i==0) && (bdir > 0)) {
-                continue;
+    // test locations and margins from the object database for a batch of probes.
+    // The first probe is straight towards the destination and is usually clear, so it is checked on its own
+    Location test_locs[OA_BENDYRULER_PROBE_BATCH];
+    float object_database_margins[OA_BENDYRULER_PROBE_BATCH];
+    uint8_t batch_start = 0;
+    uint8_t batch_len = 0;
+
+    const uint8_t num_probes = 1 + 2 * (170 / OA_BENDYRULER_BEARING_INC_XY);
+    for (uint8_t probe = 0; probe < num_probes; probe++) {
+        if (probe >= batch_start + batch_len) {
+            batch_start = probe;
+            batch_len = (probe == 0) ? 1 : MIN(OA_BENDYRULER_PROBE_BATCH, num_probes - probe);
+            for (uint8_t k = 0; k < batch_len; k++) {
+                // ToDo: add effective groundspeed calculations using airspeed
+                // ToDo: add prediction of vehicle's position change as part of turn to desired heading
+
+                // test location is projected from current location at test bearing
+                test_locs[k] = current_loc;
+                test_locs[k].offset_bearing(wrap_180(bearing_to_dest + probe_bearing_delta(probe + k)), lookahead_step1_dist);
             }
-            // bearing that we are probing
-            const float bearing_delta = i * OA_BENDYRULER_BEARING_INC_XY * (bdir == 0 ? -1.0f : 1.0f);
-            const float bearing_test = wrap_180(bearing_to_dest + bearing_delta);
-
-            // ToDo: add effective groundspeed calculations using airspeed
-            // ToDo: add prediction of vehicle's position change as part of turn to desired heading
+            calc_margins_from_object_database(current_loc, test_locs, batch_len, object_database_margins);
+        }
 
-            // test location is projected from current location at test bearing
-            Location test_loc = current_loc;
-            test_loc.offset_bearing(bearing_test, lookahead_step1_dist);
+        // bearing that we are probing
+        const float bearing_test = wrap_180(bearing_to_dest + probe_bearing_delta(probe));
+        const Location &test_loc = test_locs[probe - batch_start];
 
-            // calculate margin from obstacles for this scenario
-            float margin = calc_avoidance_margin(current_loc, test_loc, proximity_only);
-            if (margin > best_margin) {
-                best_margin_bearing = bearing_test;
-                best_margin = margin;
+        // calculate margin from obstacles for this scenario
+        float margin = calc_avoidance_margin(current_loc, test_loc, proximity_only, object_database_margins[probe - batch_start]);
+        if (margin > best_margin) {
+            best_margin_bearing = bearing_test;
+            best_margin = margin;
+        }
+        if (margin > _margin_max) {
+            // this bearing avoids obstacles out to the lookahead_step1_dist
+            // now check in there is a clear path in three directions towards the destination
+            if (!have_best_bearing) {
+                best_bearing = bearing_test;
+                best_bearing_margin = margin;
+                have_best_bearing = true;
+            } else if (fabsf(wrap_180(ground_course_deg - bearing_test)) <
+                       fabsf(wrap_180(ground_course_deg - best_bearing))) {
+                // replace bearing with one that is closer to our current ground course
+                best_bearing = bearing_test;
+                best_bearing_margin = margin;
             }
-            if (margin > _margin_max) {
-                // this bearing avoids obstacles out to the lookahead_step1_dist
-                // now check in there is a clear path in three directions towards the destination
-                if (!have_best_bearing) {
-                    best_bearing = bearing_test;
-                    best_bearing_margin = margin;
-                    have_best_bearing = true;
-                } else if (fabsf(wrap_180(ground_course_deg - bearing_test)) <
-                           fabsf(wrap_180(ground_course_deg - best_bearing))) {
-                    // replace bearing with one that is closer to our current ground course
-                    best_bearing = bearing_test;
-                    best_bearing_margin = margin;
-                }
-
-                // perform second stage test in three directions looking for obstacles
-                const float test_bearings[] { 0.0f, 45.0f, -45.0f };
-                const float bearing_to_dest2 = test_loc.get_bearing_to(destination) * 0.01f;
-                float distance2 = constrain_float(lookahead_step2_dist, OA_BENDYRULER_LOOKAHEAD_STEP2_MIN, test_loc.get_distance(destination));
-                for (uint8_t j = 0; j < ARRAY_SIZE(test_bearings); j++) {
-                    float bearing_test2 = wrap_180(bearing_to_dest2 + test_bearings[j]);
-                    Location test_loc2 = test_loc;
-                    test_loc2.offset_bearing(bearing_test2, distance2);
 
-                    // calculate minimum margin to fence and obstacles for this scenario
-                    float margin2 = calc_avoidance_margin(test_loc, test_loc2, proximity_only);
-                    if (margin2 > _margin_max) {
-                        // if the chosen direction is directly towards the destination avoidance can be turned off
-                        // i == 0 && j == 0 implies no deviation from bearing to destination 
-                        const bool active = (i != 0 || j != 0);
-                        float final_bearing = bearing_test;
-                        float final_margin = margin;
-                        // check if we need ignore test_bearing and continue on previous bearing
-                        const bool ignore_bearing_change = resist_bearing_change(destination, current_loc, active, bearing_test, lookahead_step1_dist, margin, _destination_prev,_bearing_prev, final_bearing, final_margin, proximity_only);
-
-                        // all good, now project in the chosen direction by the full distance
-                        destination_new = current_loc;
-                        destination_new.offset_bearing(final_bearing, MIN(distance_to_dest, lookahead_step1_dist));
-                        _current_lookahead = MIN(_lookahead, _current_lookahead * 1.1f);
-                        Write_OABendyRuler((uint8_t)OABendyType::OA_BENDY_HORIZONTAL, active, bearing_to_dest, 0.0f, ignore_bearing_change, final_margin, destination, destination_new);
-                        return active;
-                    }
+            // perform second stage test in three directions looking for obstacles
+            const float test_bearings[] { 0.0f, 45.0f, -45.0f };
+            const float bearing_to_dest2 = test_loc.get_bearing_to(destination) * 0.01f;
+            float distance2 = constrain_float(lookahead_step2_dist, OA_BENDYRULER_LOOKAHEAD_STEP2_MIN, test_loc.get_distance(destination));
+            for (uint8_t j = 0; j < ARRAY_SIZE(test_bearings); j++) {
+                float bearing_test2 = wrap_180(bearing_to_dest2 + test_bearings[j]);
+                Location test_loc2 = test_loc;
+                test_loc2.offset_bearing(bearing_test2, distance2);
+
+                // calculate minimum margin to fence and obstacles for this scenario
+                float margin2 = calc_avoidance_margin(test_loc, test_loc2, proximity_only);
+                if (margin2 > _margin_max) {
+                    // if the chosen direction is directly towards the destination avoidance can be turned off
+                    // probe == 0 && j == 0 implies no deviation from bearing to destination
+                    const bool active = (probe != 0 || j != 0);
+                    float final_bearing = bearing_test;
+                    float final_margin = margin;
+                    // check if we need ignore test_bearing and continue on previous bearing
+                    const bool ignore_bearing_change = resist_bearing_change(destination, current_loc, active, bearing_test, lookahead_step1_dist, margin, _destination_prev,_bearing_prev, final_bearing, final_margin, proximity_only);
+
+                    // all good, now project in the chosen direction by the full distance
+                    destination_new = current_loc;
+                    destination_new.offset_bearing(final_bearing, MIN(distance_to_dest, lookahead_step1_dist));
+                    _current_lookahead = MIN(_lookahead, _current_lookahead * 1.1f);
+                    Write_OABendyRuler((uint8_t)OABendyType::OA_BENDY_HORIZONTAL, active, bearing_to_dest, 0.0f, ignore_bearing_change, final_margin, destination, destination_new);
+                    return active;
                 }
             }
         }
@@ -419,14 +440,20 @@ bool AP_OABendyRuler::resist_bearing_change(const Location &destination, const L
 // calculate minimum distance between a segment and any obstacle
 float AP_OABendyRuler::calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only) const
 {
-    float margin_min = FLT_MAX;
+    float object_database_margin;
+    if (!calc_margin_from_object_database(start, end, object_database_margin)) {
+        object_database_margin = FLT_MAX;
+    }
+    return calc_avoidance_margin(start, end, proximity_only, object_database_margin);
+}
+
+// calculate minimum distance between a segment and any obstacle, given the margin from proximity sensor obstacles
+float AP_OABendyRuler::calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only, float object_database_margin) const
+{
+    float margin_min = object_database_margin;
 
     float latest_margin;
-    
-    if (calc_margin_from_object_database(start, end, latest_margin)) {
-        margin_min = MIN(margin_min, latest_margin);
-    }
-    
+
     if (proximity_only) {
         // only need margin from proximity data
         return margin_min;
@@ -694,13 +721,17 @@ bool AP_OABendyRuler::calc_margin_from_object_database(const Location &start, co
 
     // check each obstacle's distance from segment
     float smallest_margin = FLT_MAX;
-    for (uint16_t i=0; i<oaDb->database_count(); i++) {
-        const AP_OADatabase::OA_DbItem& item = oaDb->get_item(i);
-        const Vector3f point_cm = item.pos * 100.0f;
-        // margin is distance between line segment and obstacle minus obstacle's radius
-        const float m = Vector3f::closest_distance_between_line_and_point(start_NEU, end_NEU, point_cm) * 0.01f - item.radius;
-        if (m < smallest_margin) {
-            smallest_margin = m;
+    if (_obstacles_valid) {
+        _obstacles.calc_margins(start_NEU, &end_NEU, 1, &smallest_margin);
+    } else {
+        for (uint16_t i=0; i<oaDb->database_count(); i++) {
+            const AP_OADatabase::OA_DbItem& item = oaDb->get_item(i);
+            const Vector3f point_cm = item.pos * 100.0f;
+            // margin is distance between line segment and obstacle minus obstacle's radius
+            const float m = Vector3f::closest_distance_between_line_and_point(start_NEU, end_NEU, point_cm) * 0.01f - item.radius;
+            if (m < smallest_margin) {
+                smallest_margin = m;
+            }
         }
     }
 
@@ -713,4 +744,55 @@ bool AP_OABendyRuler::calc_margin_from_object_database(const Location &start, co
     return false;
 }
 
+// calculate minimum distance between each path from start to ends[i] and proximity sensor obstacles
+// margins are set to FLT_MAX where there is no margin
+void AP_OABendyRuler::calc_margins_from_object_database(const Location &start, const Location *ends, uint8_t num_ends, float *margins) const
+{
+    Vector3f start_NEU;
+    Vector3f ends_NEU[OA_BENDYRULER_PROBE_BATCH];
+    if (!_obstacles_valid || num_ends > ARRAY_SIZE(ends_NEU) || !start.get_vector_from_origin_NEU(start_NEU)) {
+        for (uint8_t i = 0; i < num_ends; i++) {
+            if (!calc_margin_from_object_database(start, ends[i], margins[i])) {
+                margins[i] = FLT_MAX;
+            }
+        }
+        return;
+    }
+
+    for (uint8_t i = 0; i < num_ends; i++) {
+        if (!ends[i].get_vector_from_origin_NEU(ends_NEU[i])) {
+            // no margin can be calculated from any path
+            ends_NEU[i] = start_NEU;
+        }
+    }
+    _obstacles.calc_margins(start_NEU, ends_NEU, num_ends, margins);
+
+    // paths with no length have no margin
+    for (uint8_t i = 0; i < num_ends; i++) {
+        if (ends_NEU[i] == start_NEU) {
+            margins[i] = FLT_MAX;
+        }
+    }
+}
+
+// copy the object database into _obstacles
+void AP_OABendyRuler::update_obstacle_snapshot()
+{
+    _obstacles_valid = false;
+    const AP_OADatabase *oaDb = AP::oadatabase();
+    if (oaDb == nullptr || !oaDb->healthy()) {
+        return;
+    }
+    const uint16_t count = oaDb->database_count();
+    if (!_obstacles.reset(count)) {
+        // margins are calculated from the database directly
+        return;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        const AP_OADatabase::OA_DbItem& item = oaDb->get_item(i);
+        _obstacles.add(item.pos, item.radius);
+    }
+    _obstacles_valid = true;
+}
+
 #endif  // AP_OAPATHPLANNER_BENDYRULER_ENABLED
@@ -8,6 +8,7 @@
 #include <AP_Common/Location.h>
 #include <AP_Math/AP_Math.h>
 #include <AP_Logger/AP_Logger_config.h>
+#include "AP_OAObstacleSnapshot.h"
 
 /*
  * BendyRuler avoidance algorithm for avoiding the polygon and circular fence and dynamic objects detected by the proximity sensor
@@ -48,6 +49,9 @@ private:
     // calculate minimum distance between a path and any obstacle
     float calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only) const;
 
+    // calculate minimum distance between a path and any obstacle, given the margin from proximity sensor obstacles
+    float calc_avoidance_margin(const Location &start, const Location &end, bool proximity_only, float object_database_margin) const;
+
     // determine if BendyRuler should accept the new bearing or try and resist it. Returns true if bearing is not changed  
     bool resist_bearing_change(const Location &destination, const Location &current_loc, bool active, float bearing_test, float lookahead_step1_dist, float margin, Location &prev_dest, float &prev_bearing, float &final_bearing, float &final_margin, bool proximity_only) const;    
 
@@ -71,6 +75,13 @@ private:
     // on success returns true and updates margin
     bool calc_margin_from_object_database(const Location &start, const Location &end, float &margin) const;
 
+    // calculate minimum distance between each path from start to ends[i] and proximity sensor obstacles
+    // margins are set to FLT_MAX where there is no margin
+    void calc_margins_from_object_database(const Location &start, const Location *ends, uint8_t num_ends, float *margins) const;
+
+    // copy the object database into _obstacles
+    void update_obstacle_snapshot();
+
     // Logging function
 #if HAL_LOGGING_ENABLED
     void Write_OABendyRuler(const uint8_t type, const bool active, const float target_yaw, const float target_pitch, const bool resist_chg, const float margin, const Location &final_dest, const Location &oa_dest) const;
@@ -91,6 +102,8 @@ private:
     float _current_lookahead;       // distance (in meters) ahead of the vehicle we are looking for obstacles
     float _bearing_prev;            // stored bearing in degrees 
     Location _destination_prev;     // previous destination, to check if there has been a change in destination
+    AP_OAObstacleSnapshot _obstacles;   // copy of the object database used for margin calculations
+    bool _obstacles_valid;          // true if _obstacles holds the whole object database
 };
 
 #endif  // AP_OAPATHPLANNER_BENDYRULER_ENABLED
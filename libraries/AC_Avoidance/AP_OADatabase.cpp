@@ -40,6 +40,11 @@ extern const AP_HAL::HAL& hal;
     #define AP_OADATABASE_DISTANCE_FROM_HOME 3
 #endif
 
+// edge length of the cells used by the spatial hash, in meters
+#ifndef AP_OADATABASE_HASH_CELL_SIZE
+    #define AP_OADATABASE_HASH_CELL_SIZE 2.0f
+#endif
+
 const AP_Param::GroupInfo AP_OADatabase::var_info[] = {
 
     // @Param: SIZE
@@ -132,6 +137,10 @@ void AP_OADatabase::init()
         GCS_SEND_TEXT(MAV_SEVERITY_INFO, "DB init failed . Sizes queue:%u, db:%u", (unsigned int)_queue.size, (unsigned int)_database.size);
         delete _queue.items;
         delete[] _database.items;
+        delete[] _hash.buckets;
+        delete[] _hash.next;
+        _hash.buckets = nullptr;
+        _hash.next = nullptr;
         return;
     }
 }
@@ -206,6 +215,32 @@ void AP_OADatabase::init_database()
     }
 
     _database.items = new OA_DbItem[_database.size];
+    if (_database.items != nullptr) {
+        init_hash();
+    }
+}
+
+// allocate the spatial hash. If this fails the database is searched linearly
+void AP_OADatabase::init_hash()
+{
+    // aim for about two items per bucket when the database is full
+    uint16_t num_buckets = 16;
+    while (num_buckets < _database.size / 2 && num_buckets < 8192) {
+        num_buckets *= 2;
+    }
+    _hash.buckets = new uint16_t[num_buckets];
+    _hash.next = new uint16_t[_database.size];
+    if (_hash.buckets == nullptr || _hash.next == nullptr) {
+        delete[] _hash.buckets;
+        delete[] _hash.next;
+        _hash.buckets = nullptr;
+        _hash.next = nullptr;
+        return;
+    }
+    for (uint16_t i=0; i<num_buckets; i++) {
+        _hash.buckets[i] = HASH_NONE;
+    }
+    _hash.mask = num_buckets - 1;
 }
 
 // get bitmask of gcs channels item should be sent to based on its importance
@@ -265,17 +300,11 @@ bool AP_OADatabase::process_queue()
 
         item.send_to_gcs = get_send_to_gcs_flags(item.importance);
 
-        // compare item to all items in database. If found a similar item, update the existing, else add it as a new one
-        bool found = false;
-        for (uint16_t i=0; i<_database.count; i++) {
-            if (is_close_to_item_in_database(i, item)) {
-                database_item_refresh(i, item.timestamp_ms, item.radius);
-                found = true;
-                break;
-            }
-        }
-
-        if (!found) {
+        // find a similar item in the database. If found update the existing one, else add it as a new one
+        const uint16_t close_index = find_close_item_in_database(item);
+        if (close_index != HASH_NONE) {
+            database_item_refresh(close_index, item.timestamp_ms, item.radius);
+        } else {
             database_item_add(item);
         }
     }
@@ -289,6 +318,8 @@ void AP_OADatabase::database_item_add(const OA_DbItem &item)
     }
     _database.items[_database.count] = item;
     _database.items[_database.count].send_to_gcs = get_send_to_gcs_flags(_database.items[_database.count].importance);
+    _hash.max_radius = MAX(_hash.max_radius, item.radius);
+    hash_insert(_database.count);
     _database.count++;
 }
 
@@ -303,6 +334,7 @@ void AP_OADatabase::database_item_remove(const uint16_t index)
     _database.items[index].radius = 0;
     _database.items[index].send_to_gcs = get_send_to_gcs_flags(_database.items[index].importance);
 
+    hash_remove(index);
     _database.count--;
     if (_database.count == 0) {
         return;
@@ -310,7 +342,9 @@ void AP_OADatabase::database_item_remove(const uint16_t index)
 
     if (index != _database.count) {
         // copy last object in array over expired object
+        hash_remove(_database.count);
         _database.items[index] = _database.items[_database.count];
+        hash_insert(index);
         _database.items[index].send_to_gcs = get_send_to_gcs_flags(_database.items[index].importance);
     }
 }
@@ -331,6 +365,7 @@ void AP_OADatabase::database_item_refresh(const uint16_t index, const uint32_t t
         // and trigger resending to GCS
         _database.items[index].timestamp_ms = timestamp_ms;
         _database.items[index].radius = radius;
+        _hash.max_radius = MAX(_hash.max_radius, radius);
         _database.items[index].send_to_gcs = get_send_to_gcs_flags(_database.items[index].importance);
     }
 }
@@ -348,13 +383,17 @@ void AP_OADatabase::database_items_remove_all_expired()
     const uint32_t now_ms = AP_HAL::millis();
     const uint32_t expiry_ms = (uint32_t)_database_expiry_seconds * 1000;
     uint16_t index = 0;
+    float max_radius = 0;
     while (index < _database.count) {
         if (now_ms - _database.items[index].timestamp_ms > expiry_ms) {
             database_item_remove(index);
         } else {
+            max_radius = MAX(max_radius, _database.items[index].radius);
             index++;
         }
     }
+    // shrink the search radius used by the hash now large items may have gone
+    _hash.max_radius = max_radius;
 }
 
 // returns true if a similar object already exists in database. When true, the object timer is also reset
@@ -369,6 +408,99 @@ bool AP_OADatabase::is_close_to_item_in_database(const uint16_t index, const OA_
     return ((distance_sq < sq(item.radius)) || (distance_sq < sq(_database.items[index].radius)));
 }
 
+// returns the lowest index of a database item close to "item", or HASH_NONE if there is none
+uint16_t AP_OADatabase::find_close_item_in_database(const OA_DbItem &item) const
+{
+    int32_t cell_min[3], cell_max[3];
+    if (!hash_cell_range(item.pos, MAX(item.radius, _hash.max_radius), cell_min, cell_max)) {
+        for (uint16_t i=0; i<_database.count; i++) {
+            if (is_close_to_item_in_database(i, item)) {
+                return i;
+            }
+        }
+        return HASH_NONE;
+    }
+
+    // several items may be close, so return the lowest index as
+    // scanning the whole database would
+    uint16_t lowest = HASH_NONE;
+    int32_t cell[3];
+    for (cell[0] = cell_min[0]; cell[0] <= cell_max[0]; cell[0]++) {
+        for (cell[1] = cell_min[1]; cell[1] <= cell_max[1]; cell[1]++) {
+            for (cell[2] = cell_min[2]; cell[2] <= cell_max[2]; cell[2]++) {
+                for (uint16_t i = _hash.buckets[hash_bucket(cell)]; i != HASH_NONE; i = _hash.next[i]) {
+                    if (i < lowest && is_close_to_item_in_database(i, item)) {
+                        lowest = i;
+                    }
+                }
+            }
+        }
+    }
+    return lowest;
+}
+
+// get the grid cell holding a position
+void AP_OADatabase::hash_cell(const Vector3f &pos, int32_t cell[3]) const
+{
+    for (uint8_t i=0; i<3; i++) {
+        cell[i] = (int32_t)floorf(pos[i] * (1.0f / AP_OADATABASE_HASH_CELL_SIZE));
+    }
+}
+
+// get the bucket for a grid cell
+uint16_t AP_OADatabase::hash_bucket(const int32_t cell[3]) const
+{
+    const uint32_t h = (uint32_t(cell[0]) * 73856093U) ^ (uint32_t(cell[1]) * 19349663U) ^ (uint32_t(cell[2]) * 83492791U);
+    return h & _hash.mask;
+}
+
+// add database item "index" to the hash
+void AP_OADatabase::hash_insert(const uint16_t index)
+{
+    if (_hash.buckets == nullptr) {
+        return;
+    }
+    int32_t cell[3];
+    hash_cell(_database.items[index].pos, cell);
+    uint16_t &head = _hash.buckets[hash_bucket(cell)];
+    _hash.next[index] = head;
+    head = index;
+}
+
+// remove database item "index" from the hash
+void AP_OADatabase::hash_remove(const uint16_t index)
+{
+    if (_hash.buckets == nullptr) {
+        return;
+    }
+    int32_t cell[3];
+    hash_cell(_database.items[index].pos, cell);
+    uint16_t *link = &_hash.buckets[hash_bucket(cell)];
+    while (*link != HASH_NONE) {
+        if (*link == index) {
+            *link = _hash.next[index];
+            return;
+        }
+        link = &_hash.next[*link];
+    }
+}
+
+// calculate the range of cells that may hold items within radius of pos
+// returns false if the hash is not available or scanning the whole database is cheaper
+bool AP_OADatabase::hash_cell_range(const Vector3f &pos, float radius, int32_t cell_min[3], int32_t cell_max[3]) const
+{
+    if (_hash.buckets == nullptr) {
+        return false;
+    }
+    hash_cell(pos - Vector3f(radius, radius, radius), cell_min);
+    hash_cell(pos + Vector3f(radius, radius, radius), cell_max);
+    float num_cells = 1;
+    for (uint8_t i=0; i<3; i++) {
+        num_cells *= float(cell_max[i]) - float(cell_min[i]) + 1;
+    }
+    return num_cells <= _database.count;
+}
+
 #if HAL_GCS_ENABLED
 // send ADSB_VEHICLE mavlink messages
 void AP_OADatabase::send_adsb_vehicle(mavlink_channel_t chan, uint16_t interval_ms)
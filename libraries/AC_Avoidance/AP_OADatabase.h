@@ -77,6 +77,21 @@ private:
     // returns true if database item "index" is close to "item"
     bool is_close_to_item_in_database(const uint16_t index, const OA_DbItem &item) const;
 
+    // returns the lowest index of a database item close to "item", or
+    // HASH_NONE if there is none
+    uint16_t find_close_item_in_database(const OA_DbItem &item) const;
+
+    // spatial hash management. Items are chained into buckets by the
+    // grid cell holding their position
+    void init_hash();
+    void hash_cell(const Vector3f &pos, int32_t cell[3]) const;
+    uint16_t hash_bucket(const int32_t cell[3]) const;
+    void hash_insert(const uint16_t index);
+    void hash_remove(const uint16_t index);
+    // calculate the range of cells that may hold items within radius
+    // of pos. Returns false if scanning the whole database is cheaper
+    bool hash_cell_range(const Vector3f &pos, float radius, int32_t cell_min[3], int32_t cell_max[3]) const;
+
     // enum for use with _OUTPUT parameter
     enum class OutputLevel {
         NONE = 0,
@@ -108,6 +123,14 @@ private:
         uint16_t        size;                               // cached value of _database_size_param that sticks after initialized
     } _database;
 
+    static constexpr uint16_t HASH_NONE = UINT16_MAX;
+    struct {
+        uint16_t        *buckets;                           // index of the first item in each bucket, or HASH_NONE
+        uint16_t        *next;                              // index of the next item in the same bucket, per database item
+        uint16_t        mask;                               // number of buckets minus one
+        float           max_radius;                         // largest radius of any item in the database
+    } _hash;
+
     uint16_t _next_index_to_send[MAVLINK_COMM_NUM_BUFFERS]; // index of next object in _database to send to GCS
     uint16_t _highest_index_sent[MAVLINK_COMM_NUM_BUFFERS]; // highest index in _database sent to GCS
     uint32_t _last_send_to_gcs_ms[MAVLINK_COMM_NUM_BUFFERS];// system time that send_adsb_vehicle was last called
@@ -0,0 +1,124 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AC_Avoidance_config.h"
+
+#if AP_OAPATHPLANNER_BENDYRULER_ENABLED
+
+#include "AP_OAObstacleSnapshot.h"
+
+// room for obstacles is allocated in multiples of this
+#define AP_OAOBSTACLESNAPSHOT_CHUNK 64
+
+// obstacles are checked against all paths in blocks of this many, so they stay in cache
+#define AP_OAOBSTACLESNAPSHOT_BLOCK 256
+
+AP_OAObstacleSnapshot::~AP_OAObstacleSnapshot()
+{
+    // all arrays are held in one allocation
+    delete[] pos_x_cm;
+}
+
+// discard all obstacles and make room for count of them. returns false on allocation failure
+bool AP_OAObstacleSnapshot::reset(uint16_t count)
+{
+    num_obstacles = 0;
+    if (count <= max_obstacles) {
+        return true;
+    }
+
+    const uint32_t new_max = ((count + AP_OAOBSTACLESNAPSHOT_CHUNK - 1) / AP_OAOBSTACLESNAPSHOT_CHUNK) * AP_OAOBSTACLESNAPSHOT_CHUNK;
+    float *new_buf = new float[new_max * 4];
+    if (new_buf == nullptr) {
+        return false;
+    }
+    delete[] pos_x_cm;
+    pos_x_cm = new_buf;
+    pos_y_cm = &new_buf[new_max];
+    pos_z_cm = &new_buf[new_max * 2];
+    radius = &new_buf[new_max * 3];
+    max_obstacles = MIN(new_max, uint32_t(UINT16_MAX));
+    return true;
+}
+
+// add an obstacle. pos is the offset in meters from the EKF origin, radius is in meters. returns false if full
+bool AP_OAObstacleSnapshot::add(const Vector3f &pos, float _radius)
+{
+    if (num_obstacles >= max_obstacles) {
+        return false;
+    }
+    // scale the same way as the path, so margins match a direct calculation
+    const Vector3f point_cm = pos * 100.0f;
+    pos_x_cm[num_obstacles] = point_cm.x;
+    pos_y_cm[num_obstacles] = point_cm.y;
+    pos_z_cm[num_obstacles] = point_cm.z;
+    radius[num_obstacles] = _radius;
+    num_obstacles++;
+    return true;
+}
+
+// calculate the minimum distance between each path from start_cm to ends_cm[i] and the obstacles, less their radius
+void AP_OAObstacleSnapshot::calc_margins(const Vector3f &start_cm, const Vector3f *ends_cm, uint8_t num_ends, float *margins) const
+{
+    for (uint8_t i = 0; i < num_ends; i++) {
+        margins[i] = FLT_MAX;
+    }
+    for (uint32_t first = 0; first < num_obstacles; first += AP_OAOBSTACLESNAPSHOT_BLOCK) {
+        const uint16_t last = MIN(uint32_t(num_obstacles), first + AP_OAOBSTACLESNAPSHOT_BLOCK);
+        for (uint8_t i = 0; i < num_ends; i++) {
+            margins[i] = MIN(margins[i], calc_margin(start_cm, ends_cm[i], first, last));
+        }
+    }
+}
+
+// minimum margin between the path from w1 to w2 and obstacles first to last-1
+// this is the same arithmetic as Vector3f::closest_distance_between_line_and_point() with the
+// terms that only depend on the path taken out of the loop
+float AP_OAObstacleSnapshot::calc_margin(const Vector3f &w1, const Vector3f &w2, uint16_t first, uint16_t last) const
+{
+    float margin_min = FLT_MAX;
+
+    const Vector3f line_vec = w2 - w1;
+    const float line_vec_len = line_vec.length();
+    if (::is_zero(line_vec_len)) {
+        // the closest point on the path is its start
+        for (uint16_t i = first; i < last; i++) {
+            const float dist = norm(w1.x - pos_x_cm[i], w1.y - pos_y_cm[i], w1.z - pos_z_cm[i]);
+            const float margin = dist * 0.01f - radius[i];
+            margin_min = MIN(margin_min, margin);
+        }
+        return margin_min;
+    }
+
+    const float scale = 1 / line_vec_len;
+    const Vector3f unit_vec = line_vec * scale;
+    for (uint16_t i = first; i < last; i++) {
+        // position along the path of the closest point to the obstacle, as a fraction of its length
+        float dot_product = unit_vec.x * ((pos_x_cm[i] - w1.x) * scale) +
+                            unit_vec.y * ((pos_y_cm[i] - w1.y) * scale) +
+                            unit_vec.z * ((pos_z_cm[i] - w1.z) * scale);
+        dot_product = dot_product < 0 ? 0 : (dot_product > 1 ? 1 : dot_product);
+
+        const float dx = line_vec.x * dot_product + w1.x - pos_x_cm[i];
+        const float dy = line_vec.y * dot_product + w1.y - pos_y_cm[i];
+        const float dz = line_vec.z * dot_product + w1.z - pos_z_cm[i];
+        const float dist = norm(dx, dy, dz);
+        const float margin = dist * 0.01f - radius[i];
+        margin_min = MIN(margin_min, margin);
+    }
+    return margin_min;
+}
+
+#endif  // AP_OAPATHPLANNER_BENDYRULER_ENABLED
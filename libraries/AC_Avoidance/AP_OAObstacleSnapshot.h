@@ -0,0 +1,48 @@
+#pragma once
+
+#include "AC_Avoidance_config.h"
+
+#if AP_OAPATHPLANNER_BENDYRULER_ENABLED
+
+#include <AP_Common/AP_Common.h>
+#include <AP_Math/AP_Math.h>
+
+/*
+ * Copy of the obstacles in the object database with each coordinate held in its own array,
+ * so the margin between a path and every obstacle is calculated in a loop the compiler can vectorise
+ */
+class AP_OAObstacleSnapshot {
+public:
+    AP_OAObstacleSnapshot() {}
+    ~AP_OAObstacleSnapshot();
+
+    CLASS_NO_COPY(AP_OAObstacleSnapshot);  /* Do not allow copies */
+
+    // discard all obstacles and make room for count of them. returns false on allocation failure
+    bool reset(uint16_t count);
+
+    // add an obstacle. pos is the offset in meters from the EKF origin, radius is in meters. returns false if full
+    bool add(const Vector3f &pos, float radius);
+
+    // number of obstacles held
+    uint16_t count() const { return num_obstacles; }
+
+    // calculate the minimum distance between each path from start_cm to ends_cm[i] and the obstacles, less their radius
+    // start_cm and ends_cm are offsets in cm from the EKF origin, margins are in meters
+    // margins are set to FLT_MAX if there are no obstacles
+    void calc_margins(const Vector3f &start_cm, const Vector3f *ends_cm, uint8_t num_ends, float *margins) const;
+
+private:
+
+    // minimum margin between the path from w1 to w2 and obstacles first to last-1
+    float calc_margin(const Vector3f &w1, const Vector3f &w2, uint16_t first, uint16_t last) const;
+
+    float *pos_x_cm = nullptr;      // obstacle positions as offsets in cm from the EKF origin
+    float *pos_y_cm = nullptr;
+    float *pos_z_cm = nullptr;
+    float *radius = nullptr;        // obstacle radius in meters
+    uint16_t num_obstacles = 0;     // number of obstacles held
+    uint16_t max_obstacles = 0;     // number of obstacles there is room for
+};
+
+#endif  // AP_OAPATHPLANNER_BENDYRULER_ENABLED
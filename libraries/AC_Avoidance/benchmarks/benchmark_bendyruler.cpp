@@ -0,0 +1,129 @@
+#include <AP_gbenchmark.h>
+
+#include <AC_Avoidance/AP_OAObstacleSnapshot.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#if AP_OAPATHPLANNER_BENDYRULER_ENABLED
+
+#define MAX_OBSTACLES 5000
+#define NUM_PROBES 69
+#define LOOKAHEAD_CM 1500.0f
+
+/*
+  object database contents like those from a 360 degree lidar in a
+  cluttered area: walls of a corridor either side of the vehicle plus
+  scattered obstacles, positions in meters from the EKF origin
+ */
+static struct {
+    Vector3f pos;
+    float radius;
+} snapshot[MAX_OBSTACLES];
+
+static void make_snapshot(uint16_t count)
+{
+    uint32_t seed = 1;
+    for (uint16_t i = 0; i < count; i++) {
+        seed = seed * 1103515245U + 12345U;
+        const float r = ((seed >> 8) & 0xFFFF) * (1.0f / 0xFFFF);
+        if (i % 3 == 0) {
+            // scattered obstacles within 30m
+            const float angle = r * M_2PI;
+            const float dist = 3.0f + 27.0f * (((seed >> 4) & 0xFF) * (1.0f / 0xFF));
+            snapshot[i].pos = Vector3f(dist * cosf(angle), dist * sinf(angle), -2.0f);
+        } else {
+            // corridor walls 6m either side
+            snapshot[i].pos = Vector3f(-30.0f + 60.0f * r, (i % 3 == 1) ? -6.0f : 6.0f, -2.0f);
+        }
+        snapshot[i].radius = 0.1f + 0.02f * snapshot[i].pos.length();
+    }
+}
+
+// probe ends spread around the vehicle in 5 degree steps, in cm
+static void make_probes(Vector3f *ends)
+{
+    for (uint8_t i = 0; i < NUM_PROBES; i++) {
+        const float bearing = radians(((i + 1) / 2) * 5.0f * ((i % 2) ? -1.0f : 1.0f));
+        ends[i] = Vector3f(LOOKAHEAD_CM * cosf(bearing), LOOKAHEAD_CM * sinf(bearing), 200.0f);
+    }
+}
+
+// margin calculation as it was done directly from the object database
+static void BM_BendyRulerMarginsDirect(benchmark::State& state)
+{
+    const uint16_t count = state.range(0);
+    make_snapshot(count);
+    Vector3f ends[NUM_PROBES];
+    make_probes(ends);
+    const Vector3f start(0, 0, 200.0f);
+    float margins[NUM_PROBES];
+
+    while (state.KeepRunning()) {
+        for (uint8_t p = 0; p < NUM_PROBES; p++) {
+            float smallest_margin = FLT_MAX;
+            for (uint16_t i = 0; i < count; i++) {
+                const Vector3f point_cm = snapshot[i].pos * 100.0f;
+                const float m = Vector3f::closest_distance_between_line_and_point(start, ends[p], point_cm) * 0.01f - snapshot[i].radius;
+                if (m < smallest_margin) {
+                    smallest_margin = m;
+                }
+            }
+            margins[p] = smallest_margin;
+        }
+        gbenchmark_escape(margins);
+    }
+}
+
+// margins from the snapshot one path at a time
+static void BM_BendyRulerMarginsSnapshot(benchmark::State& state)
+{
+    const uint16_t count = state.range(0);
+    make_snapshot(count);
+    AP_OAObstacleSnapshot obstacles;
+    obstacles.reset(count);
+    for (uint16_t i = 0; i < count; i++) {
+        obstacles.add(snapshot[i].pos, snapshot[i].radius);
+    }
+    Vector3f ends[NUM_PROBES];
+    make_probes(ends);
+    const Vector3f start(0, 0, 200.0f);
+    float margins[NUM_PROBES];
+
+    while (state.KeepRunning()) {
+        for (uint8_t p = 0; p < NUM_PROBES; p++) {
+            obstacles.calc_margins(start, &ends[p], 1, &margins[p]);
+        }
+        gbenchmark_escape(margins);
+    }
+}
+
+// margins from the snapshot in batches of 8 paths, as BendyRuler does
+static void BM_BendyRulerMarginsSnapshotBatch(benchmark::State& state)
+{
+    const uint16_t count = state.range(0);
+    make_snapshot(count);
+    AP_OAObstacleSnapshot obstacles;
+    obstacles.reset(count);
+    for (uint16_t i = 0; i < count; i++) {
+        obstacles.add(snapshot[i].pos, snapshot[i].radius);
+    }
+    Vector3f ends[NUM_PROBES];
+    make_probes(ends);
+    const Vector3f start(0, 0, 200.0f);
+    float margins[NUM_PROBES];
+
+    while (state.KeepRunning()) {
+        for (uint8_t p = 0; p < NUM_PROBES; p += 8) {
+            obstacles.calc_margins(start, &ends[p], MIN(8, NUM_PROBES - p), &margins[p]);
+        }
+        gbenchmark_escape(margins);
+    }
+}
+
+BENCHMARK(BM_BendyRulerMarginsDirect)->Arg(100)->Arg(1000)->Arg(MAX_OBSTACLES);
+BENCHMARK(BM_BendyRulerMarginsSnapshot)->Arg(100)->Arg(1000)->Arg(MAX_OBSTACLES);
+BENCHMARK(BM_BendyRulerMarginsSnapshotBatch)->Arg(100)->Arg(1000)->Arg(MAX_OBSTACLES);
+
+#endif  // AP_OAPATHPLANNER_BENDYRULER_ENABLED
+
+BENCHMARK_MAIN();
@@ -287,6 +287,7 @@ private:
         Vector2f *points; // pointer into the _loaded_offsets_from_origin array
         Vector2l *points_lla; // pointer into the _loaded_points_lla array
         uint8_t count; // count of points in the boundary
+        PolygonIndex<int32_t> index; // speeds up breach checks on points_lla
     };
     InclusionBoundary *_loaded_inclusion_boundary;
 
@@ -297,6 +298,7 @@ private:
         Vector2f *points; // pointer into the _loaded_offsets_from_origin array
         Vector2l *points_lla; // pointer into the _loaded_points_lla_lla array
         uint8_t count; // count of points in the boundary
+        PolygonIndex<int32_t> index; // speeds up breach checks on points_lla
     };
     ExclusionBoundary *_loaded_exclusion_boundary;
 
@@ -205,14 +205,29 @@ void AP_ADSB::init(void)
         in_state.list_size_param.set(constrain_int16(in_state.list_size_param, 1, INT16_MAX));
 
         in_state.vehicle_list = new adsb_vehicle_t[in_state.list_size_param];
+        in_state.vehicle_distance = new float[in_state.list_size_param];
 
-        if (in_state.vehicle_list == nullptr) {
+        if (in_state.vehicle_list == nullptr || in_state.vehicle_distance == nullptr) {
             // dynamic RAM allocation of in_state.vehicle_list[] failed
+            delete[] in_state.vehicle_list;
+            delete[] in_state.vehicle_distance;
+            in_state.vehicle_list = nullptr;
+            in_state.vehicle_distance = nullptr;
             _init_failed = true; // this keeps us from constantly trying to init forever in main update
             GCS_SEND_TEXT(MAV_SEVERITY_INFO, "ADSB: Unable to initialize ADSB vehicle list");
             return;
         }
         in_state.list_size_allocated = in_state.list_size_param;
+
+        // the ICAO index is kept at most half full. Without it find_index() searches the list
+        uint32_t num_slots = 2;
+        while (num_slots < 2U * in_state.list_size_allocated) {
+            num_slots *= 2;
+        }
+        in_state.icao_index = new uint16_t[num_slots];
+        if (in_state.icao_index != nullptr) {
+            in_state.icao_index_mask = num_slots - 1;
+        }
     }
 
     if (detected_num_instances == 0) {
@@ -447,11 +462,13 @@ void AP_ADSB::determine_furthest_aircraft(void)
     float max_distance = 0;
     uint16_t max_distance_index = 0;
 
+    // use the distance from when each vehicle was last updated, which is
+    // at most VEHICLE_TIMEOUT_MS old, rather than recalculating them all
     for (uint16_t index = 0; index < in_state.vehicle_count; index++) {
         if (is_special_vehicle(in_state.vehicle_list[index].info.ICAO_address)) {
             continue;
         }
-        const float distance = _my_loc.get_distance(get_location(in_state.vehicle_list[index]));
+        const float distance = in_state.vehicle_distance[index];
         if (max_distance < distance || index == 0) {
             max_distance = distance;
             max_distance_index = index;
@@ -492,8 +509,17 @@ void AP_ADSB::delete_vehicle(const uint16_t index)
         in_state.furthest_vehicle_distance = 0;
         in_state.furthest_vehicle_index = 0;
     }
+    uint32_t slot;
+    if (icao_index_find(in_state.vehicle_list[index].info.ICAO_address, slot)) {
+        icao_index_remove(slot);
+    }
     if (index != (in_state.vehicle_count-1)) {
+        // the last vehicle moves into the deleted vehicle's place
+        if (icao_index_find(in_state.vehicle_list[in_state.vehicle_count-1].info.ICAO_address, slot)) {
+            in_state.icao_index[slot] = index + 1;
+        }
         in_state.vehicle_list[index] = in_state.vehicle_list[in_state.vehicle_count-1];
+        in_state.vehicle_distance[index] = in_state.vehicle_distance[in_state.vehicle_count-1];
     }
     // TODO: is memset needed? When we decrement the index we essentially forget about it
     memset(&in_state.vehicle_list[in_state.vehicle_count-1], 0, sizeof(adsb_vehicle_t));
@@ -507,6 +533,15 @@ void AP_ADSB::delete_vehicle(const uint16_t index)
  */
 bool AP_ADSB::find_index(const adsb_vehicle_t &vehicle, uint16_t *index) const
 {
+    if (in_state.icao_index != nullptr) {
+        uint32_t slot;
+        if (!icao_index_find(vehicle.info.ICAO_address, slot)) {
+            return false;
+        }
+        *index = in_state.icao_index[slot] - 1;
+        return true;
+    }
+
     for (uint16_t i = 0; i < in_state.vehicle_count; i++) {
         if (in_state.vehicle_list[i].info.ICAO_address == vehicle.info.ICAO_address) {
             *index = i;
@@ -556,12 +591,12 @@ void AP_ADSB::handle_adsb_vehicle(const adsb_vehicle_t &vehicle)
     } else if (is_tracked_in_list) {
 
         // found, update it
-        set_vehicle(index, vehicle);
+        set_vehicle(index, vehicle, my_loc_distance_to_vehicle);
 
     } else if (in_state.vehicle_count < in_state.list_size_allocated) {
 
         // not found and there's room, add it to the end of the list
-        set_vehicle(in_state.vehicle_count, vehicle);
+        set_vehicle(in_state.vehicle_count, vehicle, my_loc_distance_to_vehicle);
         in_state.vehicle_count++;
 
     } else {
@@ -580,7 +615,7 @@ void AP_ADSB::handle_adsb_vehicle(const adsb_vehicle_t &vehicle)
 
             if (my_loc_distance_to_vehicle < in_state.furthest_vehicle_distance) { // is closer than the furthest
                 // replace with the furthest vehicle
-                set_vehicle(in_state.furthest_vehicle_index, vehicle);
+                set_vehicle(in_state.furthest_vehicle_index, vehicle, my_loc_distance_to_vehicle);
 
                 // in_state.furthest_vehicle_index is now invalid because the vehicle was overwritten, need
                 // to run determine_furthest_aircraft() to determine a new one next time
@@ -604,19 +639,95 @@ void AP_ADSB::handle_adsb_vehicle(const adsb_vehicle_t &vehicle)
 /*
  * Copy a vehicle's data into the list
  */
-void AP_ADSB::set_vehicle(const uint16_t index, const adsb_vehicle_t &vehicle)
+void AP_ADSB::set_vehicle(const uint16_t index, const adsb_vehicle_t &vehicle, const float distance)
 {
     if (index >= in_state.list_size_allocated) {
         // out of range
         return;
     }
+
+    // keep the ICAO index up to date if this replaces a different vehicle or adds a new one
+    const bool replacing = index < in_state.vehicle_count;
+    const bool icao_changed = !replacing || in_state.vehicle_list[index].info.ICAO_address != vehicle.info.ICAO_address;
+    uint32_t slot;
+    if (replacing && icao_changed && icao_index_find(in_state.vehicle_list[index].info.ICAO_address, slot)) {
+        icao_index_remove(slot);
+    }
     in_state.vehicle_list[index] = vehicle;
+    in_state.vehicle_distance[index] = distance;
+    if (icao_changed) {
+        icao_index_add(index);
+    }
 
 #if HAL_LOGGING_ENABLED
     write_log(vehicle);
 #endif
 }
 
+/*
+ * return the first slot of the ICAO index to check for an ICAO address
+ */
+uint32_t AP_ADSB::icao_index_home(const uint32_t icao) const
+{
+    // multiplicative hash, taking the upper bits as nearby aircraft often have similar addresses
+    return ((icao * 2654435761U) >> 16) & in_state.icao_index_mask;
+}
+
+/*
+ * find the slot of the ICAO index holding a vehicle. Returns false if
+ * the vehicle is not in the list or there is no index
+ */
+bool AP_ADSB::icao_index_find(const uint32_t icao, uint32_t &slot) const
+{
+    if (in_state.icao_index == nullptr) {
+        return false;
+    }
+    for (slot = icao_index_home(icao); in_state.icao_index[slot] != 0; slot = (slot + 1) & in_state.icao_index_mask) {
+        if (in_state.vehicle_list[in_state.icao_index[slot]-1].info.ICAO_address == icao) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * add the vehicle at index in vehicle_list to the ICAO index
+ */
+void AP_ADSB::icao_index_add(const uint16_t index)
+{
+    if (in_state.icao_index == nullptr) {
+        return;
+    }
+    uint32_t slot = icao_index_home(in_state.vehicle_list[index].info.ICAO_address);
+    while (in_state.icao_index[slot] != 0) {
+        slot = (slot + 1) & in_state.icao_index_mask;
+    }
+    in_state.icao_index[slot] = index + 1;
+}
+
+/*
+ * empty a slot of the ICAO index, moving back any later entries that
+ * could no longer be found past the gap
+ */
+void AP_ADSB::icao_index_remove(uint32_t slot)
+{
+    const uint32_t mask = in_state.icao_index_mask;
+    uint32_t next = slot;
+    while (true) {
+        next = (next + 1) & mask;
+        if (in_state.icao_index[next] == 0) {
+            break;
+        }
+        const uint32_t home = icao_index_home(in_state.vehicle_list[in_state.icao_index[next]-1].info.ICAO_address);
+        // the entry can move to the gap if its home is not between the gap and where it is now
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            in_state.icao_index[slot] = in_state.icao_index[next];
+            slot = next;
+        }
+    }
+    in_state.icao_index[slot] = 0;
+}
+
 void AP_ADSB::send_adsb_vehicle(const mavlink_channel_t chan)
 {
     if (!check_startup() || in_state.vehicle_count == 0) {
@@ -242,7 +242,14 @@ private:
     // remove a vehicle from the list
     void delete_vehicle(const uint16_t index);
 
-    void set_vehicle(const uint16_t index, const adsb_vehicle_t &vehicle);
+    // copy a vehicle into the list. distance is from us to the vehicle in meters
+    void set_vehicle(const uint16_t index, const adsb_vehicle_t &vehicle, const float distance);
+
+    // ICAO address hash index over vehicle_list, using linear probing
+    uint32_t icao_index_home(const uint32_t icao) const;
+    bool icao_index_find(const uint32_t icao, uint32_t &slot) const;
+    void icao_index_add(const uint16_t index);
+    void icao_index_remove(uint32_t slot);
 
     // Generates pseudorandom ICAO from gps time, lat, and lon
     uint32_t genICAO(const Location &loc) const;
@@ -271,7 +278,12 @@ private:
         AP_Int16    list_size_param;
         uint16_t    list_size_allocated;
         adsb_vehicle_t *vehicle_list;
+        float       *vehicle_distance;  // distance in meters to each vehicle when it was last updated
         uint16_t    vehicle_count;
+
+        // slots hold index+1 into vehicle_list, zero if empty. Number of slots is a power of two
+        uint16_t    *icao_index;
+        uint32_t    icao_index_mask;
         AP_Int32    list_radius;
         AP_Int16    list_altitude;
 
@@ -279,15 +279,14 @@ void AP_Avoidance::get_adsb_samples()
     }
 }
 
-float closest_approach_xy(const Location &my_loc,
+// delta_pos_ne is our position relative to the obstacle
+float closest_approach_xy(const Vector2f &delta_pos_ne,
                           const Vector3f &my_vel,
-                          const Location &obstacle_loc,
                           const Vector3f &obstacle_vel,
                           const uint8_t time_horizon)
 {
 
     Vector2f delta_vel_ne = Vector2f(obstacle_vel[0] - my_vel[0], obstacle_vel[1] - my_vel[1]);
-    const Vector2f delta_pos_ne = obstacle_loc.get_distance_NE(my_loc);
 
     Vector2f line_segment_ne = delta_vel_ne * time_horizon;
 
@@ -343,24 +342,40 @@ void AP_Avoidance::update_threat_level(const Location &my_loc,
     obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_NONE;
 
     const uint32_t obstacle_age = AP_HAL::millis() - obstacle.timestamp_ms;
-    float closest_xy = closest_approach_xy(my_loc, my_vel, obstacle_loc, obstacle_vel, _fail_time_horizon + obstacle_age/1000);
-    if (closest_xy < _fail_distance_xy) {
-        obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_HIGH;
+    const uint8_t fail_time_horizon = _fail_time_horizon + obstacle_age/1000;
+    const uint8_t warn_time_horizon = _warn_time_horizon + obstacle_age/1000;
+    const Vector2f delta_pos_ne = obstacle_loc.get_distance_NE(my_loc);
+
+    // an obstacle that is too far away to come within either distance
+    // before the longest horizon, whatever its direction, is not a threat
+    const float relative_speed = Vector2f(obstacle_vel[0] - my_vel[0], obstacle_vel[1] - my_vel[1]).length();
+    const float max_travel = relative_speed * MAX(fail_time_horizon, warn_time_horizon);
+    const bool reachable = delta_pos_ne.length() - max_travel <= MAX(float(_fail_distance_xy), _warn_distance_xy.get()) + 1.0f;
+
+    float closest_xy;
+    if (!reachable) {
+        // only needed for reporting
+        closest_xy = closest_approach_xy(delta_pos_ne, my_vel, obstacle_vel, warn_time_horizon);
     } else {
-        closest_xy = closest_approach_xy(my_loc, my_vel, obstacle_loc, obstacle_vel, _warn_time_horizon + obstacle_age/1000);
-        if (closest_xy < _warn_distance_xy) {
-            obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_LOW;
+        closest_xy = closest_approach_xy(delta_pos_ne, my_vel, obstacle_vel, fail_time_horizon);
+        if (closest_xy < _fail_distance_xy) {
+            obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_HIGH;
+        } else {
+            closest_xy = closest_approach_xy(delta_pos_ne, my_vel, obstacle_vel, warn_time_horizon);
+            if (closest_xy < _warn_distance_xy) {
+                obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_LOW;
+            }
         }
     }
 
     // check for vertical separation; our threat level is the minimum
     // of vertical and horizontal threat levels
-    float closest_z = closest_approach_z(my_loc, my_vel, obstacle_loc, obstacle_vel, _warn_time_horizon + obstacle_age/1000);
+    float closest_z = closest_approach_z(my_loc, my_vel, obstacle_loc, obstacle_vel, warn_time_horizon);
     if (obstacle.threat_level != MAV_COLLISION_THREAT_LEVEL_NONE) {
         if (closest_z > _warn_distance_z) {
             obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_NONE;
         } else {
-            closest_z = closest_approach_z(my_loc, my_vel, obstacle_loc, obstacle_vel, _fail_time_horizon + obstacle_age/1000);
+            closest_z = closest_approach_z(my_loc, my_vel, obstacle_loc, obstacle_vel, fail_time_horizon);
             if (closest_z > _fail_distance_z) {
                 obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_LOW;
             }
@@ -483,11 +498,10 @@ void AP_Avoidance::check_for_threats()
         const uint32_t obstacle_age = AP_HAL::millis() - obstacle.timestamp_ms;
         debug("i=%d src_id=%d timestamp=%u age=%d", i, obstacle.src_id, obstacle.timestamp_ms, obstacle_age);
 
-        update_threat_level(my_loc, my_vel, obstacle);
-        debug("   threat-level=%d", obstacle.threat_level);
-
         // ignore any really old data:
         if (obstacle_age > MAX_OBSTACLE_AGE_MS) {
+            // update_threat_level() would find it is no threat
+            obstacle.threat_level = MAV_COLLISION_THREAT_LEVEL_NONE;
             // shrink list if this is the last entry:
             if (i == _obstacle_count-1) {
                 _obstacle_count -= 1;
@@ -495,6 +509,9 @@ void AP_Avoidance::check_for_threats()
             continue;
         }
 
+        update_threat_level(my_loc, my_vel, obstacle);
+        debug("   threat-level=%d", obstacle.threat_level);
+
         if (obstacle_is_more_serious_threat(obstacle)) {
             _current_most_serious_threat = i;
         }
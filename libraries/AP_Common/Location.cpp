@@ -514,3 +514,52 @@ void Location::linearly_interpolate_alt(const Location &point1, const Location &
     // new target's distance along the original track and then linear interpolate between the original origin and destination altitudes
     set_alt_cm(point1.alt + (point2.alt - point1.alt) * constrain_float(line_path_proportion(point1, point2), 0.0f, 1.0f), point2.get_alt_frame());
 }
+
+// set the origin and calculate its scaling
+void Location::LocalFrame::set_origin(const Location &_origin)
+{
+    origin = _origin;
+    lng_to_m = LOCATION_SCALING_FACTOR * longitude_scale(origin.lat);
+    m_to_lng = 1.0f / lng_to_m;
+}
+
+// return the distance in meters in North/East plane as a N/E vector from the origin to loc
+Vector2f Location::LocalFrame::get_distance_NE(const Location &loc) const
+{
+    return Vector2f((loc.lat - origin.lat) * LOCATION_SCALING_FACTOR,
+                    diff_longitude(loc.lng, origin.lng) * lng_to_m);
+}
+
+void Location::LocalFrame::get_distance_NE(const Location *locs, Vector2f *ne, uint16_t count) const
+{
+    for (uint16_t i = 0; i < count; i++) {
+        ne[i] = get_distance_NE(locs[i]);
+    }
+}
+
+// return the bearing in radians from the origin to loc, from 0 to 2*Pi
+ftype Location::LocalFrame::get_bearing(const Location &loc) const
+{
+    const Vector2f ne = get_distance_NE(loc);
+    ftype bearing = atan2F(ne.y, ne.x);
+    if (bearing < 0) {
+        bearing += 2*M_PI;
+    }
+    return bearing;
+}
+
+// return the location ne meters North/East of the origin, with the origin's altitude
+Location Location::LocalFrame::get_location(const Vector2f &ne) const
+{
+    Location loc = origin;
+    loc.lat = limit_lattitude(origin.lat + int32_t(ne.x * LOCATION_SCALING_FACTOR_INV));
+    loc.lng = wrap_longitude(int64_t(origin.lng) + int64_t(ne.y * m_to_lng));
+    return loc;
+}
+
+void Location::LocalFrame::get_locations(const Vector2f *ne, Location *locs, uint16_t count) const
+{
+    for (uint16_t i = 0; i < count; i++) {
+        locs[i] = get_location(ne[i]);
+    }
+}
@@ -159,6 +159,9 @@ public:
     // get lon1-lon2, wrapping at -180e7 to 180e7
     static int32_t diff_longitude(int32_t lon1, int32_t lon2);
 
+    // north/east plane around an origin, see below
+    class LocalFrame;
+
 private:
 
     // scaling factor from 1e-7 degrees to meters at equator
@@ -167,3 +170,44 @@ private:
     // inverse of LOCATION_SCALING_FACTOR
     static constexpr float LOCATION_SCALING_FACTOR_INV = LATLON_TO_M_INV;
 };
+
+/*
+  north/east plane tangent to the earth at an origin. The longitude
+  scaling is worked out once for the origin rather than for every
+  conversion, so use this when converting many locations near one
+  point, for example fence or obstacle vertices. Longitude is scaled
+  at the origin's latitude rather than the midpoint's, so east
+  distances differ from Location::get_distance_NE() by about 10cm per
+  km north and km east of the origin at mid latitudes
+ */
+class Location::LocalFrame
+{
+public:
+    LocalFrame(const Location &_origin) { set_origin(_origin); }
+
+    // set the origin and calculate its scaling
+    void set_origin(const Location &_origin);
+    const Location &get_origin() const { return origin; }
+
+    // return the distance in meters in North/East plane as a N/E vector from the origin to loc
+    Vector2f get_distance_NE(const Location &loc) const;
+
+    // as above for count locations
+    void get_distance_NE(const Location *locs, Vector2f *ne, uint16_t count) const;
+
+    // return the bearing in radians from the origin to loc, from 0 to 2*Pi
+    ftype get_bearing(const Location &loc) const;
+
+    // return the location ne meters North/East of the origin, with the origin's altitude
+    Location get_location(const Vector2f &ne) const;
+
+    // as above for count offsets
+    void get_locations(const Vector2f *ne, Location *locs, uint16_t count) const;
+
+private:
+    Location origin;
+
+    // meters per 1e-7 degree of longitude at the origin, and its inverse
+    float lng_to_m;
+    float m_to_lng;
+};
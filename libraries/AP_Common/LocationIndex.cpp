@@ -0,0 +1,101 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LocationIndex.h"
+
+LocationIndex::~LocationIndex()
+{
+    delete[] points;
+}
+
+bool LocationIndex::reset(uint16_t count)
+{
+    num_points = 0;
+    if (count <= max_points) {
+        return true;
+    }
+    delete[] points;
+    points = new Point[count];
+    if (points == nullptr) {
+        max_points = 0;
+        return false;
+    }
+    max_points = count;
+    return true;
+}
+
+bool LocationIndex::add(const Location &loc, uint16_t id)
+{
+    if (num_points >= max_points) {
+        return false;
+    }
+    if (num_points == 0) {
+        origin = loc;
+    }
+    points[num_points].ne = origin.get_distance_NE(loc);
+    points[num_points].id = id;
+    num_points++;
+    return true;
+}
+
+void LocationIndex::swap_points(uint16_t a, uint16_t b)
+{
+    const Point tmp = points[a];
+    points[a] = points[b];
+    points[b] = tmp;
+}
+
+void LocationIndex::build(void)
+{
+    build(0, num_points, 0);
+}
+
+/*
+  partially sort points[lo..hi) so the median on axis is at the
+  middle, with no larger values before it and no smaller ones after
+  it, then do the same for each half on the other axis
+ */
+void LocationIndex::build(uint16_t lo, uint16_t hi, uint8_t axis)
+{
+    if (hi - lo < 2) {
+        return;
+    }
+    const uint16_t mid = lo + (hi - lo) / 2;
+
+    // quickselect, partitioning around the last element
+    uint16_t left = lo;
+    uint16_t right = hi - 1;
+    while (left < right) {
+        const float pivot = points[right].ne[axis];
+        uint16_t store = left;
+        for (uint16_t i = left; i < right; i++) {
+            if (points[i].ne[axis] < pivot) {
+                swap_points(i, store++);
+            }
+        }
+        swap_points(store, right);
+        if (store == mid) {
+            break;
+        }
+        if (store < mid) {
+            left = store + 1;
+        } else {
+            right = store - 1;
+        }
+    }
+
+    build(lo, mid, axis ^ 1);
+    build(mid+1, hi, axis ^ 1);
+}
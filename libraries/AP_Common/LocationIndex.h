@@ -0,0 +1,142 @@
+/*
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <AP_Common/AP_Common.h>
+#include <AP_Common/Location.h>
+#include <AP_Math/AP_Math.h>
+
+/*
+  static 2D k-d tree over a set of locations, for nearest point
+  queries such as choosing a rally point or landing sequence.
+
+  Points are stored as NE offsets from the first point added, and
+  the tree is balanced by splitting at the median of alternating
+  axes. Build it again whenever the set of points changes.
+ */
+class LocationIndex {
+public:
+    LocationIndex() {}
+    ~LocationIndex();
+
+    CLASS_NO_COPY(LocationIndex);
+
+    // discard all points and make room for count of them. Returns
+    // false on allocation failure
+    bool reset(uint16_t count);
+
+    // add a point, identified by id, returning false if full
+    bool add(const Location &loc, uint16_t id);
+
+    // arrange the points added since reset() into the tree
+    void build(void);
+
+    // number of points in the tree
+    uint16_t count(void) const { return num_points; }
+
+    /*
+      find the point with the smallest distance to loc, using
+      distance_fn(id) to give the exact distance to each candidate.
+      The distance must be at least the horizontal distance to the
+      point, as the horizontal distance is used to skip parts of the
+      tree. distance_fn may return a negative value to reject a point.
+      Returns false if no point was accepted
+     */
+    template <typename DistanceFn>
+    bool find_nearest(const Location &loc, DistanceFn distance_fn, uint16_t &id, float &distance) const
+    {
+        if (num_points == 0) {
+            return false;
+        }
+        const Vector2f q = origin.get_distance_NE(loc);
+        Search<DistanceFn> s { q, distance_fn, -1, 0 };
+        search(s, 0, num_points, 0);
+        if (s.best_distance < 0) {
+            return false;
+        }
+        id = s.best_id;
+        distance = s.best_distance;
+        return true;
+    }
+
+private:
+    struct Point {
+        Vector2f ne;
+        uint16_t id;
+    };
+
+    template <typename DistanceFn>
+    struct Search {
+        Vector2f q;
+        DistanceFn &fn;
+        float best_distance;
+        uint16_t best_id;
+    };
+
+    /*
+      offsets are taken from a single origin, so the horizontal
+      distance between two points differs slightly from
+      Location::get_distance(). Scale the bounds used for skipping
+      branches so that this does not discard the nearest point
+     */
+    static constexpr float BOUND_SCALE = 0.95;
+    static constexpr float BOUND_MARGIN_M = 1.0;
+
+    template <typename DistanceFn>
+    bool could_be_closer(const Search<DistanceFn> &s, float horizontal_distance) const
+    {
+        return s.best_distance < 0 ||
+            horizontal_distance * BOUND_SCALE - BOUND_MARGIN_M < s.best_distance;
+    }
+
+    template <typename DistanceFn>
+    void search(Search<DistanceFn> &s, uint16_t lo, uint16_t hi, uint8_t axis) const
+    {
+        if (lo >= hi) {
+            return;
+        }
+        const uint16_t mid = lo + (hi - lo) / 2;
+        const Point &p = points[mid];
+        if (could_be_closer(s, (p.ne - s.q).length())) {
+            const float d = s.fn(p.id);
+            if (d >= 0 && (s.best_distance < 0 || d < s.best_distance)) {
+                s.best_distance = d;
+                s.best_id = p.id;
+            }
+        }
+        const float diff = s.q[axis] - p.ne[axis];
+        const uint8_t next_axis = axis ^ 1;
+        if (diff < 0) {
+            search(s, lo, mid, next_axis);
+            if (could_be_closer(s, -diff)) {
+                search(s, mid+1, hi, next_axis);
+            }
+        } else {
+            search(s, mid+1, hi, next_axis);
+            if (could_be_closer(s, diff)) {
+                search(s, lo, mid, next_axis);
+            }
+        }
+    }
+
+    void build(uint16_t lo, uint16_t hi, uint8_t axis);
+    void swap_points(uint16_t a, uint16_t b);
+
+    Location origin;
+    Point *points = nullptr;
+    uint16_t num_points = 0;
+    uint16_t max_points = 0;
+};
@@ -0,0 +1,113 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Common/Location.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+// a fence or obstacle list around one point
+#define NUM_POINTS 100
+
+static const Location origin{-353632620, 1491652373, 58400, Location::AltFrame::ABSOLUTE};
+static Location points[NUM_POINTS];
+static Vector2f offsets[NUM_POINTS];
+
+static void make_points(void)
+{
+    for (uint16_t i=0; i<NUM_POINTS; i++) {
+        offsets[i] = Vector2f(cosf(i * 0.1f), sinf(i * 0.1f)) * (10.0f * i);
+        points[i] = origin;
+        points[i].offset(offsets[i].x, offsets[i].y);
+    }
+}
+
+static void BM_DistanceNEPerCall(benchmark::State& state)
+{
+    make_points();
+    Vector2f ne[NUM_POINTS];
+    while (state.KeepRunning()) {
+        for (uint16_t i=0; i<NUM_POINTS; i++) {
+            ne[i] = origin.get_distance_NE(points[i]);
+        }
+        gbenchmark_escape(ne);
+    }
+}
+
+static void BM_DistanceNELocalFrame(benchmark::State& state)
+{
+    make_points();
+    Vector2f ne[NUM_POINTS];
+    while (state.KeepRunning()) {
+        const Location::LocalFrame frame{origin};
+        frame.get_distance_NE(points, ne, NUM_POINTS);
+        gbenchmark_escape(ne);
+    }
+}
+
+static void BM_BearingPerCall(benchmark::State& state)
+{
+    make_points();
+    ftype bearing[NUM_POINTS];
+    while (state.KeepRunning()) {
+        for (uint16_t i=0; i<NUM_POINTS; i++) {
+            bearing[i] = origin.get_bearing(points[i]);
+        }
+        gbenchmark_escape(bearing);
+    }
+}
+
+static void BM_BearingLocalFrame(benchmark::State& state)
+{
+    make_points();
+    ftype bearing[NUM_POINTS];
+    while (state.KeepRunning()) {
+        const Location::LocalFrame frame{origin};
+        for (uint16_t i=0; i<NUM_POINTS; i++) {
+            bearing[i] = frame.get_bearing(points[i]);
+        }
+        gbenchmark_escape(bearing);
+    }
+}
+
+static void BM_OffsetPerCall(benchmark::State& state)
+{
+    make_points();
+    Location locs[NUM_POINTS];
+    while (state.KeepRunning()) {
+        for (uint16_t i=0; i<NUM_POINTS; i++) {
+            locs[i] = origin;
+            locs[i].offset(offsets[i].x, offsets[i].y);
+        }
+        gbenchmark_escape(locs);
+    }
+}
+
+static void BM_OffsetLocalFrame(benchmark::State& state)
+{
+    make_points();
+    Location locs[NUM_POINTS];
+    while (state.KeepRunning()) {
+        const Location::LocalFrame frame{origin};
+        frame.get_locations(offsets, locs, NUM_POINTS);
+        gbenchmark_escape(locs);
+    }
+}
+
+static void BM_LongitudeScale(benchmark::State& state)
+{
+    int32_t lat = origin.lat;
+    while (state.KeepRunning()) {
+        ftype scale = Location::longitude_scale(lat);
+        gbenchmark_escape(&scale);
+        lat++;
+    }
+}
+
+BENCHMARK(BM_DistanceNEPerCall);
+BENCHMARK(BM_DistanceNELocalFrame);
+BENCHMARK(BM_BearingPerCall);
+BENCHMARK(BM_BearingLocalFrame);
+BENCHMARK(BM_OffsetPerCall);
+BENCHMARK(BM_OffsetLocalFrame);
+BENCHMARK(BM_LongitudeScale);
+
+BENCHMARK_MAIN();
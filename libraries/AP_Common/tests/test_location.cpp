@@ -389,4 +389,46 @@ TEST(Location, OffsetError)
     }
 }
 
+TEST(Location, LocalFrame)
+{
+    const Location origin{-353632620, 1491652373, 58400, Location::AltFrame::ABSOLUTE};
+    const Location::LocalFrame frame{origin};
+
+    const Vector2f offsets[] {
+        {0, 0},
+        {100, 0},
+        {0, -100},
+        {-250, 730},
+        {1000, 1000},
+    };
+    Location locs[ARRAY_SIZE(offsets)];
+    frame.get_locations(offsets, locs, ARRAY_SIZE(offsets));
+    Vector2f ne[ARRAY_SIZE(offsets)];
+    frame.get_distance_NE(locs, ne, ARRAY_SIZE(offsets));
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(offsets); i++) {
+        // round trip is limited by the 1e-7 degree resolution of a location
+        EXPECT_VECTOR2F_NEAR(offsets[i], ne[i], 0.02);
+        EXPECT_EQ(origin.alt, locs[i].alt);
+
+        // the same as scaling each location on its own, within the
+        // difference in longitude scaling between the origin and the midpoint
+        EXPECT_VECTOR2F_NEAR(origin.get_distance_NE(locs[i]), ne[i], 0.2);
+        Location loc = origin;
+        loc.offset(offsets[i].x, offsets[i].y);
+        EXPECT_VECTOR2F_NEAR(frame.get_distance_NE(loc), offsets[i], 0.2);
+
+        if (!offsets[i].is_zero()) {
+            EXPECT_NEAR(origin.get_bearing(locs[i]), frame.get_bearing(locs[i]), 1.0e-3);
+        }
+    }
+
+    // longitude wraps at 180 degrees
+    const Location dateline{0, 1799999000, 0, Location::AltFrame::ABSOLUTE};
+    const Location::LocalFrame dateline_frame{dateline};
+    const Location east = dateline_frame.get_location(Vector2f(0, 1000));
+    EXPECT_LT(east.lng, -1790000000);
+    EXPECT_NEAR(1000, dateline_frame.get_distance_NE(east).y, 0.02);
+}
+
 AP_GTEST_MAIN()
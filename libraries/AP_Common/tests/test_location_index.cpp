@@ -0,0 +1,82 @@
+#include <AP_gtest.h>
+
+/*
+  tests for AP_Common/LocationIndex.cpp
+ */
+
+#include <AP_Common/LocationIndex.h>
+#include <stdlib.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#if CONFIG_HAL_BOARD == HAL_BOARD_SITL || CONFIG_HAL_BOARD == HAL_BOARD_LINUX
+
+static Location random_location(const Location &centre, float radius_m)
+{
+    Location loc = centre;
+    loc.offset((random() % 2001 - 1000) * 0.001 * radius_m,
+               (random() % 2001 - 1000) * 0.001 * radius_m);
+    return loc;
+}
+
+TEST(LocationIndex, MatchesLinearSearch)
+{
+    const Location centre { -353632610, 1491652300, 58400, Location::AltFrame::ABSOLUTE };
+    Location locs[200];
+    LocationIndex index;
+
+    for (uint16_t n = 1; n <= ARRAY_SIZE(locs); n += 13) {
+        ASSERT_TRUE(index.reset(n));
+        for (uint16_t i = 0; i < n; i++) {
+            locs[i] = random_location(centre, 20000);
+            ASSERT_TRUE(index.add(locs[i], i));
+        }
+        EXPECT_FALSE(index.add(centre, n));
+        index.build();
+        EXPECT_EQ(index.count(), n);
+
+        for (uint8_t q = 0; q < 50; q++) {
+            const Location query = random_location(centre, 30000);
+            // reject odd ids to check filtering
+            auto distance_fn = [&](uint16_t id) -> float {
+                if (n > 1 && (id & 1)) {
+                    return -1;
+                }
+                return query.get_distance(locs[id]);
+            };
+            float best = -1;
+            uint16_t best_id = 0;
+            for (uint16_t i = 0; i < n; i++) {
+                const float d = distance_fn(i);
+                if (d >= 0 && (best < 0 || d < best)) {
+                    best = d;
+                    best_id = i;
+                }
+            }
+            uint16_t id;
+            float distance;
+            ASSERT_TRUE(index.find_nearest(query, distance_fn, id, distance));
+            EXPECT_EQ(id, best_id);
+            EXPECT_FLOAT_EQ(distance, best);
+        }
+    }
+}
+
+TEST(LocationIndex, Empty)
+{
+    LocationIndex index;
+    uint16_t id;
+    float distance;
+    auto distance_fn = [](uint16_t id) -> float { return 0; };
+    EXPECT_FALSE(index.find_nearest(Location(), distance_fn, id, distance));
+
+    ASSERT_TRUE(index.reset(1));
+    ASSERT_TRUE(index.add(Location(), 7));
+    index.build();
+    auto reject_fn = [](uint16_t id) -> float { return -1; };
+    EXPECT_FALSE(index.find_nearest(Location(), reject_fn, id, distance));
+}
+
+AP_GTEST_MAIN()
+
+#endif // HAL_SITL or HAL_LINUX
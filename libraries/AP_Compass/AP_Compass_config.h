@@ -18,6 +18,11 @@
 #define COMPASS_CAL_ENABLED AP_COMPASS_ENABLED && AP_AHRS_DCM_ENABLED
 #endif
 
+// fit each compass being calibrated on its own thread, so they run in parallel on boards with several cores
+#ifndef AP_COMPASS_CALIBRATION_THREAD_PER_COMPASS_ENABLED
+#define AP_COMPASS_CALIBRATION_THREAD_PER_COMPASS_ENABLED COMPASS_CAL_ENABLED && (CONFIG_HAL_BOARD == HAL_BOARD_SITL || CONFIG_HAL_BOARD == HAL_BOARD_LINUX)
+#endif
+
 #ifndef AP_COMPASS_CALIBRATION_FIXED_YAW_ENABLED
 #define AP_COMPASS_CALIBRATION_FIXED_YAW_ENABLED AP_COMPASS_ENABLED && AP_GPS_ENABLED && AP_AHRS_ENABLED
 #endif
@@ -221,6 +221,31 @@ void CompassCalibrator::update()
     }
 }
 
+#if AP_COMPASS_CALIBRATION_THREAD_PER_COMPASS_ENABLED
+// start a thread that updates this calibrator. Like the shared calibration
+// thread it never exits, so a reboot is required after calibrating
+bool CompassCalibrator::start_thread(uint8_t compass_idx)
+{
+    if (_thread_started) {
+        return true;
+    }
+    hal.util->snprintf(_thread_name, sizeof(_thread_name), "compasscal%u", unsigned(compass_idx));
+    if (!hal.scheduler->thread_create(FUNCTOR_BIND_MEMBER(&CompassCalibrator::thread_main, void), _thread_name, 2048, AP_HAL::Scheduler::PRIORITY_IO, 0)) {
+        return false;
+    }
+    _thread_started = true;
+    return true;
+}
+
+void CompassCalibrator::thread_main()
+{
+    while (true) {
+        update();
+        hal.scheduler->delay(1);
+    }
+}
+#endif  // AP_COMPASS_CALIBRATION_THREAD_PER_COMPASS_ENABLED
+
 void CompassCalibrator::pull_sample()
 {
     CompassSample mag_sample;
@@ -467,6 +492,41 @@ bool CompassCalibrator::set_status(CompassCalibrator::Status status)
     };
 }
 
+// run the same sphere and ellipsoid fits as a calibration over the samples, without
+// thinning them between steps, and return the fitness
+float CompassCalibrator::fit_samples(const Vector3f *samples, uint16_t num_samples)
+{
+    reset_state();
+    if (_sample_buffer == nullptr) {
+        _sample_buffer = (CompassSample*)calloc(COMPASS_CAL_NUM_SAMPLES, sizeof(CompassSample));
+        if (_sample_buffer == nullptr) {
+            return _fitness;
+        }
+    }
+    _samples_collected = MIN(num_samples, uint16_t(COMPASS_CAL_NUM_SAMPLES));
+    for (uint16_t i = 0; i < _samples_collected; i++) {
+        _sample_buffer[i].set(samples[i]);
+    }
+
+    // step one. reset_state() started the fit before there were any samples, as happens
+    // when a calibration starts
+    calc_initial_offset();
+    for (uint8_t i = 0; i < 10; i++) {
+        run_sphere_fit();
+    }
+
+    // step two
+    initialize_fit();
+    for (uint8_t i = 0; i < 35; i++) {
+        if (i < 15) {
+            run_sphere_fit();
+        } else {
+            run_ellipsoid_fit();
+        }
+    }
+    return _fitness;
+}
+
 bool CompassCalibrator::fit_acceptable() const
 {
     if (!isnan(_fitness) &&
@@ -644,17 +704,23 @@ void CompassCalibrator::run_sphere_fit()
         float sphere_jacob[COMPASS_CAL_NUM_SPHERE_PARAMS];
 
         calc_sphere_jacob(sample, fit1_params, sphere_jacob);
+        const float residual = calc_residual(sample, fit1_params);
 
         for (uint8_t i = 0;i < COMPASS_CAL_NUM_SPHERE_PARAMS; i++) {
-            // compute JTJ
-            for (uint8_t j = 0; j < COMPASS_CAL_NUM_SPHERE_PARAMS; j++) {
+            // compute JTJ, which is symmetric so only the upper triangle is needed
+            for (uint8_t j = i; j < COMPASS_CAL_NUM_SPHERE_PARAMS; j++) {
                 JTJ[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j] += sphere_jacob[i] * sphere_jacob[j];
-                JTJ2[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j] += sphere_jacob[i] * sphere_jacob[j];   //a backup JTJ for LM
             }
             // compute JTFI
-            JTFI[i] += sphere_jacob[i] * calc_residual(sample, fit1_params);
+            JTFI[i] += sphere_jacob[i] * residual;
+        }
+    }
+    for (uint8_t i = 0; i < COMPASS_CAL_NUM_SPHERE_PARAMS; i++) {
+        for (uint8_t j = 0; j < i; j++) {
+            JTJ[i*COMPASS_CAL_NUM_SPHERE_PARAMS+j] = JTJ[j*COMPASS_CAL_NUM_SPHERE_PARAMS+i];
         }
     }
+    memcpy(JTJ2, JTJ, sizeof(JTJ2));    //a backup JTJ for LM
 
     //------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
     // refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -760,17 +826,23 @@ void CompassCalibrator::run_ellipsoid_fit()
         float ellipsoid_jacob[COMPASS_CAL_NUM_ELLIPSOID_PARAMS];
 
         calc_ellipsoid_jacob(sample, fit1_params, ellipsoid_jacob);
+        const float residual = calc_residual(sample, fit1_params);
 
         for (uint8_t i = 0;i < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; i++) {
-            // compute JTJ
-            for (uint8_t j = 0; j < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; j++) {
-                JTJ [i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] += ellipsoid_jacob[i] * ellipsoid_jacob[j];
-                JTJ2[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] += ellipsoid_jacob[i] * ellipsoid_jacob[j];
+            // compute JTJ, which is symmetric so only the upper triangle is needed
+            for (uint8_t j = i; j < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; j++) {
+                JTJ[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] += ellipsoid_jacob[i] * ellipsoid_jacob[j];
             }
             // compute JTFI
-            JTFI[i] += ellipsoid_jacob[i] * calc_residual(sample, fit1_params);
+            JTFI[i] += ellipsoid_jacob[i] * residual;
+        }
+    }
+    for (uint8_t i = 0; i < COMPASS_CAL_NUM_ELLIPSOID_PARAMS; i++) {
+        for (uint8_t j = 0; j < i; j++) {
+            JTJ[i*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+j] = JTJ[j*COMPASS_CAL_NUM_ELLIPSOID_PARAMS+i];
         }
     }
+    memcpy(JTJ2, JTJ, sizeof(JTJ2));
 
     //------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
     //refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -34,6 +34,11 @@ public:
     // update the state machine and calculate offsets, diagonals and offdiagonals
     void update();
 
+#if AP_COMPASS_CALIBRATION_THREAD_PER_COMPASS_ENABLED
+    // start a thread that calls update(). Returns false if the thread could not be created
+    bool start_thread(uint8_t compass_idx);
+#endif
+
     // compass calibration states
     enum class Status {
         NOT_STARTED = 0,
@@ -102,6 +107,11 @@ protected:
     // return true if this is a right angle rotation
     bool right_angle_rotation(Rotation r) const;
 
+    // run the same sphere and ellipsoid fits as a calibration over the samples, without
+    // thinning them between steps, and return the fitness
+    // protected so benchmark_calibrator can see it
+    float fit_samples(const Vector3f *samples, uint16_t num_samples);
+
 private:
 
     // results
@@ -209,6 +219,13 @@ private:
     // running method for use in thread
     bool _running() const;
 
+#if AP_COMPASS_CALIBRATION_THREAD_PER_COMPASS_ENABLED
+    // calls update() forever
+    void thread_main();
+    bool _thread_started;
+    char _thread_name[13];
+#endif
+
     uint8_t _compass_idx;                   // index of the compass providing data
     Status _status;                         // current state of calibrator
 
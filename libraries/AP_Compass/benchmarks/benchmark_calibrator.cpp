@@ -0,0 +1,74 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Compass/CompassCalibrator.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#if COMPASS_CAL_ENABLED
+
+// gives access to the fitting used by a calibration
+class CompassCalibratorBench : public CompassCalibrator {
+public:
+    using CompassCalibrator::fit_samples;
+};
+
+/*
+  sample sets like those collected while rotating a vehicle, with
+  the samples spread over the sphere, hard and soft iron errors and
+  some noise. The first is like an external compass, the others like
+  internal compasses close to the power wiring
+ */
+static const struct {
+    Vector3f offset;
+    Vector3f diag;
+    Vector3f offdiag;
+    float radius;
+    float noise;
+} sample_sets[] {
+    { { 30, -20, 15 },   { 1.0, 1.02, 0.98 },  { 0.01, -0.02, 0.01 }, 450, 2 },
+    { { 210, -150, 90 }, { 1.1, 0.95, 1.05 },  { 0.05, 0.03, -0.04 }, 380, 6 },
+    { { -320, 80, -260 },{ 0.9, 1.12, 1.01 },  { -0.06, 0.04, 0.07 }, 520, 8 },
+};
+
+static void make_samples(uint8_t set, Vector3f *samples, uint16_t count)
+{
+    const auto &s = sample_sets[set];
+    const Matrix3f softiron {
+        s.diag.x, s.offdiag.x, s.offdiag.y,
+        s.offdiag.x, s.diag.y, s.offdiag.z,
+        s.offdiag.y, s.offdiag.z, s.diag.z
+    };
+    Matrix3f distortion;
+    softiron.inverse(distortion);
+    uint32_t seed = 1 + set;
+    for (uint16_t i = 0; i < count; i++) {
+        // points on a spiral over the sphere
+        const float z = 1.0f - (2.0f * i + 1) / count;
+        const float r = sqrtf(1.0f - z * z);
+        const float angle = i * 2.39996323f;
+        Vector3f field = Vector3f(r * cosf(angle), r * sinf(angle), z) * s.radius;
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            seed = seed * 1103515245U + 12345U;
+            field[axis] += s.noise * ((((seed >> 8) & 0xFFFF) * (2.0f / 0xFFFF)) - 1.0f);
+        }
+        samples[i] = distortion * field - s.offset;
+    }
+}
+
+static void BM_CompassCalFit(benchmark::State& state)
+{
+    Vector3f samples[COMPASS_CAL_NUM_SAMPLES];
+    make_samples(state.range(0), samples, COMPASS_CAL_NUM_SAMPLES);
+    CompassCalibratorBench *cal = new CompassCalibratorBench();
+    while (state.KeepRunning()) {
+        float fitness = cal->fit_samples(samples, COMPASS_CAL_NUM_SAMPLES);
+        gbenchmark_escape(&fitness);
+    }
+    delete cal;
+}
+
+BENCHMARK(BM_CompassCalFit)->Arg(0)->Arg(1)->Arg(2);
+
+#endif  // COMPASS_CAL_ENABLED
+
+BENCHMARK_MAIN();
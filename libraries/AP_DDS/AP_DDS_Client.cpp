@@ -30,15 +30,20 @@
 
 // Enable DDS at runtime by default
 static constexpr uint8_t ENABLED_BY_DEFAULT = 1;
-static constexpr uint16_t DELAY_TIME_TOPIC_MS = 10;
-static constexpr uint16_t DELAY_BATTERY_STATE_TOPIC_MS = 1000;
-static constexpr uint16_t DELAY_IMU_TOPIC_MS = 5;
-static constexpr uint16_t DELAY_LOCAL_POSE_TOPIC_MS = 33;
-static constexpr uint16_t DELAY_LOCAL_VELOCITY_TOPIC_MS = 33;
-static constexpr uint16_t DELAY_GEO_POSE_TOPIC_MS = 33;
-static constexpr uint16_t DELAY_CLOCK_TOPIC_MS = 10;
-static constexpr uint16_t DELAY_GPS_GLOBAL_ORIGIN_TOPIC_MS = 1000;
+// default topic publishing rates, these match the rates given by the
+// previous fixed delays, which published once the delay was exceeded
+// (e.g. a 5ms delay gave a 6ms period)
+static constexpr uint16_t DEFAULT_TIME_TOPIC_HZ = 90;
+static constexpr uint16_t DEFAULT_BATTERY_STATE_TOPIC_HZ = 1;
+static constexpr uint16_t DEFAULT_IMU_TOPIC_HZ = 166;
+static constexpr uint16_t DEFAULT_LOCAL_POSE_TOPIC_HZ = 29;
+static constexpr uint16_t DEFAULT_LOCAL_VELOCITY_TOPIC_HZ = 29;
+static constexpr uint16_t DEFAULT_GEO_POSE_TOPIC_HZ = 29;
+static constexpr uint16_t DEFAULT_CLOCK_TOPIC_HZ = 90;
+static constexpr uint16_t DEFAULT_GPS_GLOBAL_ORIGIN_TOPIC_HZ = 1;
 static constexpr uint16_t DELAY_PING_MS = 500;
+// the session must run at least this often to keep up with pings
+static constexpr uint16_t MAX_BATCH_MS = 100;
 
 // Define the subscriber data members, which are static class scope.
 // If these are created on the stack in the subscriber,
@@ -74,6 +79,78 @@ const AP_Param::GroupInfo AP_DDS_Client::var_info[] {
 
 #endif
 
+    // @Param: _TIME_RATE
+    // @DisplayName: DDS time topic rate
+    // @Description: Rate at which the time topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 400
+    // @User: Advanced
+    AP_GROUPINFO("_TIME_RATE", 4, AP_DDS_Client, rates.time_hz, DEFAULT_TIME_TOPIC_HZ),
+
+    // @Param: _BATT_RATE
+    // @DisplayName: DDS battery state topic rate
+    // @Description: Rate at which the battery state topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 50
+    // @User: Advanced
+    AP_GROUPINFO("_BATT_RATE", 5, AP_DDS_Client, rates.battery_state_hz, DEFAULT_BATTERY_STATE_TOPIC_HZ),
+
+    // @Param: _IMU_RATE
+    // @DisplayName: DDS IMU topic rate
+    // @Description: Rate at which the IMU topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 1000
+    // @User: Advanced
+    AP_GROUPINFO("_IMU_RATE", 6, AP_DDS_Client, rates.imu_hz, DEFAULT_IMU_TOPIC_HZ),
+
+    // @Param: _POSE_RATE
+    // @DisplayName: DDS local pose topic rate
+    // @Description: Rate at which the local pose topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 400
+    // @User: Advanced
+    AP_GROUPINFO("_POSE_RATE", 7, AP_DDS_Client, rates.local_pose_hz, DEFAULT_LOCAL_POSE_TOPIC_HZ),
+
+    // @Param: _VEL_RATE
+    // @DisplayName: DDS local velocity topic rate
+    // @Description: Rate at which the local velocity topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 400
+    // @User: Advanced
+    AP_GROUPINFO("_VEL_RATE", 8, AP_DDS_Client, rates.local_velocity_hz, DEFAULT_LOCAL_VELOCITY_TOPIC_HZ),
+
+    // @Param: _GEOPOSE_RATE
+    // @DisplayName: DDS geographic pose topic rate
+    // @Description: Rate at which the geographic pose topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 400
+    // @User: Advanced
+    AP_GROUPINFO("_GEOPOSE_RATE", 9, AP_DDS_Client, rates.geo_pose_hz, DEFAULT_GEO_POSE_TOPIC_HZ),
+
+    // @Param: _CLOCK_RATE
+    // @DisplayName: DDS clock topic rate
+    // @Description: Rate at which the clock topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 400
+    // @User: Advanced
+    AP_GROUPINFO("_CLOCK_RATE", 10, AP_DDS_Client, rates.clock_hz, DEFAULT_CLOCK_TOPIC_HZ),
+
+    // @Param: _ORIGIN_RATE
+    // @DisplayName: DDS GPS global origin topic rate
+    // @Description: Rate at which the GPS global origin topic is published, 0 disables the topic
+    // @Units: Hz
+    // @Range: 0 50
+    // @User: Advanced
+    AP_GROUPINFO("_ORIGIN_RATE", 11, AP_DDS_Client, rates.gps_global_origin_hz, DEFAULT_GPS_GLOBAL_ORIGIN_TOPIC_HZ),
+
+    // @Param: _BATCH_MS
+    // @DisplayName: DDS output batching time
+    // @Description: Maximum time outgoing samples are held before the output stream is flushed. Samples written within this time are packed together into as few transport packets as possible, reducing the per-sample overhead at the cost of latency. Incoming topics and services are also processed at this interval. 0 flushes the output stream on every loop. High topic rates combined with long batching times may exceed the output stream buffer, in which case samples are dropped.
+    // @Units: ms
+    // @Range: 0 100
+    // @User: Advanced
+    AP_GROUPINFO("_BATCH_MS", 12, AP_DDS_Client, batch_ms, 0),
+
     AP_GROUPEND
 };
 
@@ -1073,14 +1150,30 @@ void AP_DDS_Client::write_gps_global_origin_topic()
     }
 }
 
+bool AP_DDS_Client::topic_due(const AP_Int16 &rate_hz, uint64_t &last_ms, const uint64_t now_ms)
+{
+    if (rate_hz <= 0) {
+        return false;
+    }
+    const uint32_t period_ms = MAX(1000U / uint16_t(rate_hz.get()), 1U);
+    if (now_ms - last_ms < period_ms) {
+        return false;
+    }
+    // keep the average rate, but don't try to catch up on missed periods
+    last_ms += period_ms;
+    if (now_ms - last_ms >= period_ms) {
+        last_ms = now_ms;
+    }
+    return true;
+}
+
 void AP_DDS_Client::update()
 {
     WITH_SEMAPHORE(csem);
     const auto cur_time_ms = AP_HAL::millis64();
 
-    if (cur_time_ms - last_time_time_ms > DELAY_TIME_TOPIC_MS) {
+    if (topic_due(rates.time_hz, last_time_time_ms, cur_time_ms)) {
         update_topic(time_topic);
-        last_time_time_ms = cur_time_ms;
         write_time_topic();
     }
 
@@ -1089,49 +1182,50 @@ void AP_DDS_Client::update()
         write_nav_sat_fix_topic();
     }
 
-    if (cur_time_ms - last_battery_state_time_ms > DELAY_BATTERY_STATE_TOPIC_MS) {
+    if (topic_due(rates.battery_state_hz, last_battery_state_time_ms, cur_time_ms)) {
         constexpr uint8_t battery_instance = 0;
         update_topic(battery_state_topic, battery_instance);
-        last_battery_state_time_ms = cur_time_ms;
         write_battery_state_topic();
     }
 
-    if (cur_time_ms - last_local_pose_time_ms > DELAY_LOCAL_POSE_TOPIC_MS) {
+    if (topic_due(rates.local_pose_hz, last_local_pose_time_ms, cur_time_ms)) {
         update_topic(local_pose_topic);
-        last_local_pose_time_ms = cur_time_ms;
         write_local_pose_topic();
     }
 
-    if (cur_time_ms - last_local_velocity_time_ms > DELAY_LOCAL_VELOCITY_TOPIC_MS) {
+    if (topic_due(rates.local_velocity_hz, last_local_velocity_time_ms, cur_time_ms)) {
         update_topic(tx_local_velocity_topic);
-        last_local_velocity_time_ms = cur_time_ms;
         write_tx_local_velocity_topic();
     }
 
-    if (cur_time_ms - last_imu_time_ms > DELAY_IMU_TOPIC_MS) {
+    if (topic_due(rates.imu_hz, last_imu_time_ms, cur_time_ms)) {
         update_topic(imu_topic);
-        last_imu_time_ms = cur_time_ms;
         write_imu_topic();
     }
 
-    if (cur_time_ms - last_geo_pose_time_ms > DELAY_GEO_POSE_TOPIC_MS) {
+    if (topic_due(rates.geo_pose_hz, last_geo_pose_time_ms, cur_time_ms)) {
         update_topic(geo_pose_topic);
-        last_geo_pose_time_ms = cur_time_ms;
         write_geo_pose_topic();
     }
 
-    if (cur_time_ms - last_clock_time_ms > DELAY_CLOCK_TOPIC_MS) {
+    if (topic_due(rates.clock_hz, last_clock_time_ms, cur_time_ms)) {
         update_topic(clock_topic);
-        last_clock_time_ms = cur_time_ms;
         write_clock_topic();
     }
 
-    if (cur_time_ms - last_gps_global_origin_time_ms > DELAY_GPS_GLOBAL_ORIGIN_TOPIC_MS) {
+    if (topic_due(rates.gps_global_origin_hz, last_gps_global_origin_time_ms, cur_time_ms)) {
         update_topic(gps_global_origin_topic);
-        last_gps_global_origin_time_ms = cur_time_ms;
         write_gps_global_origin_topic();
     }
 
+    // samples accumulate in the output stream until the session is
+    // run, so holding off lets several of them share one packet
+    const uint32_t flush_ms = constrain_int16(batch_ms, 0, MAX_BATCH_MS);
+    if (flush_ms > 0 && cur_time_ms - last_flush_ms < flush_ms) {
+        return;
+    }
+    last_flush_ms = cur_time_ms;
+
     status_ok = uxr_run_session_time(&session, 1);
 }
 
@@ -130,6 +130,26 @@ private:
     uint64_t last_clock_time_ms;
     // The last ms timestamp AP_DDS wrote a gps global origin message
     uint64_t last_gps_global_origin_time_ms;
+    // The last ms timestamp AP_DDS flushed the output stream
+    uint64_t last_flush_ms;
+
+    // topic publishing rates
+    struct {
+        AP_Int16 time_hz;
+        AP_Int16 battery_state_hz;
+        AP_Int16 imu_hz;
+        AP_Int16 local_pose_hz;
+        AP_Int16 local_velocity_hz;
+        AP_Int16 geo_pose_hz;
+        AP_Int16 clock_hz;
+        AP_Int16 gps_global_origin_hz;
+    } rates;
+
+    // maximum time to hold outgoing samples before flushing the output stream
+    AP_Int16 batch_ms;
+
+    // return true if a topic published at rate_hz is due, updating last_ms
+    static bool topic_due(const AP_Int16 &rate_hz, uint64_t &last_ms, const uint64_t now_ms);
 
     // functions for serial transport
     bool ddsSerialInit();
@@ -29,17 +29,35 @@
 #include <AP_Common/AP_Common.h>
 #include <AP_Math/AP_Math.h>
 
+uint16_t AP_Declination::last_cell = UINT16_MAX;
+
 /*
-  calculate magnetic field intensity and orientation
+  check if a position is in a table cell, without the divides needed to find its cell
 */
-bool AP_Declination::get_mag_field_ef(float latitude_deg, float longitude_deg, float &intensity_gauss, float &declination_deg, float &inclination_deg)
+bool AP_Declination::in_cell(uint16_t cell, float latitude_deg, float longitude_deg)
+{
+    if (cell == UINT16_MAX) {
+        return false;
+    }
+    const float min_lat = SAMPLING_MIN_LAT + (cell >> 8) * SAMPLING_RES;
+    const float min_lon = SAMPLING_MIN_LON + (cell & 0xFF) * SAMPLING_RES;
+
+    // positions on the lower bounds of the table are outside the valid input range
+    return latitude_deg > SAMPLING_MIN_LAT && latitude_deg >= min_lat && latitude_deg < min_lat + SAMPLING_RES &&
+           longitude_deg > SAMPLING_MIN_LON && longitude_deg >= min_lon && longitude_deg < min_lon + SAMPLING_RES;
+}
+
+/*
+  find the table cell for a position
+*/
+bool AP_Declination::find_cell(float latitude_deg, float longitude_deg, uint8_t &lat_index, uint8_t &lon_index, float &min_lat, float &min_lon)
 {
     bool valid_input_data = true;
 
     /* round down to nearest sampling resolution. On some platforms (e.g. clang on macOS),
         the behaviour of implicit casts from int32 to float can be undefined thus making it explicit here. */
-    float min_lat = float(static_cast<int32_t>(static_cast<int32_t>(floorf(latitude_deg / SAMPLING_RES)) * SAMPLING_RES));
-    float min_lon = float(static_cast<int32_t>(static_cast<int32_t>(floorf(longitude_deg / SAMPLING_RES)) * SAMPLING_RES));
+    min_lat = float(static_cast<int32_t>(static_cast<int32_t>(floorf(latitude_deg / SAMPLING_RES)) * SAMPLING_RES));
+    min_lon = float(static_cast<int32_t>(static_cast<int32_t>(floorf(longitude_deg / SAMPLING_RES)) * SAMPLING_RES));
 
     /* for the rare case of hitting the bounds exactly
      * the rounding logic wouldn't fit, so enforce it.
@@ -67,51 +85,93 @@ bool AP_Declination::get_mag_field_ef(float latitude_deg, float longitude_deg, f
     }
 
     /* find index of nearest low sampling point */
-    uint32_t min_lat_index = constrain_int32(static_cast<uint32_t>((-(SAMPLING_MIN_LAT) + min_lat)  / SAMPLING_RES), 0, LAT_TABLE_SIZE - 2);
-    uint32_t min_lon_index = constrain_int32(static_cast<uint32_t>((-(SAMPLING_MIN_LON) + min_lon) / SAMPLING_RES), 0, LON_TABLE_SIZE -2);
+    lat_index = constrain_int32(static_cast<uint32_t>((-(SAMPLING_MIN_LAT) + min_lat)  / SAMPLING_RES), 0, LAT_TABLE_SIZE - 2);
+    lon_index = constrain_int32(static_cast<uint32_t>((-(SAMPLING_MIN_LON) + min_lon) / SAMPLING_RES), 0, LON_TABLE_SIZE -2);
 
-    /* calculate intensity */
-
-    float data_sw = intensity_table[min_lat_index][min_lon_index];
-    float data_se = intensity_table[min_lat_index][min_lon_index + 1];
-    float data_ne = intensity_table[min_lat_index + 1][min_lon_index + 1];
-    float data_nw = intensity_table[min_lat_index + 1][min_lon_index];
-
-    /* perform bilinear interpolation on the four grid corners */
-
-    float data_min = ((longitude_deg - min_lon) / SAMPLING_RES) * (data_se - data_sw) + data_sw;
-    float data_max = ((longitude_deg - min_lon) / SAMPLING_RES) * (data_ne - data_nw) + data_nw;
-
-    intensity_gauss = ((latitude_deg - min_lat) / SAMPLING_RES) * (data_max - data_min) + data_min;
-
-    /* calculate declination */
-
-    data_sw = declination_table[min_lat_index][min_lon_index];
-    data_se = declination_table[min_lat_index][min_lon_index + 1];
-    data_ne = declination_table[min_lat_index + 1][min_lon_index + 1];
-    data_nw = declination_table[min_lat_index + 1][min_lon_index];
-
-    /* perform bilinear interpolation on the four grid corners */
-
-    data_min = ((longitude_deg - min_lon) / SAMPLING_RES) * (data_se - data_sw) + data_sw;
-    data_max = ((longitude_deg - min_lon) / SAMPLING_RES) * (data_ne - data_nw) + data_nw;
-
-    declination_deg = ((latitude_deg - min_lat) / SAMPLING_RES) * (data_max - data_min) + data_min;
+    return valid_input_data;
+}
 
-    /* calculate inclination */
+/*
+  bilinear interpolation of all three fields on the four grid corners of a cell
+*/
+void AP_Declination::interpolate(uint8_t lat_index, uint8_t lon_index, float min_lat, float min_lon,
+                                 float latitude_deg, float longitude_deg,
+                                 float &intensity_gauss, float &declination_deg, float &inclination_deg)
+{
+    const FieldSample &sw = field_table[lat_index][lon_index];
+    const FieldSample &se = field_table[lat_index][lon_index + 1];
+    const FieldSample &ne = field_table[lat_index + 1][lon_index + 1];
+    const FieldSample &nw = field_table[lat_index + 1][lon_index];
+
+    /* position within the cell, the same for all three fields */
+    const float lon_frac = (longitude_deg - min_lon) / SAMPLING_RES;
+    const float lat_frac = (latitude_deg - min_lat) / SAMPLING_RES;
+
+    float data_min = lon_frac * (se.intensity_gauss - sw.intensity_gauss) + sw.intensity_gauss;
+    float data_max = lon_frac * (ne.intensity_gauss - nw.intensity_gauss) + nw.intensity_gauss;
+    intensity_gauss = lat_frac * (data_max - data_min) + data_min;
+
+    data_min = lon_frac * (se.declination_deg - sw.declination_deg) + sw.declination_deg;
+    data_max = lon_frac * (ne.declination_deg - nw.declination_deg) + nw.declination_deg;
+    declination_deg = lat_frac * (data_max - data_min) + data_min;
+
+    data_min = lon_frac * (se.inclination_deg - sw.inclination_deg) + sw.inclination_deg;
+    data_max = lon_frac * (ne.inclination_deg - nw.inclination_deg) + nw.inclination_deg;
+    inclination_deg = lat_frac * (data_max - data_min) + data_min;
+}
 
-    data_sw = inclination_table[min_lat_index][min_lon_index];
-    data_se = inclination_table[min_lat_index][min_lon_index + 1];
-    data_ne = inclination_table[min_lat_index + 1][min_lon_index + 1];
-    data_nw = inclination_table[min_lat_index + 1][min_lon_index];
+/*
+  calculate magnetic field intensity and orientation
+*/
+bool AP_Declination::get_mag_field_ef(float latitude_deg, float longitude_deg, float &intensity_gauss, float &declination_deg, float &inclination_deg)
+{
+    // callers mostly ask for a position close to the last one, so
+    // check the last cell before searching the table
+    const uint16_t cell = last_cell;
+    if (in_cell(cell, latitude_deg, longitude_deg)) {
+        interpolate(cell >> 8, cell & 0xFF,
+                    SAMPLING_MIN_LAT + (cell >> 8) * SAMPLING_RES,
+                    SAMPLING_MIN_LON + (cell & 0xFF) * SAMPLING_RES,
+                    latitude_deg, longitude_deg, intensity_gauss, declination_deg, inclination_deg);
+        return true;
+    }
 
-    /* perform bilinear interpolation on the four grid corners */
+    uint8_t lat_index, lon_index;
+    float min_lat, min_lon;
+    const bool valid_input_data = find_cell(latitude_deg, longitude_deg, lat_index, lon_index, min_lat, min_lon);
+    if (valid_input_data) {
+        last_cell = (lat_index << 8) | lon_index;
+    }
 
-    data_min = ((longitude_deg - min_lon) / SAMPLING_RES) * (data_se - data_sw) + data_sw;
-    data_max = ((longitude_deg - min_lon) / SAMPLING_RES) * (data_ne - data_nw) + data_nw;
+    interpolate(lat_index, lon_index, min_lat, min_lon, latitude_deg, longitude_deg, intensity_gauss, declination_deg, inclination_deg);
 
-    inclination_deg = ((latitude_deg - min_lat) / SAMPLING_RES) * (data_max - data_min) + data_min;
+    return valid_input_data;
+}
 
+/*
+  calculate magnetic field intensity and orientation for a set of positions
+*/
+bool AP_Declination::get_mag_field_ef(const float *latitude_deg, const float *longitude_deg, uint16_t count,
+                                      float *intensity_gauss, float *declination_deg, float *inclination_deg)
+{
+    bool valid_input_data = true;
+    uint16_t cell = UINT16_MAX;
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t lat_index, lon_index;
+        float min_lat, min_lon;
+        if (in_cell(cell, latitude_deg[i], longitude_deg[i])) {
+            lat_index = cell >> 8;
+            lon_index = cell & 0xFF;
+            min_lat = SAMPLING_MIN_LAT + lat_index * SAMPLING_RES;
+            min_lon = SAMPLING_MIN_LON + lon_index * SAMPLING_RES;
+        } else if (find_cell(latitude_deg[i], longitude_deg[i], lat_index, lon_index, min_lat, min_lon)) {
+            cell = (lat_index << 8) | lon_index;
+        } else {
+            valid_input_data = false;
+        }
+        interpolate(lat_index, lon_index, min_lat, min_lon, latitude_deg[i], longitude_deg[i],
+                    intensity_gauss[i], declination_deg[i], inclination_deg[i]);
+    }
     return valid_input_data;
 }
 
@@ -27,7 +27,15 @@ public:
       get declination in degrees for a given latitude_deg and longitude_deg
      */
     static float get_declination(float latitude_deg, float longitude_deg);
-    
+
+    /*
+     * Calculates the magnetic intensity, declination and inclination for count positions, as
+     * get_mag_field_ef() above. Consecutive positions in the same table cell share the cell lookup.
+     * Boolean returns false if any position is outside the valid input range
+     */
+    static bool get_mag_field_ef(const float *latitude_deg, const float *longitude_deg, uint16_t count,
+                                 float *intensity_gauss, float *declination_deg, float *inclination_deg);
+
 private:
     static const float SAMPLING_RES;
     static const float SAMPLING_MIN_LAT;
@@ -38,7 +46,26 @@ private:
     static const uint32_t LAT_TABLE_SIZE = 19;
     static const uint32_t LON_TABLE_SIZE = 37;
 
-    static const float declination_table[LAT_TABLE_SIZE][LON_TABLE_SIZE];
-    static const float inclination_table[LAT_TABLE_SIZE][LON_TABLE_SIZE];
-    static const float intensity_table[LAT_TABLE_SIZE][LON_TABLE_SIZE];
+    // the field at one table sample, held together so interpolating a position reads four adjacent samples
+    struct FieldSample {
+        float declination_deg;
+        float inclination_deg;
+        float intensity_gauss;
+    };
+
+    static const FieldSample field_table[LAT_TABLE_SIZE][LON_TABLE_SIZE];
+
+    // table cell of the last position looked up, as lat_index<<8 | lon_index, or UINT16_MAX if none
+    static uint16_t last_cell;
+
+    // true if the position is inside the table range and in the cell given as lat_index<<8 | lon_index
+    static bool in_cell(uint16_t cell, float latitude_deg, float longitude_deg);
+
+    // find the table cell for a position, returns false if outside the valid input range
+    static bool find_cell(float latitude_deg, float longitude_deg, uint8_t &lat_index, uint8_t &lon_index, float &min_lat, float &min_lon);
+
+    // interpolate the field at a position in the cell with its south west corner at lat_index, lon_index and min_lat, min_lon degrees
+    static void interpolate(uint8_t lat_index, uint8_t lon_index, float min_lat, float min_lon,
+                            float latitude_deg, float longitude_deg,
+                            float &intensity_gauss, float &declination_deg, float &inclination_deg);
 };
@@ -0,0 +1,70 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Declination/AP_Declination.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+// a vehicle moving slowly, so every position is in the same table cell
+#define NUM_POSITIONS 100
+
+static float lat[NUM_POSITIONS];
+static float lon[NUM_POSITIONS];
+
+static void make_track(float lat_step, float lon_step)
+{
+    for (uint16_t i=0; i<NUM_POSITIONS; i++) {
+        lat[i] = -35.36f + i * lat_step;
+        lon[i] = 149.16f + i * lon_step;
+    }
+}
+
+static void BM_MagFieldSameCell(benchmark::State& state)
+{
+    make_track(0.001f, 0.001f);
+    float intensity, declination, inclination;
+    while (state.KeepRunning()) {
+        for (uint16_t i=0; i<NUM_POSITIONS; i++) {
+            AP_Declination::get_mag_field_ef(lat[i], lon[i], intensity, declination, inclination);
+            gbenchmark_escape(&intensity);
+        }
+    }
+}
+
+// positions spread over the globe, so each one needs the cell looked up
+static void BM_MagFieldNewCell(benchmark::State& state)
+{
+    make_track(1.1f, 3.3f);
+    float intensity, declination, inclination;
+    while (state.KeepRunning()) {
+        for (uint16_t i=0; i<NUM_POSITIONS; i++) {
+            AP_Declination::get_mag_field_ef(lat[i], lon[i], intensity, declination, inclination);
+            gbenchmark_escape(&intensity);
+        }
+    }
+}
+
+static void BM_MagFieldBatch(benchmark::State& state)
+{
+    make_track(0.001f, 0.001f);
+    float intensity[NUM_POSITIONS], declination[NUM_POSITIONS], inclination[NUM_POSITIONS];
+    while (state.KeepRunning()) {
+        AP_Declination::get_mag_field_ef(lat, lon, NUM_POSITIONS, intensity, declination, inclination);
+        gbenchmark_escape(intensity);
+    }
+}
+
+static void BM_EarthField(benchmark::State& state)
+{
+    Location loc(-353600000, 1491600000, 0, Location::AltFrame::ABSOLUTE);
+    while (state.KeepRunning()) {
+        Vector3f field = AP_Declination::get_earth_field_ga(loc);
+        gbenchmark_escape(&field);
+    }
+}
+
+BENCHMARK(BM_MagFieldSameCell);
+BENCHMARK(BM_MagFieldNewCell);
+BENCHMARK(BM_MagFieldBatch);
+BENCHMARK(BM_EarthField);
+
+BENCHMARK_MAIN();
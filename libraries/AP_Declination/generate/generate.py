@@ -22,14 +22,15 @@ if not Path("AP_Declination.h").is_file():
     raise OSError("Please run this tool from the AP_Declination directory")
 
 
-def write_table(f,name, table):
-    '''write one table'''
-    f.write("const float AP_Declination::%s[%u][%u] = {\n" %
-                (name, NUM_LAT, NUM_LON))
+def write_field_table(f):
+    '''write the table with the declination, inclination and intensity of each sample together'''
+    f.write("const AP_Declination::FieldSample AP_Declination::field_table[LAT_TABLE_SIZE][LON_TABLE_SIZE] = {\n")
     for i in range(NUM_LAT):
         f.write("    {")
         for j in range(NUM_LON):
-            f.write("%.5ff" % table[i][j])
+            f.write("{%.5ff,%.5ff,%.5ff}" % (declination_table[i][j],
+                                             inclination_table[i][j],
+                                             intensity_table[i][j]))
             if j != NUM_LON-1:
                 f.write(",")
         f.write("}")
@@ -177,9 +178,7 @@ const float AP_Declination::SAMPLING_MAX_LON = %u;
            SAMPLING_MAX_LON))
 
 
-    write_table(f,'declination_table', declination_table)
-    write_table(f,'inclination_table', inclination_table)
-    write_table(f,'intensity_table', intensity_table)
+    write_field_table(f)
 
 if args.check_error:
     print("Checking for maximum error")
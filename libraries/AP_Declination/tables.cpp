@@ -9,69 +9,25 @@ const float AP_Declination::SAMPLING_MAX_LAT = 90;
 const float AP_Declination::SAMPLING_MIN_LON = -180;
 const float AP_Declination::SAMPLING_MAX_LON = 180;
 
-const float AP_Declination::declination_table[LAT_TABLE_SIZE][LON_TABLE_SIZE] = {
-    {148.83402f,138.83401f,128.83401f,118.83402f,108.83402f,98.83402f,88.83402f,78.83402f,68.83402f,58.83402f,48.83402f,38.83402f,28.83402f,18.83402f,8.83402f,-1.16598f,-11.16598f,-21.16598f,-31.16598f,-41.16598f,-51.16598f,-61.16598f,-71.16598f,-81.16598f,-91.16598f,-101.16598f,-111.16598f,-121.16598f,-131.16598f,-141.16598f,-151.16598f,-161.16598f,-171.16598f,178.83402f,168.83402f,158.83402f,148.83402f},
-    {129.09306f,116.89412f,105.78898f,95.63017f,86.23504f,77.42476f,69.04348f,60.96591f,53.09841f,45.37592f,37.75568f,30.20867f,22.70998f,15.23027f,7.73037f,0.16098f,-7.53238f,-15.40109f,-23.48496f,-31.80703f,-40.37375f,-49.18062f,-58.22152f,-67.49946f,-77.03640f,-86.88079f,-97.11212f,-107.84156f,-119.20626f,-131.35191f,-144.39481f,-158.35719f,-173.08769f,171.78274f,156.78187f,142.43310f,129.09306f},
-    {85.81367f,77.83602f,71.40003f,65.88433f,60.88263f,56.08204f,51.22755f,46.12774f,40.67419f,34.85457f,28.74909f,22.50583f,16.29363f,10.23812f,4.36029f,-1.45095f,-7.40778f,-13.74178f,-20.61213f,-28.04922f,-35.95530f,-44.15322f,-52.45486f,-60.71951f,-68.88732f,-76.99183f,-85.16746f,-93.67473f,-102.97950f,-113.96429f,-128.46293f,-150.36073f,175.55488f,138.00554f,112.28051f,96.48319f,85.81367f},
-    {48.22805f,46.81921f,45.24300f,43.71189f,42.27245f,40.80022f,39.00177f,36.49549f,32.95972f,28.26545f,22.54379f,16.18846f,9.77818f,3.88971f,-1.16066f,-5.50500f,-9.68832f,-14.40052f,-20.13990f,-26.99385f,-34.63319f,-42.50584f,-50.08478f,-57.00760f,-63.07978f,-68.20773f,-72.30336f,-75.14845f,-76.14220f,-73.56875f,-61.46573f,-19.66028f,28.39616f,43.98783f,48.35027f,49.03265f,48.22805f},
-    {31.42931f,31.60530f,31.28145f,30.79047f,30.38024f,30.16777f,29.97487f,29.25597f,27.27948f,23.46202f,17.66378f,10.37176f,2.68673f,-4.06559f,-9.01317f,-12.19989f,-14.47861f,-17.04830f,-21.00672f,-26.83158f,-33.98769f,-41.32654f,-47.85214f,-52.97945f,-56.36644f,-57.72068f,-56.62201f,-52.29959f,-43.64045f,-30.08348f,-13.41611f,2.35315f,14.41455f,22.53506f,27.54777f,30.28028f,31.42931f},
-    {22.67985f,23.21169f,23.25494f,22.99742f,22.63545f,22.42369f,22.46877f,22.43187f,21.42571f,18.33186f,12.46440f,4.21692f,-4.75068f,-12.30560f,-17.22721f,-19.74039f,-20.77499f,-21.16946f,-22.14607f,-25.39336f,-31.01102f,-37.19196f,-42.26227f,-45.34969f,-45.95366f,-43.77299f,-38.67388f,-30.72261f,-20.87969f,-11.16390f,-2.84711f,4.17466f,10.15622f,15.07307f,18.83144f,21.33469f,22.67985f},
-    {17.07334f,17.59062f,17.77934f,17.69577f,17.34929f,16.88674f,16.56217f,16.38656f,15.63204f,12.86517f,6.93562f,-1.75751f,-10.98436f,-18.20308f,-22.41588f,-24.27993f,-24.67590f,-23.50719f,-21.00605f,-19.72369f,-21.87960f,-26.21214f,-30.23195f,-32.25069f,-31.49417f,-28.07385f,-22.58093f,-15.67611f,-8.73630f,-3.38117f,0.43868f,3.90117f,7.49078f,10.92679f,13.85484f,15.93237f,17.07334f},
-    {13.37426f,13.67217f,13.78744f,13.78998f,13.54222f,12.98780f,12.38852f,11.96065f,11.09372f,8.25499f,2.21162f,-6.34723f,-14.82596f,-20.89032f,-23.89434f,-24.45752f,-23.26867f,-20.14461f,-15.21492f,-10.62227f,-9.09952f,-11.18829f,-14.91638f,-17.58833f,-17.75073f,-15.65321f,-12.03643f,-7.38772f,-2.92537f,-0.15156f,1.30857f,3.04660f,5.56513f,8.30463f,10.76538f,12.51642f,13.37426f},
-    {11.10969f,11.11944f,11.01236f,10.99728f,10.84097f,10.32286f,9.70494f,9.19687f,8.09157f,4.94277f,-1.12864f,-9.05484f,-16.32980f,-21.04376f,-22.55109f,-21.19496f,-17.89373f,-13.44411f,-8.58084f,-4.24867f,-1.62827f,-1.86509f,-4.55045f,-7.42469f,-8.64775f,-8.12536f,-6.32716f,-3.48850f,-0.64489f,0.72027f,0.97976f,1.90952f,4.01623f,6.51266f,8.80749f,10.44185f,11.10969f},
-    {9.88349f,9.72040f,9.41289f,9.38439f,9.33291f,8.89921f,8.31537f,7.68011f,6.17272f,2.60695f,-3.33977f,-10.37899f,-16.38823f,-19.72660f,-19.70115f,-16.80477f,-12.41185f,-7.91607f,-4.15177f,-1.10381f,1.22204f,1.82879f,0.23517f,-2.13784f,-3.62813f,-3.94630f,-3.34494f,-1.85961f,-0.22644f,0.26762f,-0.08803f,0.44077f,2.38763f,4.89878f,7.32401f,9.15291f,9.88349f},
-    {9.12464f,9.18177f,8.94457f,9.04553f,9.19618f,8.89744f,8.21223f,7.14260f,4.96349f,0.86055f,-4.97931f,-11.14357f,-15.85640f,-17.78532f,-16.57645f,-13.08478f,-8.67898f,-4.59243f,-1.60427f,0.55144f,2.39028f,3.23916f,2.31654f,0.46434f,-0.91732f,-1.53003f,-1.62589f,-1.18564f,-0.62403f,-0.86624f,-1.66562f,-1.50145f,0.21812f,2.79294f,5.56329f,7.91823f,9.12464f},
-    {8.06290f,8.93172f,9.29767f,9.81684f,10.30693f,10.20311f,9.30721f,7.53634f,4.41412f,-0.45099f,-6.41113f,-11.85029f,-15.25565f,-15.88209f,-13.96742f,-10.49677f,-6.46933f,-2.75504f,-0.08743f,1.66921f,3.12874f,3.96903f,3.45981f,2.05876f,0.88578f,0.20951f,-0.29117f,-0.68669f,-1.18101f,-2.27487f,-3.63054f,-3.95562f,-2.62221f,-0.08793f,3.01927f,6.01454f,8.06290f},
-    {6.31041f,8.41617f,9.93058f,11.21483f,12.13996f,12.23034f,11.14011f,8.66524f,4.49928f,-1.34733f,-7.71989f,-12.71272f,-15.08305f,-14.75641f,-12.45343f,-9.09705f,-5.35725f,-1.83470f,0.82823f,2.57001f,3.86519f,4.69588f,4.60243f,3.76104f,2.87601f,2.13967f,1.24833f,0.02788f,-1.62859f,-3.80231f,-5.90990f,-6.79346f,-5.87079f,-3.45535f,-0.15720f,3.34006f,6.31041f},
-    {4.26294f,7.59975f,10.43666f,12.70491f,14.16020f,14.43398f,13.18770f,10.10768f,4.90586f,-2.08386f,-9.15208f,-14.09196f,-15.93051f,-15.08268f,-12.51517f,-9.09089f,-5.35759f,-1.77919f,1.14514f,3.24292f,4.77489f,5.90082f,6.46683f,6.42854f,5.95440f,5.04613f,3.49019f,1.14215f,-1.96091f,-5.46021f,-8.43365f,-9.79880f,-9.13330f,-6.77311f,-3.34752f,0.50970f,4.26294f},
-    {2.57464f,6.81988f,10.72127f,13.95370f,16.10049f,16.72460f,15.39548f,11.64478f,5.15172f,-3.36781f,-11.49173f,-16.72206f,-18.40831f,-17.31430f,-14.50140f,-10.79977f,-6.74992f,-2.76545f,0.78143f,3.70100f,6.08013f,8.07892f,9.67963f,10.67456f,10.77058f,9.65347f,7.07600f,3.02043f,-2.09809f,-7.27683f,-11.16806f,-12.81861f,-12.13043f,-9.62141f,-5.97603f,-1.77704f,2.57464f},
-    {1.43503f,6.27921f,10.88019f,14.88261f,17.80063f,19.02158f,17.77297f,13.12636f,4.53718f,-6.54055f,-16.27050f,-21.85552f,-23.31365f,-21.85455f,-18.61101f,-14.36797f,-9.64057f,-4.79964f,-0.13239f,4.18385f,8.10605f,11.64519f,14.70734f,16.97990f,17.92977f,16.88820f,13.23164f,6.81146f,-1.34665f,-8.97876f,-14.01257f,-15.81005f,-14.85926f,-12.00033f,-7.99733f,-3.40265f,1.43502f},
-    {0.13094f,5.45479f,10.54962f,15.08235f,18.55436f,20.17754f,18.67574f,12.20150f,-0.36226f,-15.49225f,-26.46004f,-31.19380f,-31.33251f,-28.66356f,-24.33699f,-19.03627f,-13.18344f,-7.06335f,-0.88475f,5.19490f,11.05071f,16.55252f,21.50321f,25.56424f,28.16988f,28.41286f,24.95220f,16.43585f,3.63861f,-8.67079f,-16.18909f,-18.69045f,-17.68753f,-14.54612f,-10.18137f,-5.16795f,0.13094f},
-    {-4.14830f,1.12345f,5.96040f,9.84415f,11.94596f,10.80871f,4.02869f,-10.36405f,-27.94912f,-39.79617f,-44.16477f,-43.57950f,-40.12657f,-34.99189f,-28.83083f,-22.02403f,-14.80922f,-7.34799f,0.23881f,7.85050f,15.39197f,22.75942f,29.82156f,36.38924f,42.15868f,46.59144f,48.63821f,46.09967f,34.72041f,12.13936f,-8.98865f,-18.65098f,-20.47841f,-18.40133f,-14.39834f,-9.45818f,-4.14830f},
-    {-169.79948f,-159.79948f,-149.79948f,-139.79948f,-129.79948f,-119.79948f,-109.79948f,-99.79948f,-89.79948f,-79.79948f,-69.79948f,-59.79948f,-49.79948f,-39.79948f,-29.79948f,-19.79948f,-9.79948f,0.20052f,10.20052f,20.20052f,30.20052f,40.20052f,50.20052f,60.20052f,70.20052f,80.20052f,90.20052f,100.20052f,110.20052f,120.20052f,130.20052f,140.20052f,150.20052f,160.20052f,170.20052f,-179.79948f,-169.79948f}
-};
-
-const float AP_Declination::inclination_table[LAT_TABLE_SIZE][LON_TABLE_SIZE] = {
-    {-72.02070f,-72.02071f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02070f,-72.02071f,-72.02070f,-72.02071f},
-    {-78.23208f,-77.46612f,-76.54604f,-75.51344f,-74.40408f,-73.25043f,-72.08420f,-70.93779f,-69.84384f,-68.83332f,-67.93241f,-67.15960f,-66.52407f,-66.02648f,-65.66205f,-65.42519f,-65.31392f,-65.33255f,-65.49161f,-65.80511f,-66.28626f,-66.94289f,-67.77395f,-68.76776f,-69.90201f,-71.14489f,-72.45664f,-73.79090f,-75.09549f,-76.31306f,-77.38240f,-78.24183f,-78.83644f,-79.12876f,-79.10879f,-78.79618f,-78.23208f},
-    {-80.80007f,-78.97830f,-77.14756f,-75.29021f,-73.38193f,-71.40769f,-69.37743f,-67.33857f,-65.37896f,-63.61481f,-62.16302f,-61.10460f,-60.45316f,-60.14557f,-60.06470f,-60.08698f,-60.13217f,-60.19219f,-60.32958f,-60.65151f,-61.27183f,-62.27481f,-63.69257f,-65.50302f,-67.64474f,-70.03800f,-72.60073f,-75.25455f,-77.92173f,-80.51496f,-82.91263f,-84.88736f,-85.95658f,-85.63251f,-84.30522f,-82.60297f,-80.80007f},
-    {-77.45516f,-75.43606f,-73.49604f,-71.57699f,-69.59653f,-67.45749f,-65.08505f,-62.48902f,-59.81600f,-57.35291f,-55.46368f,-54.46054f,-54.44855f,-55.23685f,-56.40404f,-57.49090f,-58.18917f,-58.42457f,-58.34278f,-58.24952f,-58.51231f,-59.42525f,-61.10217f,-63.46936f,-66.34503f,-69.53469f,-72.88656f,-76.29320f,-79.66218f,-82.88130f,-85.73520f,-87.38955f,-86.36194f,-84.15583f,-81.83294f,-79.58616f,-77.45517f},
-    {-71.58214f,-69.61565f,-67.71488f,-65.86479f,-64.01505f,-62.04510f,-59.77482f,-57.07400f,-54.02405f,-51.03212f,-48.80491f,-48.09823f,-49.26412f,-51.92460f,-55.16562f,-58.07793f,-60.10267f,-61.01513f,-60.84749f,-59.97822f,-59.15799f,-59.18575f,-60.45940f,-62.86069f,-65.97595f,-69.36736f,-72.71868f,-75.80268f,-78.35851f,-80.06262f,-80.67983f,-80.25871f,-79.08901f,-77.46953f,-75.59576f,-73.59787f,-71.58215f},
-    {-64.39807f,-62.40221f,-60.40960f,-58.42549f,-56.48151f,-54.55795f,-52.49863f,-50.03954f,-47.03044f,-43.80319f,-41.39118f,-41.16169f,-43.78688f,-48.51954f,-53.83971f,-58.60413f,-62.35170f,-64.81766f,-65.60605f,-64.62579f,-62.64650f,-61.08659f,-61.05364f,-62.68316f,-65.34905f,-68.24163f,-70.78236f,-72.62117f,-73.51797f,-73.52965f,-73.02048f,-72.24528f,-71.21594f,-69.88980f,-68.25886f,-66.38361f,-64.39807f},
-    {-55.02826f,-52.87120f,-50.69073f,-48.44731f,-46.19513f,-44.04849f,-42.00465f,-39.74123f,-36.79801f,-33.33110f,-30.77621f,-31.26765f,-35.68330f,-42.58861f,-49.78570f,-56.05256f,-61.22645f,-65.24992f,-67.52021f,-67.43115f,-65.26549f,-62.35447f,-60.45735f,-60.49007f,-61.96843f,-63.81210f,-65.26064f,-65.90429f,-65.53604f,-64.51130f,-63.52424f,-62.77292f,-61.94296f,-60.76846f,-59.16172f,-57.17787f,-55.02826f},
-    {-42.23934f,-39.72248f,-37.30606f,-34.84704f,-32.29950f,-29.84715f,-27.62882f,-25.25073f,-22.02346f,-18.13398f,-15.56621f,-17.09131f,-23.52381f,-32.78684f,-42.11183f,-49.91489f,-55.93881f,-60.34177f,-62.85919f,-63.04596f,-60.93631f,-57.41244f,-54.21948f,-52.82417f,-53.10885f,-54.02972f,-54.81946f,-54.92826f,-53.94911f,-52.38029f,-51.27875f,-50.79557f,-50.20937f,-49.05107f,-47.23568f,-44.84941f,-42.23934f},
-    {-25.31616f,-22.26353f,-19.64432f,-17.13765f,-14.48794f,-11.90452f,-9.56551f,-6.93532f,-3.35246f,0.62534f,2.69744f,0.20162f,-7.49683f,-18.49333f,-29.80260f,-38.99555f,-45.22087f,-48.81124f,-50.28975f,-49.88122f,-47.49942f,-43.57896f,-39.80201f,-37.81589f,-37.58213f,-38.12733f,-38.79073f,-38.91636f,-37.84560f,-36.15384f,-35.28930f,-35.35164f,-35.11620f,-33.90633f,-31.71407f,-28.67497f,-25.31616f},
-    {-5.22365f,-1.68002f,0.98130f,3.28459f,5.73141f,8.13291f,10.33797f,12.92226f,16.28019f,19.52644f,20.64919f,17.75076f,10.26968f,-0.68527f,-12.39654f,-21.81573f,-27.55757f,-29.98547f,-30.24089f,-29.18412f,-26.62224f,-22.51726f,-18.50023f,-16.36665f,-16.02599f,-16.47452f,-17.18522f,-17.56335f,-16.82114f,-15.49276f,-15.21405f,-16.04947f,-16.38744f,-15.33409f,-12.92178f,-9.31548f,-5.22365f},
-    {14.65727f,18.24457f,20.73560f,22.68750f,24.74090f,26.83478f,28.82717f,31.06453f,33.64927f,35.73650f,35.91607f,33.06931f,26.82267f,17.82545f,8.14938f,0.35249f,-4.22224f,-5.65846f,-5.08244f,-3.67265f,-1.30171f,2.36894f,6.00997f,7.96495f,8.31670f,8.01335f,7.45026f,6.96852f,7.19717f,7.76654f,7.31456f,5.77666f,4.68883f,5.07867f,7.05547f,10.50432f,14.65727f},
-    {31.00203f,34.03206f,36.22486f,37.93041f,39.71929f,41.67672f,43.64451f,45.63057f,47.51149f,48.64179f,48.13476f,45.46014f,40.64785f,34.34474f,27.90343f,22.77471f,19.78522f,19.08118f,19.96093f,21.39191f,23.28877f,25.96005f,28.61507f,30.09860f,30.42073f,30.29938f,30.04062f,29.74069f,29.65970f,29.53545f,28.53162f,26.62276f,24.91817f,24.37385f,25.31100f,27.72542f,31.00203f},
-    {43.33608f,45.45851f,47.28808f,48.92364f,50.69187f,52.68920f,54.75852f,56.70372f,58.24993f,58.87748f,58.03709f,55.61656f,52.01961f,47.93440f,44.13769f,41.24459f,39.61639f,39.39065f,40.22833f,41.47069f,42.89022f,44.59331f,46.23881f,47.24171f,47.57154f,47.63935f,47.66249f,47.62919f,47.50096f,47.00810f,45.71114f,43.68014f,41.65440f,40.38784f,40.27252f,41.37670f,43.33608f},
-    {53.10131f,54.36161f,55.82606f,57.45873f,59.32146f,61.39014f,63.50628f,65.43734f,66.85905f,67.31408f,66.44780f,64.38450f,61.68268f,58.96721f,56.68844f,55.08044f,54.25566f,54.24982f,54.89128f,55.82780f,56.83438f,57.87845f,58.85920f,59.59271f,60.06042f,60.40887f,60.71534f,60.90716f,60.81057f,60.15911f,58.74748f,56.73559f,54.64618f,53.02448f,52.20550f,52.28132f,53.10131f},
-    {61.90363f,62.59082f,63.73000f,65.25974f,67.10373f,69.13404f,71.16923f,72.97878f,74.24745f,74.58969f,73.79370f,72.08739f,69.99806f,68.01780f,66.44167f,65.38391f,64.86230f,64.84287f,65.21557f,65.80372f,66.46017f,67.12970f,67.80720f,68.49179f,69.18909f,69.89166f,70.52514f,70.92481f,70.86509f,70.14456f,68.73300f,66.86155f,64.92449f,63.29260f,62.20331f,61.74779f,61.90363f},
-    {70.57319f,70.97549f,71.81891f,73.05700f,74.60513f,76.33503f,78.07584f,79.60158f,80.60606f,80.76720f,79.99878f,78.58008f,76.92858f,75.37566f,74.11340f,73.22087f,72.70518f,72.52979f,72.62677f,72.91213f,73.31657f,73.81370f,74.42101f,75.17239f,76.07666f,77.07532f,78.01176f,78.63384f,78.66938f,77.98598f,76.70086f,75.10445f,73.50638f,72.14451f,71.16426f,70.63412f,70.57319f},
-    {78.82351f,79.06440f,79.60559f,80.41612f,81.44382f,82.60991f,83.79747f,84.82323f,85.41014f,85.29919f,84.52961f,83.39228f,82.15604f,80.99185f,79.99787f,79.22370f,78.68527f,78.37555f,78.27394f,78.35635f,78.60546f,79.01788f,79.60326f,80.37283f,81.31875f,82.38760f,83.44917f,84.26774f,84.54142f,84.12292f,83.18704f,82.03917f,80.91872f,79.97342f,79.28584f,78.89722f,78.82351f},
-    {85.92404f,85.99807f,86.21370f,86.55320f,86.98729f,87.46743f,87.90712f,88.15645f,88.05609f,87.61718f,86.98684f,86.28678f,85.58976f,84.94098f,84.37090f,83.90045f,83.54357f,83.30879f,83.20077f,83.22179f,83.37274f,83.65354f,84.06234f,84.59369f,85.23581f,85.96691f,86.74942f,87.51716f,88.14109f,88.39226f,88.15089f,87.63861f,87.08412f,86.59723f,86.22810f,86.00055f,85.92404f},
-    {88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f,88.21420f}
-};
-
-const float AP_Declination::intensity_table[LAT_TABLE_SIZE][LON_TABLE_SIZE] = {
-    {0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f,0.54507f},
-    {0.60562f,0.59923f,0.59133f,0.58213f,0.57184f,0.56070f,0.54892f,0.53679f,0.52458f,0.51262f,0.50121f,0.49067f,0.48128f,0.47330f,0.46697f,0.46249f,0.46006f,0.45986f,0.46203f,0.46665f,0.47372f,0.48312f,0.49460f,0.50778f,0.52217f,0.53717f,0.55217f,0.56652f,0.57964f,0.59102f,0.60027f,0.60715f,0.61152f,0.61342f,0.61294f,0.61026f,0.60562f},
-    {0.62993f,0.61663f,0.60163f,0.58513f,0.56721f,0.54792f,0.52741f,0.50597f,0.48417f,0.46274f,0.44252f,0.42424f,0.40840f,0.39524f,0.38483f,0.37722f,0.37262f,0.37149f,0.37444f,0.38211f,0.39496f,0.41303f,0.43591f,0.46271f,0.49220f,0.52288f,0.55321f,0.58160f,0.60660f,0.62705f,0.64217f,0.65166f,0.65569f,0.65477f,0.64966f,0.64113f,0.62993f},
-    {0.61859f,0.59954f,0.57951f,0.55859f,0.53652f,0.51281f,0.48703f,0.45921f,0.43010f,0.40125f,0.37460f,0.35184f,0.33383f,0.32034f,0.31043f,0.30313f,0.29816f,0.29624f,0.29887f,0.30789f,0.32478f,0.35003f,0.38290f,0.42162f,0.46385f,0.50716f,0.54918f,0.58755f,0.62009f,0.64502f,0.66138f,0.66918f,0.66921f,0.66276f,0.65127f,0.63614f,0.61859f},
-    {0.58434f,0.56134f,0.53820f,0.51511f,0.49174f,0.46715f,0.44010f,0.40984f,0.37699f,0.34382f,0.31364f,0.28967f,0.27359f,0.26453f,0.25966f,0.25610f,0.25262f,0.24997f,0.25053f,0.25779f,0.27518f,0.30435f,0.34417f,0.39141f,0.44206f,0.49253f,0.54000f,0.58194f,0.61593f,0.64015f,0.65395f,0.65794f,0.65353f,0.64245f,0.62626f,0.60641f,0.58434f},
-    {0.53921f,0.51448f,0.48995f,0.46595f,0.44250f,0.41888f,0.39359f,0.36521f,0.33366f,0.30097f,0.27115f,0.24895f,0.23726f,0.23477f,0.23677f,0.23885f,0.23920f,0.23803f,0.23691f,0.23986f,0.25296f,0.28060f,0.32245f,0.37391f,0.42855f,0.48085f,0.52753f,0.56643f,0.59562f,0.61429f,0.62316f,0.62341f,0.61626f,0.60311f,0.58508f,0.56327f,0.53921f},
-    {0.48785f,0.46379f,0.43988f,0.41636f,0.39367f,0.37182f,0.34998f,0.32674f,0.30099f,0.27346f,0.24780f,0.22959f,0.22251f,0.22507f,0.23198f,0.23916f,0.24558f,0.25057f,0.25278f,0.25389f,0.26060f,0.28058f,0.31692f,0.36595f,0.41928f,0.46891f,0.51065f,0.54231f,0.56238f,0.57214f,0.57493f,0.57236f,0.56426f,0.55095f,0.53309f,0.51149f,0.48785f},
-    {0.43209f,0.41089f,0.38995f,0.36941f,0.34979f,0.33155f,0.31470f,0.29826f,0.28044f,0.26067f,0.24164f,0.22828f,0.22418f,0.22862f,0.23770f,0.24867f,0.26122f,0.27397f,0.28296f,0.28650f,0.28895f,0.29863f,0.32271f,0.36133f,0.40653f,0.44908f,0.48374f,0.50731f,0.51774f,0.51826f,0.51530f,0.51075f,0.50252f,0.48985f,0.47321f,0.45336f,0.43209f},
-    {0.37890f,0.36283f,0.34739f,0.33271f,0.31922f,0.30724f,0.29696f,0.28780f,0.27809f,0.26658f,0.25432f,0.24439f,0.23994f,0.24247f,0.25117f,0.26398f,0.27930f,0.29517f,0.30771f,0.31403f,0.31546f,0.31823f,0.33068f,0.35590f,0.38846f,0.42051f,0.44683f,0.46322f,0.46680f,0.46142f,0.45465f,0.44832f,0.43950f,0.42721f,0.41228f,0.39568f,0.37890f},
-    {0.34114f,0.33192f,0.32348f,0.31616f,0.31061f,0.30672f,0.30410f,0.30225f,0.29980f,0.29492f,0.28700f,0.27755f,0.26956f,0.26653f,0.27083f,0.28123f,0.29446f,0.30791f,0.31935f,0.32678f,0.32987f,0.33216f,0.33985f,0.35562f,0.37648f,0.39779f,0.41572f,0.42632f,0.42691f,0.42012f,0.41134f,0.40209f,0.39087f,0.37775f,0.36429f,0.35181f,0.34114f},
-    {0.32818f,0.32516f,0.32319f,0.32283f,0.32517f,0.32980f,0.33535f,0.34062f,0.34397f,0.34296f,0.33615f,0.32475f,0.31211f,0.30265f,0.30010f,0.30443f,0.31265f,0.32241f,0.33228f,0.34067f,0.34700f,0.35327f,0.36224f,0.37416f,0.38773f,0.40158f,0.41356f,0.42060f,0.42076f,0.41455f,0.40362f,0.38928f,0.37303f,0.35700f,0.34334f,0.33369f,0.32818f},
-    {0.33981f,0.34000f,0.34266f,0.34809f,0.35721f,0.36937f,0.38240f,0.39400f,0.40180f,0.40293f,0.39568f,0.38157f,0.36502f,0.35110f,0.34343f,0.34233f,0.34605f,0.35337f,0.36304f,0.37282f,0.38187f,0.39163f,0.40273f,0.41394f,0.42487f,0.43601f,0.44625f,0.45294f,0.45399f,0.44803f,0.43420f,0.41393f,0.39124f,0.37028f,0.35389f,0.34377f,0.33981f},
-    {0.37236f,0.37289f,0.37826f,0.38816f,0.40237f,0.41956f,0.43724f,0.45274f,0.46333f,0.46592f,0.45864f,0.44316f,0.42447f,0.40808f,0.39741f,0.39283f,0.39339f,0.39860f,0.40735f,0.41725f,0.42701f,0.43745f,0.44902f,0.46095f,0.47308f,0.48570f,0.49764f,0.50631f,0.50895f,0.50305f,0.48719f,0.46316f,0.43591f,0.41060f,0.39068f,0.37789f,0.37236f},
-    {0.42245f,0.42215f,0.42846f,0.44064f,0.45724f,0.47601f,0.49435f,0.50993f,0.52038f,0.52304f,0.51631f,0.50148f,0.48288f,0.46550f,0.45264f,0.44515f,0.44269f,0.44488f,0.45083f,0.45875f,0.46742f,0.47714f,0.48867f,0.50225f,0.51759f,0.53373f,0.54863f,0.55948f,0.56339f,0.55795f,0.54232f,0.51859f,0.49131f,0.46537f,0.44426f,0.42977f,0.42245f},
-    {0.48319f,0.48226f,0.48758f,0.49842f,0.51308f,0.52913f,0.54416f,0.55622f,0.56358f,0.56459f,0.55836f,0.54575f,0.52954f,0.51323f,0.49956f,0.48985f,0.48445f,0.48324f,0.48569f,0.49085f,0.49796f,0.50710f,0.51894f,0.53390f,0.55144f,0.56981f,0.58634f,0.59810f,0.60259f,0.59827f,0.58527f,0.56571f,0.54318f,0.52144f,0.50331f,0.49032f,0.48319f},
-    {0.53929f,0.53799f,0.54070f,0.54691f,0.55552f,0.56497f,0.57363f,0.58010f,0.58328f,0.58236f,0.57702f,0.56775f,0.55586f,0.54317f,0.53137f,0.52173f,0.51505f,0.51167f,0.51159f,0.51458f,0.52039f,0.52900f,0.54059f,0.55506f,0.57159f,0.58845f,0.60334f,0.61392f,0.61846f,0.61626f,0.60790f,0.59512f,0.58032f,0.56589f,0.55363f,0.54459f,0.53929f},
-    {0.57278f,0.57090f,0.57068f,0.57187f,0.57403f,0.57656f,0.57878f,0.58007f,0.57991f,0.57795f,0.57409f,0.56849f,0.56162f,0.55414f,0.54681f,0.54040f,0.53554f,0.53271f,0.53223f,0.53423f,0.53873f,0.54564f,0.55475f,0.56559f,0.57735f,0.58891f,0.59900f,0.60643f,0.61040f,0.61066f,0.60758f,0.60203f,0.59514f,0.58801f,0.58156f,0.57637f,0.57278f},
-    {0.57900f,0.57728f,0.57584f,0.57463f,0.57360f,0.57263f,0.57160f,0.57039f,0.56890f,0.56707f,0.56489f,0.56241f,0.55976f,0.55710f,0.55465f,0.55263f,0.55127f,0.55074f,0.55121f,0.55273f,0.55530f,0.55883f,0.56314f,0.56798f,0.57300f,0.57785f,0.58216f,0.58562f,0.58802f,0.58928f,0.58943f,0.58865f,0.58716f,0.58523f,0.58309f,0.58097f,0.57900f},
-    {0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f,0.56830f}
+const AP_Declination::FieldSample AP_Declination::field_table[LAT_TABLE_SIZE][LON_TABLE_SIZE] = {
+    {{148.83402f,-72.02070f,0.54507f},{138.83401f,-72.02071f,0.54507f},{128.83401f,-72.02070f,0.54507f},{118.83402f,-72.02070f,0.54507f},{108.83402f,-72.02070f,0.54507f},{98.83402f,-72.02070f,0.54507f},{88.83402f,-72.02070f,0.54507f},{78.83402f,-72.02070f,0.54507f},{68.83402f,-72.02070f,0.54507f},{58.83402f,-72.02070f,0.54507f},{48.83402f,-72.02070f,0.54507f},{38.83402f,-72.02070f,0.54507f},{28.83402f,-72.02070f,0.54507f},{18.83402f,-72.02070f,0.54507f},{8.83402f,-72.02070f,0.54507f},{-1.16598f,-72.02070f,0.54507f},{-11.16598f,-72.02070f,0.54507f},{-21.16598f,-72.02070f,0.54507f},{-31.16598f,-72.02070f,0.54507f},{-41.16598f,-72.02070f,0.54507f},{-51.16598f,-72.02070f,0.54507f},{-61.16598f,-72.02070f,0.54507f},{-71.16598f,-72.02070f,0.54507f},{-81.16598f,-72.02070f,0.54507f},{-91.16598f,-72.02070f,0.54507f},{-101.16598f,-72.02070f,0.54507f},{-111.16598f,-72.02070f,0.54507f},{-121.16598f,-72.02070f,0.54507f},{-131.16598f,-72.02070f,0.54507f},{-141.16598f,-72.02070f,0.54507f},{-151.16598f,-72.02070f,0.54507f},{-161.16598f,-72.02070f,0.54507f},{-171.16598f,-72.02070f,0.54507f},{178.83402f,-72.02070f,0.54507f},{168.83402f,-72.02071f,0.54507f},{158.83402f,-72.02070f,0.54507f},{148.83402f,-72.02071f,0.54507f}},
+    {{129.09306f,-78.23208f,0.60562f},{116.89412f,-77.46612f,0.59923f},{105.78898f,-76.54604f,0.59133f},{95.63017f,-75.51344f,0.58213f},{86.23504f,-74.40408f,0.57184f},{77.42476f,-73.25043f,0.56070f},{69.04348f,-72.08420f,0.54892f},{60.96591f,-70.93779f,0.53679f},{53.09841f,-69.84384f,0.52458f},{45.37592f,-68.83332f,0.51262f},{37.75568f,-67.93241f,0.50121f},{30.20867f,-67.15960f,0.49067f},{22.70998f,-66.52407f,0.48128f},{15.23027f,-66.02648f,0.47330f},{7.73037f,-65.66205f,0.46697f},{0.16098f,-65.42519f,0.46249f},{-7.53238f,-65.31392f,0.46006f},{-15.40109f,-65.33255f,0.45986f},{-23.48496f,-65.49161f,0.46203f},{-31.80703f,-65.80511f,0.46665f},{-40.37375f,-66.28626f,0.47372f},{-49.18062f,-66.94289f,0.48312f},{-58.22152f,-67.77395f,0.49460f},{-67.49946f,-68.76776f,0.50778f},{-77.03640f,-69.90201f,0.52217f},{-86.88079f,-71.14489f,0.53717f},{-97.11212f,-72.45664f,0.55217f},{-107.84156f,-73.79090f,0.56652f},{-119.20626f,-75.09549f,0.57964f},{-131.35191f,-76.31306f,0.59102f},{-144.39481f,-77.38240f,0.60027f},{-158.35719f,-78.24183f,0.60715f},{-173.08769f,-78.83644f,0.61152f},{171.78274f,-79.12876f,0.61342f},{156.78187f,-79.10879f,0.61294f},{142.43310f,-78.79618f,0.61026f},{129.09306f,-78.23208f,0.60562f}},
+    {{85.81367f,-80.80007f,0.62993f},{77.83602f,-78.97830f,0.61663f},{71.40003f,-77.14756f,0.60163f},{65.88433f,-75.29021f,0.58513f},{60.88263f,-73.38193f,0.56721f},{56.08204f,-71.40769f,0.54792f},{51.22755f,-69.37743f,0.52741f},{46.12774f,-67.33857f,0.50597f},{40.67419f,-65.37896f,0.48417f},{34.85457f,-63.61481f,0.46274f},{28.74909f,-62.16302f,0.44252f},{22.50583f,-61.10460f,0.42424f},{16.29363f,-60.45316f,0.40840f},{10.23812f,-60.14557f,0.39524f},{4.36029f,-60.06470f,0.38483f},{-1.45095f,-60.08698f,0.37722f},{-7.40778f,-60.13217f,0.37262f},{-13.74178f,-60.19219f,0.37149f},{-20.61213f,-60.32958f,0.37444f},{-28.04922f,-60.65151f,0.38211f},{-35.95530f,-61.27183f,0.39496f},{-44.15322f,-62.27481f,0.41303f},{-52.45486f,-63.69257f,0.43591f},{-60.71951f,-65.50302f,0.46271f},{-68.88732f,-67.64474f,0.49220f},{-76.99183f,-70.03800f,0.52288f},{-85.16746f,-72.60073f,0.55321f},{-93.67473f,-75.25455f,0.58160f},{-102.97950f,-77.92173f,0.60660f},{-113.96429f,-80.51496f,0.62705f},{-128.46293f,-82.91263f,0.64217f},{-150.36073f,-84.88736f,0.65166f},{175.55488f,-85.95658f,0.65569f},{138.00554f,-85.63251f,0.65477f},{112.28051f,-84.30522f,0.64966f},{96.48319f,-82.60297f,0.64113f},{85.81367f,-80.80007f,0.62993f}},
+    {{48.22805f,-77.45516f,0.61859f},{46.81921f,-75.43606f,0.59954f},{45.24300f,-73.49604f,0.57951f},{43.71189f,-71.57699f,0.55859f},{42.27245f,-69.59653f,0.53652f},{40.80022f,-67.45749f,0.51281f},{39.00177f,-65.08505f,0.48703f},{36.49549f,-62.48902f,0.45921f},{32.95972f,-59.81600f,0.43010f},{28.26545f,-57.35291f,0.40125f},{22.54379f,-55.46368f,0.37460f},{16.18846f,-54.46054f,0.35184f},{9.77818f,-54.44855f,0.33383f},{3.88971f,-55.23685f,0.32034f},{-1.16066f,-56.40404f,0.31043f},{-5.50500f,-57.49090f,0.30313f},{-9.68832f,-58.18917f,0.29816f},{-14.40052f,-58.42457f,0.29624f},{-20.13990f,-58.34278f,0.29887f},{-26.99385f,-58.24952f,0.30789f},{-34.63319f,-58.51231f,0.32478f},{-42.50584f,-59.42525f,0.35003f},{-50.08478f,-61.10217f,0.38290f},{-57.00760f,-63.46936f,0.42162f},{-63.07978f,-66.34503f,0.46385f},{-68.20773f,-69.53469f,0.50716f},{-72.30336f,-72.88656f,0.54918f},{-75.14845f,-76.29320f,0.58755f},{-76.14220f,-79.66218f,0.62009f},{-73.56875f,-82.88130f,0.64502f},{-61.46573f,-85.73520f,0.66138f},{-19.66028f,-87.38955f,0.66918f},{28.39616f,-86.36194f,0.66921f},{43.98783f,-84.15583f,0.66276f},{48.35027f,-81.83294f,0.65127f},{49.03265f,-79.58616f,0.63614f},{48.22805f,-77.45517f,0.61859f}},
+    {{31.42931f,-71.58214f,0.58434f},{31.60530f,-69.61565f,0.56134f},{31.28145f,-67.71488f,0.53820f},{30.79047f,-65.86479f,0.51511f},{30.38024f,-64.01505f,0.49174f},{30.16777f,-62.04510f,0.46715f},{29.97487f,-59.77482f,0.44010f},{29.25597f,-57.07400f,0.40984f},{27.27948f,-54.02405f,0.37699f},{23.46202f,-51.03212f,0.34382f},{17.66378f,-48.80491f,0.31364f},{10.37176f,-48.09823f,0.28967f},{2.68673f,-49.26412f,0.27359f},{-4.06559f,-51.92460f,0.26453f},{-9.01317f,-55.16562f,0.25966f},{-12.19989f,-58.07793f,0.25610f},{-14.47861f,-60.10267f,0.25262f},{-17.04830f,-61.01513f,0.24997f},{-21.00672f,-60.84749f,0.25053f},{-26.83158f,-59.97822f,0.25779f},{-33.98769f,-59.15799f,0.27518f},{-41.32654f,-59.18575f,0.30435f},{-47.85214f,-60.45940f,0.34417f},{-52.97945f,-62.86069f,0.39141f},{-56.36644f,-65.97595f,0.44206f},{-57.72068f,-69.36736f,0.49253f},{-56.62201f,-72.71868f,0.54000f},{-52.29959f,-75.80268f,0.58194f},{-43.64045f,-78.35851f,0.61593f},{-30.08348f,-80.06262f,0.64015f},{-13.41611f,-80.67983f,0.65395f},{2.35315f,-80.25871f,0.65794f},{14.41455f,-79.08901f,0.65353f},{22.53506f,-77.46953f,0.64245f},{27.54777f,-75.59576f,0.62626f},{30.28028f,-73.59787f,0.60641f},{31.42931f,-71.58215f,0.58434f}},
+    {{22.67985f,-64.39807f,0.53921f},{23.21169f,-62.40221f,0.51448f},{23.25494f,-60.40960f,0.48995f},{22.99742f,-58.42549f,0.46595f},{22.63545f,-56.48151f,0.44250f},{22.42369f,-54.55795f,0.41888f},{22.46877f,-52.49863f,0.39359f},{22.43187f,-50.03954f,0.36521f},{21.42571f,-47.03044f,0.33366f},{18.33186f,-43.80319f,0.30097f},{12.46440f,-41.39118f,0.27115f},{4.21692f,-41.16169f,0.24895f},{-4.75068f,-43.78688f,0.23726f},{-12.30560f,-48.51954f,0.23477f},{-17.22721f,-53.83971f,0.23677f},{-19.74039f,-58.60413f,0.23885f},{-20.77499f,-62.35170f,0.23920f},{-21.16946f,-64.81766f,0.23803f},{-22.14607f,-65.60605f,0.23691f},{-25.39336f,-64.62579f,0.23986f},{-31.01102f,-62.64650f,0.25296f},{-37.19196f,-61.08659f,0.28060f},{-42.26227f,-61.05364f,0.32245f},{-45.34969f,-62.68316f,0.37391f},{-45.95366f,-65.34905f,0.42855f},{-43.77299f,-68.24163f,0.48085f},{-38.67388f,-70.78236f,0.52753f},{-30.72261f,-72.62117f,0.56643f},{-20.87969f,-73.51797f,0.59562f},{-11.16390f,-73.52965f,0.61429f},{-2.84711f,-73.02048f,0.62316f},{4.17466f,-72.24528f,0.62341f},{10.15622f,-71.21594f,0.61626f},{15.07307f,-69.88980f,0.60311f},{18.83144f,-68.25886f,0.58508f},{21.33469f,-66.38361f,0.56327f},{22.67985f,-64.39807f,0.53921f}},
+    {{17.07334f,-55.02826f,0.48785f},{17.59062f,-52.87120f,0.46379f},{17.77934f,-50.69073f,0.43988f},{17.69577f,-48.44731f,0.41636f},{17.34929f,-46.19513f,0.39367f},{16.88674f,-44.04849f,0.37182f},{16.56217f,-42.00465f,0.34998f},{16.38656f,-39.74123f,0.32674f},{15.63204f,-36.79801f,0.30099f},{12.86517f,-33.33110f,0.27346f},{6.93562f,-30.77621f,0.24780f},{-1.75751f,-31.26765f,0.22959f},{-10.98436f,-35.68330f,0.22251f},{-18.20308f,-42.58861f,0.22507f},{-22.41588f,-49.78570f,0.23198f},{-24.27993f,-56.05256f,0.23916f},{-24.67590f,-61.22645f,0.24558f},{-23.50719f,-65.24992f,0.25057f},{-21.00605f,-67.52021f,0.25278f},{-19.72369f,-67.43115f,0.25389f},{-21.87960f,-65.26549f,0.26060f},{-26.21214f,-62.35447f,0.28058f},{-30.23195f,-60.45735f,0.31692f},{-32.25069f,-60.49007f,0.36595f},{-31.49417f,-61.96843f,0.41928f},{-28.07385f,-63.81210f,0.46891f},{-22.58093f,-65.26064f,0.51065f},{-15.67611f,-65.90429f,0.54231f},{-8.73630f,-65.53604f,0.56238f},{-3.38117f,-64.51130f,0.57214f},{0.43868f,-63.52424f,0.57493f},{3.90117f,-62.77292f,0.57236f},{7.49078f,-61.94296f,0.56426f},{10.92679f,-60.76846f,0.55095f},{13.85484f,-59.16172f,0.53309f},{15.93237f,-57.17787f,0.51149f},{17.07334f,-55.02826f,0.48785f}},
+    {{13.37426f,-42.23934f,0.43209f},{13.67217f,-39.72248f,0.41089f},{13.78744f,-37.30606f,0.38995f},{13.78998f,-34.84704f,0.36941f},{13.54222f,-32.29950f,0.34979f},{12.98780f,-29.84715f,0.33155f},{12.38852f,-27.62882f,0.31470f},{11.96065f,-25.25073f,0.29826f},{11.09372f,-22.02346f,0.28044f},{8.25499f,-18.13398f,0.26067f},{2.21162f,-15.56621f,0.24164f},{-6.34723f,-17.09131f,0.22828f},{-14.82596f,-23.52381f,0.22418f},{-20.89032f,-32.78684f,0.22862f},{-23.89434f,-42.11183f,0.23770f},{-24.45752f,-49.91489f,0.24867f},{-23.26867f,-55.93881f,0.26122f},{-20.14461f,-60.34177f,0.27397f},{-15.21492f,-62.85919f,0.28296f},{-10.62227f,-63.04596f,0.28650f},{-9.09952f,-60.93631f,0.28895f},{-11.18829f,-57.41244f,0.29863f},{-14.91638f,-54.21948f,0.32271f},{-17.58833f,-52.82417f,0.36133f},{-17.75073f,-53.10885f,0.40653f},{-15.65321f,-54.02972f,0.44908f},{-12.03643f,-54.81946f,0.48374f},{-7.38772f,-54.92826f,0.50731f},{-2.92537f,-53.94911f,0.51774f},{-0.15156f,-52.38029f,0.51826f},{1.30857f,-51.27875f,0.51530f},{3.04660f,-50.79557f,0.51075f},{5.56513f,-50.20937f,0.50252f},{8.30463f,-49.05107f,0.48985f},{10.76538f,-47.23568f,0.47321f},{12.51642f,-44.84941f,0.45336f},{13.37426f,-42.23934f,0.43209f}},
+    {{11.10969f,-25.31616f,0.37890f},{11.11944f,-22.26353f,0.36283f},{11.01236f,-19.64432f,0.34739f},{10.99728f,-17.13765f,0.33271f},{10.84097f,-14.48794f,0.31922f},{10.32286f,-11.90452f,0.30724f},{9.70494f,-9.56551f,0.29696f},{9.19687f,-6.93532f,0.28780f},{8.09157f,-3.35246f,0.27809f},{4.94277f,0.62534f,0.26658f},{-1.12864f,2.69744f,0.25432f},{-9.05484f,0.20162f,0.24439f},{-16.32980f,-7.49683f,0.23994f},{-21.04376f,-18.49333f,0.24247f},{-22.55109f,-29.80260f,0.25117f},{-21.19496f,-38.99555f,0.26398f},{-17.89373f,-45.22087f,0.27930f},{-13.44411f,-48.81124f,0.29517f},{-8.58084f,-50.28975f,0.30771f},{-4.24867f,-49.88122f,0.31403f},{-1.62827f,-47.49942f,0.31546f},{-1.86509f,-43.57896f,0.31823f},{-4.55045f,-39.80201f,0.33068f},{-7.42469f,-37.81589f,0.35590f},{-8.64775f,-37.58213f,0.38846f},{-8.12536f,-38.12733f,0.42051f},{-6.32716f,-38.79073f,0.44683f},{-3.48850f,-38.91636f,0.46322f},{-0.64489f,-37.84560f,0.46680f},{0.72027f,-36.15384f,0.46142f},{0.97976f,-35.28930f,0.45465f},{1.90952f,-35.35164f,0.44832f},{4.01623f,-35.11620f,0.43950f},{6.51266f,-33.90633f,0.42721f},{8.80749f,-31.71407f,0.41228f},{10.44185f,-28.67497f,0.39568f},{11.10969f,-25.31616f,0.37890f}},
+    {{9.88349f,-5.22365f,0.34114f},{9.72040f,-1.68002f,0.33192f},{9.41289f,0.98130f,0.32348f},{9.38439f,3.28459f,0.31616f},{9.33291f,5.73141f,0.31061f},{8.89921f,8.13291f,0.30672f},{8.31537f,10.33797f,0.30410f},{7.68011f,12.92226f,0.30225f},{6.17272f,16.28019f,0.29980f},{2.60695f,19.52644f,0.29492f},{-3.33977f,20.64919f,0.28700f},{-10.37899f,17.75076f,0.27755f},{-16.38823f,10.26968f,0.26956f},{-19.72660f,-0.68527f,0.26653f},{-19.70115f,-12.39654f,0.27083f},{-16.80477f,-21.81573f,0.28123f},{-12.41185f,-27.55757f,0.29446f},{-7.91607f,-29.98547f,0.30791f},{-4.15177f,-30.24089f,0.31935f},{-1.10381f,-29.18412f,0.32678f},{1.22204f,-26.62224f,0.32987f},{1.82879f,-22.51726f,0.33216f},{0.23517f,-18.50023f,0.33985f},{-2.13784f,-16.36665f,0.35562f},{-3.62813f,-16.02599f,0.37648f},{-3.94630f,-16.47452f,0.39779f},{-3.34494f,-17.18522f,0.41572f},{-1.85961f,-17.56335f,0.42632f},{-0.22644f,-16.82114f,0.42691f},{0.26762f,-15.49276f,0.42012f},{-0.08803f,-15.21405f,0.41134f},{0.44077f,-16.04947f,0.40209f},{2.38763f,-16.38744f,0.39087f},{4.89878f,-15.33409f,0.37775f},{7.32401f,-12.92178f,0.36429f},{9.15291f,-9.31548f,0.35181f},{9.88349f,-5.22365f,0.34114f}},
+    {{9.12464f,14.65727f,0.32818f},{9.18177f,18.24457f,0.32516f},{8.94457f,20.73560f,0.32319f},{9.04553f,22.68750f,0.32283f},{9.19618f,24.74090f,0.32517f},{8.89744f,26.83478f,0.32980f},{8.21223f,28.82717f,0.33535f},{7.14260f,31.06453f,0.34062f},{4.96349f,33.64927f,0.34397f},{0.86055f,35.73650f,0.34296f},{-4.97931f,35.91607f,0.33615f},{-11.14357f,33.06931f,0.32475f},{-15.85640f,26.82267f,0.31211f},{-17.78532f,17.82545f,0.30265f},{-16.57645f,8.14938f,0.30010f},{-13.08478f,0.35249f,0.30443f},{-8.67898f,-4.22224f,0.31265f},{-4.59243f,-5.65846f,0.32241f},{-1.60427f,-5.08244f,0.33228f},{0.55144f,-3.67265f,0.34067f},{2.39028f,-1.30171f,0.34700f},{3.23916f,2.36894f,0.35327f},{2.31654f,6.00997f,0.36224f},{0.46434f,7.96495f,0.37416f},{-0.91732f,8.31670f,0.38773f},{-1.53003f,8.01335f,0.40158f},{-1.62589f,7.45026f,0.41356f},{-1.18564f,6.96852f,0.42060f},{-0.62403f,7.19717f,0.42076f},{-0.86624f,7.76654f,0.41455f},{-1.66562f,7.31456f,0.40362f},{-1.50145f,5.77666f,0.38928f},{0.21812f,4.68883f,0.37303f},{2.79294f,5.07867f,0.35700f},{5.56329f,7.05547f,0.34334f},{7.91823f,10.50432f,0.33369f},{9.12464f,14.65727f,0.32818f}},
+    {{8.06290f,31.00203f,0.33981f},{8.93172f,34.03206f,0.34000f},{9.29767f,36.22486f,0.34266f},{9.81684f,37.93041f,0.34809f},{10.30693f,39.71929f,0.35721f},{10.20311f,41.67672f,0.36937f},{9.30721f,43.64451f,0.38240f},{7.53634f,45.63057f,0.39400f},{4.41412f,47.51149f,0.40180f},{-0.45099f,48.64179f,0.40293f},{-6.41113f,48.13476f,0.39568f},{-11.85029f,45.46014f,0.38157f},{-15.25565f,40.64785f,0.36502f},{-15.88209f,34.34474f,0.35110f},{-13.96742f,27.90343f,0.34343f},{-10.49677f,22.77471f,0.34233f},{-6.46933f,19.78522f,0.34605f},{-2.75504f,19.08118f,0.35337f},{-0.08743f,19.96093f,0.36304f},{1.66921f,21.39191f,0.37282f},{3.12874f,23.28877f,0.38187f},{3.96903f,25.96005f,0.39163f},{3.45981f,28.61507f,0.40273f},{2.05876f,30.09860f,0.41394f},{0.88578f,30.42073f,0.42487f},{0.20951f,30.29938f,0.43601f},{-0.29117f,30.04062f,0.44625f},{-0.68669f,29.74069f,0.45294f},{-1.18101f,29.65970f,0.45399f},{-2.27487f,29.53545f,0.44803f},{-3.63054f,28.53162f,0.43420f},{-3.95562f,26.62276f,0.41393f},{-2.62221f,24.91817f,0.39124f},{-0.08793f,24.37385f,0.37028f},{3.01927f,25.31100f,0.35389f},{6.01454f,27.72542f,0.34377f},{8.06290f,31.00203f,0.33981f}},
+    {{6.31041f,43.33608f,0.37236f},{8.41617f,45.45851f,0.37289f},{9.93058f,47.28808f,0.37826f},{11.21483f,48.92364f,0.38816f},{12.13996f,50.69187f,0.40237f},{12.23034f,52.68920f,0.41956f},{11.14011f,54.75852f,0.43724f},{8.66524f,56.70372f,0.45274f},{4.49928f,58.24993f,0.46333f},{-1.34733f,58.87748f,0.46592f},{-7.71989f,58.03709f,0.45864f},{-12.71272f,55.61656f,0.44316f},{-15.08305f,52.01961f,0.42447f},{-14.75641f,47.93440f,0.40808f},{-12.45343f,44.13769f,0.39741f},{-9.09705f,41.24459f,0.39283f},{-5.35725f,39.61639f,0.39339f},{-1.83470f,39.39065f,0.39860f},{0.82823f,40.22833f,0.40735f},{2.57001f,41.47069f,0.41725f},{3.86519f,42.89022f,0.42701f},{4.69588f,44.59331f,0.43745f},{4.60243f,46.23881f,0.44902f},{3.76104f,47.24171f,0.46095f},{2.87601f,47.57154f,0.47308f},{2.13967f,47.63935f,0.48570f},{1.24833f,47.66249f,0.49764f},{0.02788f,47.62919f,0.50631f},{-1.62859f,47.50096f,0.50895f},{-3.80231f,47.00810f,0.50305f},{-5.90990f,45.71114f,0.48719f},{-6.79346f,43.68014f,0.46316f},{-5.87079f,41.65440f,0.43591f},{-3.45535f,40.38784f,0.41060f},{-0.15720f,40.27252f,0.39068f},{3.34006f,41.37670f,0.37789f},{6.31041f,43.33608f,0.37236f}},
+    {{4.26294f,53.10131f,0.42245f},{7.59975f,54.36161f,0.42215f},{10.43666f,55.82606f,0.42846f},{12.70491f,57.45873f,0.44064f},{14.16020f,59.32146f,0.45724f},{14.43398f,61.39014f,0.47601f},{13.18770f,63.50628f,0.49435f},{10.10768f,65.43734f,0.50993f},{4.90586f,66.85905f,0.52038f},{-2.08386f,67.31408f,0.52304f},{-9.15208f,66.44780f,0.51631f},{-14.09196f,64.38450f,0.50148f},{-15.93051f,61.68268f,0.48288f},{-15.08268f,58.96721f,0.46550f},{-12.51517f,56.68844f,0.45264f},{-9.09089f,55.08044f,0.44515f},{-5.35759f,54.25566f,0.44269f},{-1.77919f,54.24982f,0.44488f},{1.14514f,54.89128f,0.45083f},{3.24292f,55.82780f,0.45875f},{4.77489f,56.83438f,0.46742f},{5.90082f,57.87845f,0.47714f},{6.46683f,58.85920f,0.48867f},{6.42854f,59.59271f,0.50225f},{5.95440f,60.06042f,0.51759f},{5.04613f,60.40887f,0.53373f},{3.49019f,60.71534f,0.54863f},{1.14215f,60.90716f,0.55948f},{-1.96091f,60.81057f,0.56339f},{-5.46021f,60.15911f,0.55795f},{-8.43365f,58.74748f,0.54232f},{-9.79880f,56.73559f,0.51859f},{-9.13330f,54.64618f,0.49131f},{-6.77311f,53.02448f,0.46537f},{-3.34752f,52.20550f,0.44426f},{0.50970f,52.28132f,0.42977f},{4.26294f,53.10131f,0.42245f}},
+    {{2.57464f,61.90363f,0.48319f},{6.81988f,62.59082f,0.48226f},{10.72127f,63.73000f,0.48758f},{13.95370f,65.25974f,0.49842f},{16.10049f,67.10373f,0.51308f},{16.72460f,69.13404f,0.52913f},{15.39548f,71.16923f,0.54416f},{11.64478f,72.97878f,0.55622f},{5.15172f,74.24745f,0.56358f},{-3.36781f,74.58969f,0.56459f},{-11.49173f,73.79370f,0.55836f},{-16.72206f,72.08739f,0.54575f},{-18.40831f,69.99806f,0.52954f},{-17.31430f,68.01780f,0.51323f},{-14.50140f,66.44167f,0.49956f},{-10.79977f,65.38391f,0.48985f},{-6.74992f,64.86230f,0.48445f},{-2.76545f,64.84287f,0.48324f},{0.78143f,65.21557f,0.48569f},{3.70100f,65.80372f,0.49085f},{6.08013f,66.46017f,0.49796f},{8.07892f,67.12970f,0.50710f},{9.67963f,67.80720f,0.51894f},{10.67456f,68.49179f,0.53390f},{10.77058f,69.18909f,0.55144f},{9.65347f,69.89166f,0.56981f},{7.07600f,70.52514f,0.58634f},{3.02043f,70.92481f,0.59810f},{-2.09809f,70.86509f,0.60259f},{-7.27683f,70.14456f,0.59827f},{-11.16806f,68.73300f,0.58527f},{-12.81861f,66.86155f,0.56571f},{-12.13043f,64.92449f,0.54318f},{-9.62141f,63.29260f,0.52144f},{-5.97603f,62.20331f,0.50331f},{-1.77704f,61.74779f,0.49032f},{2.57464f,61.90363f,0.48319f}},
+    {{1.43503f,70.57319f,0.53929f},{6.27921f,70.97549f,0.53799f},{10.88019f,71.81891f,0.54070f},{14.88261f,73.05700f,0.54691f},{17.80063f,74.60513f,0.55552f},{19.02158f,76.33503f,0.56497f},{17.77297f,78.07584f,0.57363f},{13.12636f,79.60158f,0.58010f},{4.53718f,80.60606f,0.58328f},{-6.54055f,80.76720f,0.58236f},{-16.27050f,79.99878f,0.57702f},{-21.85552f,78.58008f,0.56775f},{-23.31365f,76.92858f,0.55586f},{-21.85455f,75.37566f,0.54317f},{-18.61101f,74.11340f,0.53137f},{-14.36797f,73.22087f,0.52173f},{-9.64057f,72.70518f,0.51505f},{-4.79964f,72.52979f,0.51167f},{-0.13239f,72.62677f,0.51159f},{4.18385f,72.91213f,0.51458f},{8.10605f,73.31657f,0.52039f},{11.64519f,73.81370f,0.52900f},{14.70734f,74.42101f,0.54059f},{16.97990f,75.17239f,0.55506f},{17.92977f,76.07666f,0.57159f},{16.88820f,77.07532f,0.58845f},{13.23164f,78.01176f,0.60334f},{6.81146f,78.63384f,0.61392f},{-1.34665f,78.66938f,0.61846f},{-8.97876f,77.98598f,0.61626f},{-14.01257f,76.70086f,0.60790f},{-15.81005f,75.10445f,0.59512f},{-14.85926f,73.50638f,0.58032f},{-12.00033f,72.14451f,0.56589f},{-7.99733f,71.16426f,0.55363f},{-3.40265f,70.63412f,0.54459f},{1.43502f,70.57319f,0.53929f}},
+    {{0.13094f,78.82351f,0.57278f},{5.45479f,79.06440f,0.57090f},{10.54962f,79.60559f,0.57068f},{15.08235f,80.41612f,0.57187f},{18.55436f,81.44382f,0.57403f},{20.17754f,82.60991f,0.57656f},{18.67574f,83.79747f,0.57878f},{12.20150f,84.82323f,0.58007f},{-0.36226f,85.41014f,0.57991f},{-15.49225f,85.29919f,0.57795f},{-26.46004f,84.52961f,0.57409f},{-31.19380f,83.39228f,0.56849f},{-31.33251f,82.15604f,0.56162f},{-28.66356f,80.99185f,0.55414f},{-24.33699f,79.99787f,0.54681f},{-19.03627f,79.22370f,0.54040f},{-13.18344f,78.68527f,0.53554f},{-7.06335f,78.37555f,0.53271f},{-0.88475f,78.27394f,0.53223f},{5.19490f,78.35635f,0.53423f},{11.05071f,78.60546f,0.53873f},{16.55252f,79.01788f,0.54564f},{21.50321f,79.60326f,0.55475f},{25.56424f,80.37283f,0.56559f},{28.16988f,81.31875f,0.57735f},{28.41286f,82.38760f,0.58891f},{24.95220f,83.44917f,0.59900f},{16.43585f,84.26774f,0.60643f},{3.63861f,84.54142f,0.61040f},{-8.67079f,84.12292f,0.61066f},{-16.18909f,83.18704f,0.60758f},{-18.69045f,82.03917f,0.60203f},{-17.68753f,80.91872f,0.59514f},{-14.54612f,79.97342f,0.58801f},{-10.18137f,79.28584f,0.58156f},{-5.16795f,78.89722f,0.57637f},{0.13094f,78.82351f,0.57278f}},
+    {{-4.14830f,85.92404f,0.57900f},{1.12345f,85.99807f,0.57728f},{5.96040f,86.21370f,0.57584f},{9.84415f,86.55320f,0.57463f},{11.94596f,86.98729f,0.57360f},{10.80871f,87.46743f,0.57263f},{4.02869f,87.90712f,0.57160f},{-10.36405f,88.15645f,0.57039f},{-27.94912f,88.05609f,0.56890f},{-39.79617f,87.61718f,0.56707f},{-44.16477f,86.98684f,0.56489f},{-43.57950f,86.28678f,0.56241f},{-40.12657f,85.58976f,0.55976f},{-34.99189f,84.94098f,0.55710f},{-28.83083f,84.37090f,0.55465f},{-22.02403f,83.90045f,0.55263f},{-14.80922f,83.54357f,0.55127f},{-7.34799f,83.30879f,0.55074f},{0.23881f,83.20077f,0.55121f},{7.85050f,83.22179f,0.55273f},{15.39197f,83.37274f,0.55530f},{22.75942f,83.65354f,0.55883f},{29.82156f,84.06234f,0.56314f},{36.38924f,84.59369f,0.56798f},{42.15868f,85.23581f,0.57300f},{46.59144f,85.96691f,0.57785f},{48.63821f,86.74942f,0.58216f},{46.09967f,87.51716f,0.58562f},{34.72041f,88.14109f,0.58802f},{12.13936f,88.39226f,0.58928f},{-8.98865f,88.15089f,0.58943f},{-18.65098f,87.63861f,0.58865f},{-20.47841f,87.08412f,0.58716f},{-18.40133f,86.59723f,0.58523f},{-14.39834f,86.22810f,0.58309f},{-9.45818f,86.00055f,0.58097f},{-4.14830f,85.92404f,0.57900f}},
+    {{-169.79948f,88.21420f,0.56830f},{-159.79948f,88.21420f,0.56830f},{-149.79948f,88.21420f,0.56830f},{-139.79948f,88.21420f,0.56830f},{-129.79948f,88.21420f,0.56830f},{-119.79948f,88.21420f,0.56830f},{-109.79948f,88.21420f,0.56830f},{-99.79948f,88.21420f,0.56830f},{-89.79948f,88.21420f,0.56830f},{-79.79948f,88.21420f,0.56830f},{-69.79948f,88.21420f,0.56830f},{-59.79948f,88.21420f,0.56830f},{-49.79948f,88.21420f,0.56830f},{-39.79948f,88.21420f,0.56830f},{-29.79948f,88.21420f,0.56830f},{-19.79948f,88.21420f,0.56830f},{-9.79948f,88.21420f,0.56830f},{0.20052f,88.21420f,0.56830f},{10.20052f,88.21420f,0.56830f},{20.20052f,88.21420f,0.56830f},{30.20052f,88.21420f,0.56830f},{40.20052f,88.21420f,0.56830f},{50.20052f,88.21420f,0.56830f},{60.20052f,88.21420f,0.56830f},{70.20052f,88.21420f,0.56830f},{80.20052f,88.21420f,0.56830f},{90.20052f,88.21420f,0.56830f},{100.20052f,88.21420f,0.56830f},{110.20052f,88.21420f,0.56830f},{120.20052f,88.21420f,0.56830f},{130.20052f,88.21420f,0.56830f},{140.20052f,88.21420f,0.56830f},{150.20052f,88.21420f,0.56830f},{160.20052f,88.21420f,0.56830f},{170.20052f,88.21420f,0.56830f},{-179.79948f,88.21420f,0.56830f},{-169.79948f,88.21420f,0.56830f}}
 };
 
@@ -123,6 +123,47 @@ TEST(MagField, test_field_error)
     }
 }
 
+/*
+  the batch lookup, and lookups that hit the cached cell, must match a lookup from cold
+ */
+TEST(MagField, test_batch_and_cache)
+{
+    const uint16_t n = ARRAY_SIZE(test_data) * 2;
+    float lat[n], lon[n], intensity[n], declination[n], inclination[n];
+    for (uint16_t i = 0; i < ARRAY_SIZE(test_data); i++) {
+        // each position followed by one a little way off, mostly in the same cell
+        lat[2*i] = test_data[i].lat;
+        lon[2*i] = test_data[i].lon;
+        lat[2*i+1] = test_data[i].lat + 0.5;
+        lon[2*i+1] = test_data[i].lon - 0.5;
+    }
+    EXPECT_TRUE(AP_Declination::get_mag_field_ef(lat, lon, n, intensity, declination, inclination));
+
+    for (uint16_t i = 0; i < n; i++) {
+        float intensity1, declination1, inclination1;
+        EXPECT_TRUE(AP_Declination::get_mag_field_ef(lat[i], lon[i], intensity1, declination1, inclination1));
+        EXPECT_FLOAT_EQ(intensity1, intensity[i]);
+        EXPECT_FLOAT_EQ(declination1, declination[i]);
+        EXPECT_FLOAT_EQ(inclination1, inclination[i]);
+
+        // again, now the cell is cached
+        float intensity2, declination2, inclination2;
+        EXPECT_TRUE(AP_Declination::get_mag_field_ef(lat[i], lon[i], intensity2, declination2, inclination2));
+        EXPECT_FLOAT_EQ(intensity1, intensity2);
+        EXPECT_FLOAT_EQ(declination1, declination2);
+        EXPECT_FLOAT_EQ(inclination1, inclination2);
+    }
+
+    // positions on or outside the table bounds are reported as invalid, even after a lookup in the same cell
+    float intensity1, declination1, inclination1;
+    EXPECT_TRUE(AP_Declination::get_mag_field_ef(-85, -175, intensity1, declination1, inclination1));
+    EXPECT_FALSE(AP_Declination::get_mag_field_ef(-90, -175, intensity1, declination1, inclination1));
+    EXPECT_TRUE(AP_Declination::get_mag_field_ef(-85, -175, intensity1, declination1, inclination1));
+    EXPECT_FALSE(AP_Declination::get_mag_field_ef(-85, -180, intensity1, declination1, inclination1));
+    EXPECT_FALSE(AP_Declination::get_mag_field_ef(90, 0, intensity1, declination1, inclination1));
+    lat[0] = 95;
+    EXPECT_FALSE(AP_Declination::get_mag_field_ef(lat, lon, 2, intensity, declination, inclination));
+}
 
 AP_GTEST_MAIN()
 int hal = 0;
@@ -10,6 +10,7 @@ extern const AP_HAL::HAL& hal;
 #define LOG_TAG "DroneCANIface"
 #include <canard.h>
 #include <AP_CANManager/AP_CANSensor.h>
+#include <AP_Common/ExpandingString.h>
 
 #define DEBUG_PKTS 0
 
@@ -108,6 +109,9 @@ bool CanardInterface::broadcast(const Canard::Transfer &bcast_transfer) {
     } else {
         protocol_stats.tx_frames += ret;
     }
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    update_tx_msg_stats(tx_transfer, ret);
+#endif
     return ret > 0;
 }
 
@@ -140,6 +144,9 @@ bool CanardInterface::request(uint8_t destination_node_id, const Canard::Transfe
     } else {
         protocol_stats.tx_frames += ret;
     }
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    update_tx_msg_stats(tx_transfer, ret);
+#endif
     return ret > 0;
 }
 
@@ -172,11 +179,22 @@ bool CanardInterface::respond(uint8_t destination_node_id, const Canard::Transfe
     } else {
         protocol_stats.tx_frames += ret;
     }
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    update_tx_msg_stats(tx_transfer, ret);
+#endif
     return ret > 0;
 }
 
 void CanardInterface::onTransferReception(CanardInstance* ins, CanardRxTransfer* transfer) {
     CanardInterface* iface = (CanardInterface*) ins->user_reference;
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    MsgStats *ms = find_msg_stats(iface->rx_msg_stats, transfer->data_type_id, transfer->transfer_type);
+    if (ms != nullptr) {
+        ms->transfers++;
+    } else {
+        iface->rx_msg_stats_overflow++;
+    }
+#endif
     iface->handle_message(*transfer);
 }
 
@@ -219,8 +237,9 @@ void CanardInterface::processTx(bool raw_commands_only = false) {
         // we need to ensure that this is not optimized
         volatile const auto *stats = ifaces[iface]->get_statistics();
         uint64_t last_transmit_us = stats==nullptr?0:stats->last_transmit_us;
+        const uint64_t now_us = AP_HAL::micros64();
         bool iface_down = true;
-        if (stats == nullptr || (AP_HAL::micros64() - last_transmit_us) < 200000UL) {
+        if (stats == nullptr || (now_us - last_transmit_us) < 200000UL) {
             /*
             We were not able to queue the frame for
             sending. Only mark the send as failing if the
@@ -242,6 +261,15 @@ void CanardInterface::processTx(bool raw_commands_only = false) {
                 }
                 continue;
             }
+            if (!(txf->iface_mask & (1U<<iface)) || now_us >= txf->deadline_usec) {
+                // already sent on this interface or expired, no
+                // need to check for space on the interface
+                txq = txq->next;
+                if (txq == nullptr) {
+                    break;
+                }
+                continue;
+            }
             AP_HAL::CANFrame txmsg {};
             txmsg.dlc = AP_HAL::CANFrame::dataLengthToDlc(txf->data_len);
             memcpy(txmsg.data, txf->data, txf->data_len);
@@ -260,7 +288,7 @@ void CanardInterface::processTx(bool raw_commands_only = false) {
                 } else {
                     txf->iface_mask &= ~(1U<<iface);
                 }
-            } else if ((txf->iface_mask & (1U<<iface)) && (AP_HAL::micros64() < txf->deadline_usec)) {
+            } else {
                 // try sending to interfaces, clearing the mask if we succeed
                 if (ifaces[iface]->send(txmsg, txf->deadline_usec, 0) > 0) {
                     txf->iface_mask &= ~(1U<<iface);
@@ -326,68 +354,218 @@ void CanardInterface::update_rx_protocol_stats(int16_t res)
     }
 }
 
+/*
+  pull up to CANARD_RX_BATCH_SIZE frames from an interface into
+  rx_batch, returning the number of frames. 11 bit frames are passed
+  straight to the auxillary driver
+ */
+uint8_t CanardInterface::receive_batch(uint8_t iface)
+{
+    uint8_t count = 0;
+    while (count < ARRAY_SIZE(rx_batch)) {
+        AP_HAL::CANFrame rxmsg;
+        uint64_t timestamp;
+        AP_HAL::CANIface::CanIOFlags flags;
+        if (ifaces[iface]->receive(rxmsg, timestamp, flags) <= 0) {
+            // no data pending
+            break;
+        }
+
+        if (!rxmsg.isExtended()) {
+            // 11 bit frame, see if we have a handler
+            if (aux_11bit_driver != nullptr) {
+                aux_11bit_driver->handle_frame(rxmsg);
+            }
+            continue;
+        }
+
+        CanardCANFrame &rx_frame = rx_batch[count].frame;
+        rx_frame = {};
+        rx_frame.data_len = AP_HAL::CANFrame::dlcToDataLength(rxmsg.dlc);
+        memcpy(rx_frame.data, rxmsg.data, rx_frame.data_len);
+#if HAL_CANFD_SUPPORTED
+        rx_frame.canfd = rxmsg.canfd;
+#endif
+        rx_frame.id = rxmsg.id;
+#if CANARD_MULTI_IFACE
+        rx_frame.iface_id = iface;
+#endif
+        rx_batch[count].timestamp_us = timestamp;
+        count++;
+    }
+    return count;
+}
+
+// pass one frame to canard, must be called with _sem_rx held
+void CanardInterface::handle_rx_frame(const CanardCANFrame &rx_frame, uint64_t timestamp_us)
+{
+    const int16_t res = canardHandleRxFrame(&canard, &rx_frame, timestamp_us);
+    bool wanted = true;
+    if (res == -CANARD_ERROR_RX_MISSED_START) {
+        // this might remaining frames from a message that we don't accept, so check
+        uint64_t dummy_signature;
+        wanted = shouldAcceptTransfer(&canard,
+                                      &dummy_signature,
+                                      extractDataType(rx_frame.id),
+                                      extractTransferType(rx_frame.id),
+                                      1); // doesn't matter what we pass here
+    }
+    if (wanted) {
+        update_rx_protocol_stats(res);
+    } else {
+        protocol_stats.rx_ignored_not_wanted++;
+    }
+
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    switch (res) {
+    case -CANARD_ERROR_RX_INCOMPATIBLE_PACKET:
+    case -CANARD_ERROR_RX_WRONG_ADDRESS:
+    case -CANARD_ERROR_RX_NOT_WANTED:
+    case -CANARD_ERROR_RX_UNEXPECTED_TID:
+        // not for us, don't take up a slot in the table
+        return;
+    default:
+        if (!wanted) {
+            return;
+        }
+        break;
+    }
+    MsgStats *ms = find_msg_stats(rx_msg_stats, extractDataType(rx_frame.id), extractTransferType(rx_frame.id));
+    if (ms == nullptr) {
+        return;
+    }
+    if (res == CANARD_OK) {
+        ms->frames++;
+    } else {
+        ms->errors++;
+    }
+#endif
+}
+
 void CanardInterface::processRx() {
-    AP_HAL::CANFrame rxmsg;
     for (uint8_t i=0; i<num_ifaces; i++) {
-        while(true) {
-            if (ifaces[i] == NULL) {
-                break;
-            }
+        if (ifaces[i] == NULL) {
+            continue;
+        }
+        while (true) {
+            // select also services the interface, e.g. discarding timed
+            // out tx frames and clearing errors, so it runs every pass
             bool read_select = true;
             bool write_select = false;
             ifaces[i]->select(read_select, write_select, nullptr, 0);
             if (!read_select) { // No data pending
                 break;
             }
-            CanardCANFrame rx_frame {};
-
-            //palToggleLine(HAL_GPIO_PIN_LED);
-            uint64_t timestamp;
-            AP_HAL::CANIface::CanIOFlags flags;
-            if (ifaces[i]->receive(rxmsg, timestamp, flags) <= 0) {
+            // frames are dequeued without holding _sem_rx, then handed
+            // to canard together so the semaphore is taken once per
+            // batch rather than once per frame
+            const uint8_t count = receive_batch(i);
+            if (count == 0) {
                 break;
             }
-
-            if (!rxmsg.isExtended()) {
-                // 11 bit frame, see if we have a handler
-                if (aux_11bit_driver != nullptr) {
-                    aux_11bit_driver->handle_frame(rxmsg);
-                }
-                continue;
-            }
-
-            rx_frame.data_len = AP_HAL::CANFrame::dlcToDataLength(rxmsg.dlc);
-            memcpy(rx_frame.data, rxmsg.data, rx_frame.data_len);
-#if HAL_CANFD_SUPPORTED
-            rx_frame.canfd = rxmsg.canfd;
-#endif
-            rx_frame.id = rxmsg.id;
-#if CANARD_MULTI_IFACE
-            rx_frame.iface_id = i;
-#endif
             {
                 WITH_SEMAPHORE(_sem_rx);
-
-                const int16_t res = canardHandleRxFrame(&canard, &rx_frame, timestamp);
-                if (res == -CANARD_ERROR_RX_MISSED_START) {
-                    // this might remaining frames from a message that we don't accept, so check
-                    uint64_t dummy_signature;
-                    if (shouldAcceptTransfer(&canard,
-                                        &dummy_signature,
-                                        extractDataType(rx_frame.id),
-                                        extractTransferType(rx_frame.id),
-                                        1)) { // doesn't matter what we pass here
-                        update_rx_protocol_stats(res);
-                    } else {
-                        protocol_stats.rx_ignored_not_wanted++;
-                    }
-                } else {
-                    update_rx_protocol_stats(res);
+                for (uint8_t n=0; n<count; n++) {
+                    handle_rx_frame(rx_batch[n].frame, rx_batch[n].timestamp_us);
                 }
             }
+            if (count < ARRAY_SIZE(rx_batch)) {
+                // interface has been drained
+                break;
+            }
+        }
+    }
+}
+
+#if AP_DRONECAN_MSG_STATS_ENABLED
+/*
+  find the statistics entry for a data type, adding it if needed.
+  Returns nullptr if the table is full
+ */
+CanardInterface::MsgStats *CanardInterface::find_msg_stats(MsgStats *table, uint16_t data_type_id, uint8_t transfer_type)
+{
+    uint8_t idx = ((data_type_id * 31U) ^ transfer_type) & (MSG_STATS_SIZE-1);
+    for (uint8_t i=0; i<MSG_STATS_SIZE; i++) {
+        MsgStats &ms = table[idx];
+        if (!ms.used) {
+            ms.data_type_id = data_type_id;
+            ms.transfer_type = transfer_type;
+            ms.used = true;
+            return &ms;
+        }
+        if (ms.data_type_id == data_type_id && ms.transfer_type == transfer_type) {
+            return &ms;
         }
+        idx = (idx + 1) & (MSG_STATS_SIZE-1);
+    }
+    return nullptr;
+}
+
+// record the result of queueing a transfer, must be called with _sem_tx held
+void CanardInterface::update_tx_msg_stats(const CanardTxTransfer &transfer, int16_t ret)
+{
+    MsgStats *ms = find_msg_stats(tx_msg_stats, transfer.data_type_id, transfer.transfer_type);
+    if (ms == nullptr) {
+        tx_msg_stats_overflow++;
+        return;
+    }
+    if (ret <= 0) {
+        ms->errors++;
+    } else {
+        ms->transfers++;
+        ms->frames += ret;
+    }
+}
+
+/*
+  print one statistics table. Each entry is copied with the semaphore
+  protecting the table held, so that it is not held while printing
+ */
+void CanardInterface::print_msg_stats(ExpandingString &str, const char *dir, const MsgStats *table, HAL_Semaphore &sem)
+{
+    static const char *transfer_type_names[] { "RES", "REQ", "MSG" };
+    for (uint8_t i=0; i<MSG_STATS_SIZE; i++) {
+        MsgStats ms;
+        {
+            WITH_SEMAPHORE(sem);
+            ms = table[i];
+        }
+        if (!ms.used) {
+            continue;
+        }
+        str.printf("%s %-3s %5u %8u %8u %6u\n",
+                   dir,
+                   ms.transfer_type < ARRAY_SIZE(transfer_type_names) ? transfer_type_names[ms.transfer_type] : "?",
+                   unsigned(ms.data_type_id),
+                   unsigned(ms.transfers),
+                   unsigned(ms.frames),
+                   unsigned(ms.errors));
+    }
+}
+
+// print per message type statistics
+void CanardInterface::msg_stats_info(ExpandingString &str)
+{
+    str.printf("Dir Typ    ID    Xfers   Frames   Errs\n");
+    print_msg_stats(str, "RX ", rx_msg_stats, _sem_rx);
+    uint32_t overflow;
+    {
+        WITH_SEMAPHORE(_sem_rx);
+        overflow = rx_msg_stats_overflow;
+    }
+    if (overflow > 0) {
+        str.printf("RX  other transfers %u\n", unsigned(overflow));
+    }
+    print_msg_stats(str, "TX ", tx_msg_stats, _sem_tx);
+    {
+        WITH_SEMAPHORE(_sem_tx);
+        overflow = tx_msg_stats_overflow;
+    }
+    if (overflow > 0) {
+        str.printf("TX  other transfers %u\n", unsigned(overflow));
     }
 }
+#endif // AP_DRONECAN_MSG_STATS_ENABLED
 
 void CanardInterface::process(uint32_t duration_ms) {
 #if AP_TEST_DRONECAN_DRIVERS
@@ -4,8 +4,18 @@
 #include <canard/interface.h>
 #include <dronecan_msgs.h>
 
+#ifndef AP_DRONECAN_MSG_STATS_ENABLED
+#define AP_DRONECAN_MSG_STATS_ENABLED (BOARD_FLASH_SIZE>1024)
+#endif
+
+// number of frames pulled from an interface before handing them to canard
+#ifndef CANARD_RX_BATCH_SIZE
+#define CANARD_RX_BATCH_SIZE 8
+#endif
+
 class AP_DroneCAN;
 class CANSensor;
+class ExpandingString;
 
 class CanardInterface : public Canard::Interface {
     friend class AP_DroneCAN;
@@ -63,8 +73,17 @@ public:
 
     void update_rx_protocol_stats(int16_t res);
 
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    // print per message type statistics
+    void msg_stats_info(ExpandingString &str);
+#endif
+
     uint8_t get_node_id() const override { return canard.node_id; }
 private:
+    // dequeue up to CANARD_RX_BATCH_SIZE extended frames from an interface into rx_batch
+    uint8_t receive_batch(uint8_t iface);
+    void handle_rx_frame(const CanardCANFrame &rx_frame, uint64_t timestamp_us);
+
     CanardInstance canard;
     AP_HAL::CANIface* ifaces[HAL_NUM_CAN_IFACES];
 #if AP_TEST_DRONECAN_DRIVERS
@@ -81,5 +100,37 @@ private:
 
     // auxillary 11 bit CANSensor
     CANSensor *aux_11bit_driver;
+
+    // frames received from an interface, handled under a single take of _sem_rx
+    struct {
+        CanardCANFrame frame;
+        uint64_t timestamp_us;
+    } rx_batch[CANARD_RX_BATCH_SIZE];
+
+#if AP_DRONECAN_MSG_STATS_ENABLED
+    // statistics for one message or service type. Kept in small open
+    // addressed hash tables, keyed on data type ID and transfer type
+    struct MsgStats {
+        uint16_t data_type_id;
+        uint8_t transfer_type;
+        bool used;
+        uint32_t transfers;
+        uint32_t frames;
+        uint32_t errors;
+    };
+    static constexpr uint8_t MSG_STATS_SIZE = 32;
+    static_assert((MSG_STATS_SIZE & (MSG_STATS_SIZE-1)) == 0, "MSG_STATS_SIZE must be a power of 2");
+    static MsgStats *find_msg_stats(MsgStats *table, uint16_t data_type_id, uint8_t transfer_type);
+    static void print_msg_stats(ExpandingString &str, const char *dir, const MsgStats *table, HAL_Semaphore &sem);
+    // protected by _sem_rx
+    MsgStats rx_msg_stats[MSG_STATS_SIZE];
+    // protected by _sem_tx
+    MsgStats tx_msg_stats[MSG_STATS_SIZE];
+    // transfers of types that didn't fit in the tables
+    uint32_t rx_msg_stats_overflow;
+    uint32_t tx_msg_stats_overflow;
+
+    void update_tx_msg_stats(const CanardTxTransfer &transfer, int16_t ret);
+#endif
 };
 #endif // HAL_ENABLE_DRONECAN_DRIVERS
@@ -29,6 +29,9 @@
 
 #define ESC_RPM_CHECK_TIMEOUT_US 210000UL   // timeout for motor running validity
 
+// attempts at a consistent read of an ESC's rpm data before using what we have
+#define ESC_RPM_READ_TRIES 3
+
 extern const AP_HAL::HAL& hal;
 
 // table of user settable parameters
@@ -56,6 +59,109 @@ AP_ESC_Telem::AP_ESC_Telem()
 #endif
 }
 
+/*
+  take a consistent copy of an ESC's rpm data. update_rpm() makes the
+  sequence number odd while it changes the data, so retry if it was
+  being changed or changed while we copied it. A writer we have
+  preempted can't finish, so only a few attempts are made
+ */
+void AP_ESC_Telem::read_rpm_data(uint8_t esc_index, AP_ESC_Telem_Backend::RpmData &data) const
+{
+    const volatile AP_ESC_Telem_Backend::RpmData &rpmdata = _rpm_data[esc_index];
+    const std::atomic<uint32_t> &seq = _rpm_seq[esc_index];
+
+    for (uint8_t i = 0; i < ESC_RPM_READ_TRIES; i++) {
+        const uint32_t seq_start = seq.load(std::memory_order_acquire);
+        data.rpm = rpmdata.rpm;
+        data.prev_rpm = rpmdata.prev_rpm;
+        data.error_rate = rpmdata.error_rate;
+        data.last_update_us = rpmdata.last_update_us;
+        data.update_rate_hz = rpmdata.update_rate_hz;
+        data.data_valid = rpmdata.data_valid;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((seq_start & 1U) == 0 && seq.load(std::memory_order_relaxed) == seq_start) {
+            break;
+        }
+    }
+}
+
+// calculate the slewed rpm from a copy of an ESC's rpm data, returns true if the data is valid
+bool AP_ESC_Telem::calc_rpm(uint8_t esc_index, const AP_ESC_Telem_Backend::RpmData &rpmdata, uint32_t now_us, float& rpm) const
+{
+    if (is_zero(rpmdata.update_rate_hz)) {
+        return false;
+    }
+
+    if (!rpm_data_within_timeout(rpmdata, now_us, ESC_RPM_DATA_TIMEOUT_US)) {
+        return false;
+    }
+
+    const float slew = MIN(1.0f, (now_us - rpmdata.last_update_us) * rpmdata.update_rate_hz * (1.0f / 1e6f));
+    rpm = (rpmdata.prev_rpm + (rpmdata.rpm - rpmdata.prev_rpm) * slew);
+
+#if AP_SCRIPTING_ENABLED
+    if ((1U<<esc_index) & rpm_scale_mask) {
+        rpm *= rpm_scale_factor[esc_index];
+    }
+#endif
+
+    return true;
+}
+
+// fill in a snapshot of the rpm of all ESCs
+void AP_ESC_Telem::get_rpm_snapshot(RpmSnapshot &snapshot) const
+{
+    snapshot.reported_mask = _rpm_reported_mask.load(std::memory_order_acquire);
+    snapshot.valid_mask = 0;
+
+    const uint32_t now = AP_HAL::micros();
+    for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS; i++) {
+        if (!BIT_IS_SET(snapshot.reported_mask, i)) {
+            continue;
+        }
+        AP_ESC_Telem_Backend::RpmData rpmdata;
+        read_rpm_data(i, rpmdata);
+        if (calc_rpm(i, rpmdata, now, snapshot.rpm[i])) {
+            snapshot.valid_mask |= (1U << i);
+        }
+    }
+}
+
+// return the average rpm of the ESCs in servo_channel_mask that have valid data
+float AP_ESC_Telem::RpmSnapshot::get_average_motor_rpm(uint32_t servo_channel_mask) const
+{
+    const uint32_t mask = servo_channel_mask & valid_mask;
+    if (mask == 0) {
+        return 0.0f;
+    }
+
+    float rpm_sum = 0.0f;
+    for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS; i++) {
+        if (BIT_IS_SET(mask, i)) {
+            rpm_sum += rpm[i];
+        }
+    }
+    return rpm_sum / __builtin_popcount(mask);
+}
+
+// return the motor frequencies in Hz for dynamic filtering
+uint8_t AP_ESC_Telem::RpmSnapshot::get_motor_frequencies_hz(uint8_t nfreqs, float* freqs) const
+{
+    uint8_t valid_escs = 0;
+
+    for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS && valid_escs < nfreqs; i++) {
+        if (BIT_IS_SET(valid_mask, i)) {
+            freqs[valid_escs++] = rpm[i] * (1.0f / 60.0f);
+        } else if (BIT_IS_SET(reported_mask, i)) {
+            // if we have ever received data on an ESC, mark it as valid but with no data
+            // this prevents large frequency shifts when ESCs disappear
+            freqs[valid_escs++] = 0.0f;
+        }
+    }
+
+    return valid_escs;
+}
+
 // return the average motor RPM
 float AP_ESC_Telem::get_average_motor_rpm(uint32_t servo_channel_mask) const
 {
@@ -83,21 +189,9 @@ float AP_ESC_Telem::get_average_motor_rpm(uint32_t servo_channel_mask) const
 // return all the motor frequencies in Hz for dynamic filtering
 uint8_t AP_ESC_Telem::get_motor_frequencies_hz(uint8_t nfreqs, float* freqs) const
 {
-    uint8_t valid_escs = 0;
-
-    // average the rpm of each motor as reported by BLHeli and convert to Hz
-    for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS && valid_escs < nfreqs; i++) {
-        float rpm;
-        if (get_rpm(i, rpm)) {
-            freqs[valid_escs++] = rpm * (1.0f / 60.0f);
-        } else if (was_rpm_data_ever_reported(_rpm_data[i])) {
-            // if we have ever received data on an ESC, mark it as valid but with no data
-            // this prevents large frequency shifts when ESCs disappear
-            freqs[valid_escs++] = 0.0f;
-        }
-    }
-
-    return MIN(valid_escs, nfreqs);
+    RpmSnapshot snapshot;
+    get_rpm_snapshot(snapshot);
+    return snapshot.get_motor_frequencies_hz(nfreqs, freqs);
 }
 
 // get mask of ESCs that sent valid telemetry and/or rpm data in the last
@@ -133,7 +227,8 @@ bool AP_ESC_Telem::are_motors_running(uint32_t servo_channel_mask, float min_rpm
 
     for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS; i++) {
         if (BIT_IS_SET(servo_channel_mask, i)) {
-            const volatile AP_ESC_Telem_Backend::RpmData& rpmdata = _rpm_data[i];
+            AP_ESC_Telem_Backend::RpmData rpmdata;
+            read_rpm_data(i, rpmdata);
             // we choose a relatively strict measure of health so that failsafe actions can rely on the results
             if (!rpm_data_within_timeout(rpmdata, now, ESC_RPM_CHECK_TIMEOUT_US)) {
                 return false;
@@ -170,26 +265,10 @@ bool AP_ESC_Telem::get_rpm(uint8_t esc_index, float& rpm) const
         return false;
     }
 
-    const volatile AP_ESC_Telem_Backend::RpmData& rpmdata = _rpm_data[esc_index];
-
-    if (is_zero(rpmdata.update_rate_hz)) {
-        return false;
-    }
-
-    const uint32_t now = AP_HAL::micros();
-    if (rpm_data_within_timeout(rpmdata, now, ESC_RPM_DATA_TIMEOUT_US)) {
-        const float slew = MIN(1.0f, (now - rpmdata.last_update_us) * rpmdata.update_rate_hz * (1.0f / 1e6f));
-        rpm = (rpmdata.prev_rpm + (rpmdata.rpm - rpmdata.prev_rpm) * slew);
+    AP_ESC_Telem_Backend::RpmData rpmdata;
+    read_rpm_data(esc_index, rpmdata);
 
-#if AP_SCRIPTING_ENABLED
-        if ((1U<<esc_index) & rpm_scale_mask) {
-            rpm *= rpm_scale_factor[esc_index];
-        }
-#endif
-
-        return true;
-    }
-    return false;
+    return calc_rpm(esc_index, rpmdata, AP_HAL::micros(), rpm);
 }
 
 // get an individual ESC's raw rpm if available, returns true on success
@@ -480,6 +559,19 @@ void AP_ESC_Telem::update_rpm(const uint8_t esc_index, const float new_rpm, cons
 
     _have_data = true;
 
+    // rpm can come from several drivers (AP_RPM, BDShot, DroneCAN and
+    // scripting), and BDShot calls this from the rcout thread, which
+    // must not block. A writer claims the ESC by making the sequence
+    // number odd, and an update that finds another writer part way
+    // through is dropped, the next one will arrive shortly
+    std::atomic<uint32_t> &seq = _rpm_seq[esc_index];
+    uint32_t seq_start = seq.load(std::memory_order_relaxed);
+    if ((seq_start & 1U) != 0 ||
+        !seq.compare_exchange_strong(seq_start, seq_start + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
     const uint32_t now = MAX(1U ,AP_HAL::micros()); // don't allow a value of 0 in, as we use this as a flag in places
     volatile AP_ESC_Telem_Backend::RpmData& rpmdata = _rpm_data[esc_index];
     const auto last_update_us = rpmdata.last_update_us;
@@ -491,6 +583,9 @@ void AP_ESC_Telem::update_rpm(const uint8_t esc_index, const float new_rpm, cons
     rpmdata.error_rate = error_rate;
     rpmdata.data_valid = true;
 
+    seq.fetch_add(1, std::memory_order_release);
+    _rpm_reported_mask.fetch_or(1U << esc_index, std::memory_order_release);
+
 #ifdef ESC_TELEM_DEBUG
     hal.console->printf("RPM: rate=%.1fhz, rpm=%f)\n", rpmdata.update_rate_hz, new_rpm);
 #endif
@@ -547,7 +642,8 @@ void AP_ESC_Telem::update()
 
     const uint32_t now_us = AP_HAL::micros();
     for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS; i++) {
-        // Invalidate RPM data if not received for too long
+        // Invalidate RPM data if not received for too long. This is a
+        // single store so doesn't need to change the sequence number
         if ((now_us - _rpm_data[i].last_update_us) > ESC_RPM_DATA_TIMEOUT_US) {
             _rpm_data[i].data_valid = false;
         }
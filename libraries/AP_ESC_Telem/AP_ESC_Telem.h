@@ -7,6 +7,8 @@
 
 #if HAL_WITH_ESC_TELEM
 
+#include <atomic>
+
 #define ESC_TELEM_MAX_ESCS NUM_SERVO_CHANNELS
 static_assert(ESC_TELEM_MAX_ESCS > 0, "Cannot have 0 ESC telemetry instances");
 
@@ -16,6 +18,7 @@ static_assert(ESC_TELEM_MAX_ESCS > 0, "Cannot have 0 ESC telemetry instances");
 class AP_ESC_Telem {
 public:
     friend class AP_ESC_Telem_Backend;
+    friend class AP_ESC_Telem_Test;
 
     AP_ESC_Telem();
 
@@ -26,6 +29,28 @@ public:
 
     static AP_ESC_Telem *get_singleton();
 
+    /*
+      a consistent copy of the rpm of all ESCs, taken in one pass so
+      that consumers in the main loop see every ESC at the same time
+     */
+    class RpmSnapshot {
+    public:
+        // return the average rpm of the ESCs in servo_channel_mask that have valid data
+        float get_average_motor_rpm(uint32_t servo_channel_mask) const;
+
+        // return the motor frequencies in Hz for dynamic filtering, see AP_ESC_Telem::get_motor_frequencies_hz()
+        uint8_t get_motor_frequencies_hz(uint8_t nfreqs, float* freqs) const;
+
+    private:
+        friend class AP_ESC_Telem;
+        float rpm[ESC_TELEM_MAX_ESCS];  // slewed rpm, only set for ESCs in valid_mask
+        uint32_t valid_mask;            // ESCs with rpm data within the timeout
+        uint32_t reported_mask;         // ESCs that have ever reported rpm
+    };
+
+    // fill in a snapshot of the rpm of all ESCs
+    void get_rpm_snapshot(RpmSnapshot &snapshot) const;
+
     // get an individual ESC's slewed rpm if available, returns true on success
     bool get_rpm(uint8_t esc_index, float& rpm) const;
 
@@ -118,8 +143,18 @@ private:
     static bool rpm_data_within_timeout (const volatile AP_ESC_Telem_Backend::RpmData &instance, const uint32_t now_us, const uint32_t timeout_us);
     static bool was_rpm_data_ever_reported (const volatile AP_ESC_Telem_Backend::RpmData &instance);
 
+    // take a consistent copy of an ESC's rpm data
+    void read_rpm_data(uint8_t esc_index, AP_ESC_Telem_Backend::RpmData &data) const;
+
+    // calculate the slewed rpm from a copy of an ESC's rpm data, returns true if the data is valid
+    bool calc_rpm(uint8_t esc_index, const AP_ESC_Telem_Backend::RpmData &rpmdata, uint32_t now_us, float& rpm) const;
+
     // rpm data
     volatile AP_ESC_Telem_Backend::RpmData _rpm_data[ESC_TELEM_MAX_ESCS];
+    // sequence number for each ESC's rpm data, odd while update_rpm() is changing it
+    std::atomic<uint32_t> _rpm_seq[ESC_TELEM_MAX_ESCS] {};
+    // mask of ESCs that have ever reported rpm
+    std::atomic<uint32_t> _rpm_reported_mask {0};
     // telemetry data
     volatile AP_ESC_Telem_Backend::TelemetryData _telem_data[ESC_TELEM_MAX_ESCS];
 
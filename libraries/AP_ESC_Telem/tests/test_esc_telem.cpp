@@ -0,0 +1,152 @@
+#include <AP_gtest.h>
+
+#include <AP_ESC_Telem/AP_ESC_Telem.h>
+#include <AP_Math/AP_Math.h>
+
+const AP_HAL::HAL &hal = AP_HAL::get_HAL();
+
+#if HAL_WITH_ESC_TELEM
+
+static AP_ESC_Telem esc_telem;
+
+class AP_ESC_Telem_Test
+{
+public:
+    static uint32_t seq(uint8_t esc_index) {
+        return esc_telem._rpm_seq[esc_index].load();
+    }
+
+    // pretend another writer is part way through changing an ESC's rpm
+    static void begin_write(uint8_t esc_index) {
+        esc_telem._rpm_seq[esc_index]++;
+    }
+    static void end_write(uint8_t esc_index) {
+        esc_telem._rpm_seq[esc_index]++;
+    }
+
+    static void read_rpm_data(uint8_t esc_index, AP_ESC_Telem_Backend::RpmData &data) {
+        esc_telem.read_rpm_data(esc_index, data);
+    }
+
+    // forget the rpm of all ESCs left by earlier tests
+    static void reset() {
+        esc_telem._rpm_reported_mask = 0;
+        for (uint8_t i = 0; i < ESC_TELEM_MAX_ESCS; i++) {
+            esc_telem._rpm_data[i].update_rate_hz = 0;
+        }
+    }
+
+    // mark an ESC as having reported rpm without giving it any data
+    static void set_reported(uint8_t esc_index) {
+        esc_telem._rpm_reported_mask |= (1U << esc_index);
+    }
+};
+
+/*
+  give ESCs a steady rpm. Two updates close together give a high
+  update rate, so once a little time has passed the slewed rpm has
+  reached the latest value
+ */
+static void set_steady_rpm(uint8_t esc_index, float rpm)
+{
+    esc_telem.update_rpm(esc_index, rpm, 0);
+    esc_telem.update_rpm(esc_index, rpm, 0);
+}
+
+static void wait_for_slew()
+{
+    const uint32_t start_us = AP_HAL::micros();
+    while (AP_HAL::micros() - start_us < 200) {
+    }
+}
+
+TEST(AP_ESC_Telem, SeqlockRead)
+{
+    AP_ESC_Telem_Test::reset();
+    const uint32_t seq_start = AP_ESC_Telem_Test::seq(0);
+    EXPECT_EQ(seq_start & 1U, 0U);
+
+    esc_telem.update_rpm(0, 1000, 2.5);
+    EXPECT_EQ(AP_ESC_Telem_Test::seq(0), seq_start + 2);
+
+    AP_ESC_Telem_Backend::RpmData data {};
+    AP_ESC_Telem_Test::read_rpm_data(0, data);
+    EXPECT_FLOAT_EQ(data.rpm, 1000);
+    EXPECT_FLOAT_EQ(data.error_rate, 2.5);
+    EXPECT_TRUE(data.data_valid);
+    EXPECT_NE(data.last_update_us, 0U);
+
+    esc_telem.update_rpm(0, 1100, 0);
+    AP_ESC_Telem_Test::read_rpm_data(0, data);
+    EXPECT_FLOAT_EQ(data.prev_rpm, 1000);
+    EXPECT_FLOAT_EQ(data.rpm, 1100);
+}
+
+TEST(AP_ESC_Telem, ConcurrentWriterDropped)
+{
+    AP_ESC_Telem_Test::reset();
+    set_steady_rpm(1, 2000);
+
+    // an update while another writer holds the ESC is dropped rather than waiting
+    AP_ESC_Telem_Test::begin_write(1);
+    const uint32_t seq_held = AP_ESC_Telem_Test::seq(1);
+    esc_telem.update_rpm(1, 3000, 0);
+    EXPECT_EQ(AP_ESC_Telem_Test::seq(1), seq_held);
+    AP_ESC_Telem_Test::end_write(1);
+
+    AP_ESC_Telem_Backend::RpmData data {};
+    AP_ESC_Telem_Test::read_rpm_data(1, data);
+    EXPECT_FLOAT_EQ(data.rpm, 2000);
+
+    // once the writer has finished updates are accepted again
+    esc_telem.update_rpm(1, 3000, 0);
+    AP_ESC_Telem_Test::read_rpm_data(1, data);
+    EXPECT_FLOAT_EQ(data.rpm, 3000);
+}
+
+TEST(AP_ESC_Telem, SnapshotAverageRpm)
+{
+    AP_ESC_Telem_Test::reset();
+    set_steady_rpm(4, 1000);
+    set_steady_rpm(5, 2000);
+    set_steady_rpm(6, 4000);
+    wait_for_slew();
+
+    AP_ESC_Telem::RpmSnapshot snapshot;
+    esc_telem.get_rpm_snapshot(snapshot);
+
+    EXPECT_FLOAT_EQ(snapshot.get_average_motor_rpm(1U<<4), 1000);
+    EXPECT_FLOAT_EQ(snapshot.get_average_motor_rpm((1U<<4) | (1U<<5)), 1500);
+    EXPECT_FLOAT_EQ(snapshot.get_average_motor_rpm((1U<<4) | (1U<<5) | (1U<<6)), 7000.0f / 3);
+    // ESCs without data are left out of the average
+    EXPECT_FLOAT_EQ(snapshot.get_average_motor_rpm((1U<<5) | (1U<<20)), 2000);
+    EXPECT_FLOAT_EQ(snapshot.get_average_motor_rpm(1U<<20), 0);
+}
+
+TEST(AP_ESC_Telem, SnapshotMotorFrequencies)
+{
+    AP_ESC_Telem_Test::reset();
+    set_steady_rpm(8, 600);
+    set_steady_rpm(10, 1200);
+    // reported once but no valid data, so it is given a frequency of zero
+    AP_ESC_Telem_Test::set_reported(9);
+    wait_for_slew();
+
+    AP_ESC_Telem::RpmSnapshot snapshot;
+    esc_telem.get_rpm_snapshot(snapshot);
+
+    float freqs[ESC_TELEM_MAX_ESCS];
+    const uint8_t nfreqs = snapshot.get_motor_frequencies_hz(ARRAY_SIZE(freqs), freqs);
+
+    ASSERT_EQ(nfreqs, 3U);
+    EXPECT_FLOAT_EQ(freqs[0], 10);
+    EXPECT_FLOAT_EQ(freqs[1], 0);
+    EXPECT_FLOAT_EQ(freqs[2], 20);
+
+    // the number of frequencies returned is limited by the space given
+    EXPECT_EQ(snapshot.get_motor_frequencies_hz(2, freqs), 2U);
+}
+
+#endif  // HAL_WITH_ESC_TELEM
+
+AP_GTEST_MAIN()
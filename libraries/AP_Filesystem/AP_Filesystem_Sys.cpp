@@ -26,6 +26,8 @@
 #include <AP_CANManager/AP_CANManager.h>
 #include <AP_Scheduler/AP_Scheduler.h>
 #include <AP_Common/ExpandingString.h>
+#include <AP_Scripting/AP_Scripting.h>
+#include <AP_DroneCAN/AP_DroneCAN.h>
 
 extern const AP_HAL::HAL& hal;
 
@@ -40,6 +42,7 @@ static const SysFileList sysfs_file_list[] = {
     {"memory.txt"},
     {"uarts.txt"},
     {"timers.txt"},
+    {"storage_stats.txt"},
 #if HAL_MAX_CAN_PROTOCOL_DRIVERS
     {"can_log.txt"},
 #endif
@@ -47,8 +50,14 @@ static const SysFileList sysfs_file_list[] = {
     {"can0_stats.txt"},
     {"can1_stats.txt"},
 #endif
+#if HAL_ENABLE_DRONECAN_DRIVERS && AP_DRONECAN_MSG_STATS_ENABLED
+    {"dronecan_msgs.txt"},
+#endif
 #if !defined(HAL_BOOTLOADER_BUILD) && (defined(STM32F7) || defined(STM32H7))
     {"persistent.parm"},
+#endif
+#if AP_SCRIPTING_ENABLED
+    {"scripts.txt"},
 #endif
     {"crash_dump.bin"},
     {"storage.bin"},
@@ -120,11 +129,22 @@ int AP_Filesystem_Sys::open(const char *fname, int flags, bool allow_absolute_pa
     if (strcmp(fname, "timers.txt") == 0) {
         hal.util->timer_info(*r.str);
     }
+    if (strcmp(fname, "storage_stats.txt") == 0) {
+        hal.storage->get_stats(*r.str);
+    }
 #if HAL_CANMANAGER_ENABLED
     if (strcmp(fname, "can_log.txt") == 0) {
         AP::can().log_retrieve(*r.str);
     }
 #endif
+#if AP_SCRIPTING_ENABLED
+    if (strcmp(fname, "scripts.txt") == 0) {
+        AP_Scripting *scripting = AP_Scripting::get_singleton();
+        if (scripting != nullptr) {
+            scripting->scripts_info(*r.str);
+        }
+    }
+#endif
 #if HAL_NUM_CAN_IFACES > 0
     int8_t can_stats_num = -1;
     if (strcmp(fname, "can0_stats.txt") == 0) {
@@ -137,6 +157,17 @@ int AP_Filesystem_Sys::open(const char *fname, int flags, bool allow_absolute_pa
             hal.can[can_stats_num]->get_stats(*r.str);
         }
     }
+#endif
+#if HAL_ENABLE_DRONECAN_DRIVERS && AP_DRONECAN_MSG_STATS_ENABLED
+    if (strcmp(fname, "dronecan_msgs.txt") == 0) {
+        for (uint8_t i = 0; i < HAL_MAX_CAN_PROTOCOL_DRIVERS; i++) {
+            AP_DroneCAN *dronecan = AP_DroneCAN::get_dronecan(i);
+            if (dronecan != nullptr) {
+                r.str->printf("DroneCAN%u\n", unsigned(i+1));
+                dronecan->get_canard_iface().msg_stats_info(*r.str);
+            }
+        }
+    }
 #endif
     if (strcmp(fname, "persistent.parm") == 0) {
         hal.util->load_persistent_params(*r.str);
@@ -58,19 +58,27 @@ extern const AP_HAL::HAL& hal;
 
 bool AP_GPS_NMEA::read(void)
 {
-    int16_t numc;
     bool parsed = false;
 
     send_config();
 
-    numc = port->available();
-    while (numc--) {
-        char c = port->read();
+    // read in blocks rather than a byte at a time, as each UART read
+    // takes a lock
+    uint32_t numc = port->available();
+    uint8_t buf[64];
+    while (numc > 0) {
+        const ssize_t nread = port->read(buf, MIN(numc, sizeof(buf)));
+        if (nread <= 0) {
+            break;
+        }
 #if AP_GPS_DEBUG_LOGGING_ENABLED
-        log_data((const uint8_t *)&c, 1);
+        log_data(buf, nread);
 #endif
-        if (_decode(c)) {
-            parsed = true;
+        numc -= nread;
+        for (uint8_t i = 0; i < nread; i++) {
+            if (_decode(buf[i])) {
+                parsed = true;
+            }
         }
     }
     return parsed;
@@ -639,17 +639,74 @@ AP_GPS_UBLOX::read(void)
         }
     }
 
-    const uint16_t numc = MIN(port->available(), 8192U);
-    for (uint16_t i = 0; i < numc; i++) {        // Process bytes received
-
-        // read the next byte
-        uint8_t data;
-        if (!port->read(data)) {
+    // bytes are read from the UART in blocks and parsed from
+    // _rx_buf. Any left over when we stop early for a RTCMv3 packet
+    // are parsed on the next call
+    uint16_t numc = MIN(port->available(), 8192U);
+    while (true) {
+        if (_rx_ofs >= _rx_len) {
+            if (numc == 0) {
+                break;
+            }
+            const ssize_t nread = port->read(_rx_buf, MIN(numc, sizeof(_rx_buf)));
+            if (nread <= 0) {
+                break;
+            }
+#if AP_GPS_DEBUG_LOGGING_ENABLED
+            log_data(_rx_buf, nread);
+#endif
+            numc -= nread;
+            _rx_len = nread;
+            _rx_ofs = 0;
+        }
+        uint8_t used;
+        const bool keep_going = _parse_bytes(&_rx_buf[_rx_ofs], _rx_len - _rx_ofs, used, parsed);
+        _rx_ofs += used;
+        if (!keep_going) {
             break;
         }
-#if AP_GPS_DEBUG_LOGGING_ENABLED
-        log_data(&data, 1);
+    }
+    return parsed;
+}
+
+/*
+  run the parser over a block of received bytes. used is set to the
+  number of bytes consumed and parsed is set true if a message was
+  parsed. Returns false if parsing needs to stop so a RTCMv3 packet can
+  be handled
+ */
+bool
+AP_GPS_UBLOX::_parse_bytes(const uint8_t *bytes, uint8_t len, uint8_t &used, bool &parsed)
+{
+    uint8_t i = 0;
+    while (i < len) {
+#if GPS_MOVING_BASELINE
+        if (rtcm3_parser == nullptr)
 #endif
+        {
+            if (_step == 0) {
+                // skip straight to the next possible start of a message
+                const uint8_t *preamble = (const uint8_t *)memchr(&bytes[i], PREAMBLE1, len - i);
+                if (preamble == nullptr) {
+                    break;
+                }
+                i = preamble - bytes;
+            } else if (_step == 6) {
+                // take as much of the payload as we have in one go
+                const uint16_t count = MIN(uint16_t(len - i), uint16_t(_payload_length - _payload_counter));
+                _update_checksum(&bytes[i], count, _ck_a, _ck_b);
+                memcpy(&_buffer[_payload_counter], &bytes[i], count);
+                _payload_counter += count;
+                i += count;
+                if (_payload_counter == _payload_length) {
+                    _step++;
+                }
+                continue;
+            }
+        }
+
+        // the next byte
+        const uint8_t data = bytes[i++];
 
 #if GPS_MOVING_BASELINE
         if (rtcm3_parser) {
@@ -660,7 +717,8 @@ AP_GPS_UBLOX::read(void)
                 // chance to send the RTCMv3 packet to another (rover)
                 // GPS
                 _step = 0;
-                break;
+                used = i;
+                return false;
             }
         }
 #endif
@@ -773,7 +831,8 @@ AP_GPS_UBLOX::read(void)
             break;
         }
     }
-    return parsed;
+    used = len;
+    return true;
 }
 
 // Private Methods /////////////////////////////////////////////////////////////
@@ -1781,7 +1840,7 @@ AP_GPS_UBLOX::set_pps_desired_freq(uint8_t freq)
  *  update checksum for a set of bytes
  */
 void
-AP_GPS_UBLOX::_update_checksum(uint8_t *data, uint16_t len, uint8_t &ck_a, uint8_t &ck_b)
+AP_GPS_UBLOX::_update_checksum(const uint8_t *data, uint16_t len, uint8_t &ck_a, uint8_t &ck_b)
 {
     while (len--) {
         ck_a += *data;
@@ -69,6 +69,11 @@
 
 #define UBLOX_MAX_PORTS 6
 
+// bytes are read from the UART in blocks of up to this many, at most 255
+#ifndef UBLOX_RX_CHUNK_SIZE
+#define UBLOX_RX_CHUNK_SIZE 64
+#endif
+
 #define RATE_POSLLH 1
 #define RATE_STATUS 1
 #define RATE_SOL 1
@@ -123,6 +128,9 @@ class RTCM3_Parser;
 
 class AP_GPS_UBLOX : public AP_GPS_Backend
 {
+    friend class AP_GPS_UBLOX_Bench;
+    friend class AP_GPS_UBLOX_Test;
+
 public:
     AP_GPS_UBLOX(AP_GPS &_gps, AP_GPS::Params &_params, AP_GPS::GPS_State &_state, AP_HAL::UARTDriver *_port, AP_GPS::GPS_Role role);
     ~AP_GPS_UBLOX() override;
@@ -760,6 +768,12 @@ private:
     uint8_t         _class;
     bool            _cfg_saved;
 
+    // bytes read from the UART that have not been parsed yet
+    uint8_t         _rx_buf[UBLOX_RX_CHUNK_SIZE];
+    uint8_t         _rx_len;
+    uint8_t         _rx_ofs;
+    static_assert(UBLOX_RX_CHUNK_SIZE <= UINT8_MAX, "UBLOX_RX_CHUNK_SIZE must fit in _rx_len");
+
     uint32_t        _last_vel_time;
     uint32_t        _last_pos_time;
     uint32_t        _last_cfg_sent_time;
@@ -803,7 +817,8 @@ private:
     bool        _configure_valget(ConfigKey key);
     void        _configure_rate(void);
     void        _configure_sbas(bool enable);
-    void        _update_checksum(uint8_t *data, uint16_t len, uint8_t &ck_a, uint8_t &ck_b);
+    static void _update_checksum(const uint8_t *data, uint16_t len, uint8_t &ck_a, uint8_t &ck_b);
+    bool        _parse_bytes(const uint8_t *bytes, uint8_t len, uint8_t &used, bool &parsed);
     bool        _send_message(uint8_t msg_class, uint8_t msg_id, const void *msg, uint16_t size);
     void	send_next_rate_update(void);
     bool        _request_message_rate(uint8_t msg_class, uint8_t msg_id);
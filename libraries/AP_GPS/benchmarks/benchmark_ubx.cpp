@@ -0,0 +1,205 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_GPS/AP_GPS.h>
+#include <AP_GPS/AP_GPS_UBLOX.h>
+#include <AP_GPS/RTCM3_Parser.h>
+#include <AP_GPS/tests/buffer_uart.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#if AP_GPS_UBLOX_ENABLED
+
+// a second of 10Hz NAV-PVT messages, as SIM_GPS_UBLOX sends them
+#define NUM_MESSAGES 10
+#define PVT_PAYLOAD_LEN 92
+#define FRAME_LEN (6 + PVT_PAYLOAD_LEN + 2)
+
+typedef BufferUart<NUM_MESSAGES * FRAME_LEN> StreamUart;
+
+static AP_GPS gps;
+static AP_GPS::Params params;
+
+class AP_GPS_UBLOX_Bench
+{
+public:
+    static void make_stream(uint8_t *stream) {
+        static_assert(sizeof(AP_GPS_UBLOX::ubx_nav_pvt) == PVT_PAYLOAD_LEN, "unexpected NAV-PVT length");
+        for (uint16_t m=0; m<NUM_MESSAGES; m++) {
+            AP_GPS_UBLOX::ubx_nav_pvt pvt {};
+            pvt.itow = 123456000 + m * 100;
+            pvt.fix_type = 3;
+            pvt.flags = 1;
+            pvt.num_sv = 17;
+            pvt.lon = 1491652300 + m * 10;
+            pvt.lat = -353632610 - m * 10;
+            pvt.h_ellipsoid = 604000;
+            pvt.h_msl = 584000;
+            pvt.h_acc = 1200;
+            pvt.v_acc = 1800;
+            pvt.velN = 1500;
+            pvt.velE = -250;
+            pvt.velD = 40;
+            pvt.gspeed = 1520;
+            pvt.head_mot = 3500000;
+            pvt.s_acc = 300;
+            pvt.head_acc = 500000;
+            pvt.p_dop = 130;
+
+            uint8_t *frame = &stream[m * FRAME_LEN];
+            frame[0] = AP_GPS_UBLOX::PREAMBLE1;
+            frame[1] = AP_GPS_UBLOX::PREAMBLE2;
+            frame[2] = AP_GPS_UBLOX::CLASS_NAV;
+            frame[3] = AP_GPS_UBLOX::MSG_PVT;
+            frame[4] = sizeof(pvt) & 0xFF;
+            frame[5] = sizeof(pvt) >> 8;
+            memcpy(&frame[6], &pvt, sizeof(pvt));
+            uint8_t ck_a = 0, ck_b = 0;
+            AP_GPS_UBLOX::_update_checksum(&frame[2], 4 + sizeof(pvt), ck_a, ck_b);
+            frame[FRAME_LEN-2] = ck_a;
+            frame[FRAME_LEN-1] = ck_b;
+        }
+    }
+
+    /*
+      the receive loop of read() as it was before bytes were read from
+      the UART in blocks, kept here as the baseline for the benchmark
+     */
+    static bool read_bytewise(AP_GPS_UBLOX &ublox) {
+        bool parsed = false;
+        const uint16_t numc = MIN(ublox.port->available(), 8192U);
+        for (uint16_t i = 0; i < numc; i++) {
+            uint8_t data;
+            if (!ublox.port->read(data)) {
+                break;
+            }
+
+#if GPS_MOVING_BASELINE
+            if (ublox.rtcm3_parser) {
+                if (ublox.rtcm3_parser->read(data)) {
+                    ublox._step = 0;
+                    break;
+                }
+            }
+#endif
+
+        reset:
+            switch (ublox._step) {
+            case 1:
+                if (AP_GPS_UBLOX::PREAMBLE2 == data) {
+                    ublox._step++;
+                    break;
+                }
+                ublox._step = 0;
+                FALLTHROUGH;
+            case 0:
+                if (AP_GPS_UBLOX::PREAMBLE1 == data) {
+                    ublox._step++;
+                }
+                break;
+            case 2:
+                ublox._step++;
+                ublox._class = data;
+                ublox._ck_b = ublox._ck_a = data;
+                break;
+            case 3:
+                ublox._step++;
+                ublox._ck_b += (ublox._ck_a += data);
+                ublox._msg_id = data;
+                break;
+            case 4:
+                ublox._step++;
+                ublox._ck_b += (ublox._ck_a += data);
+                ublox._payload_length = data;
+                break;
+            case 5:
+                ublox._step++;
+                ublox._ck_b += (ublox._ck_a += data);
+                ublox._payload_length += (uint16_t)(data<<8);
+                if (ublox._payload_length > sizeof(ublox._buffer)) {
+                    ublox._payload_length = 0;
+                    ublox._step = 0;
+                    goto reset;
+                }
+                ublox._payload_counter = 0;
+                if (ublox._payload_length == 0) {
+                    ublox._step++;
+                }
+                break;
+            case 6:
+                ublox._ck_b += (ublox._ck_a += data);
+                if (ublox._payload_counter < sizeof(ublox._buffer)) {
+                    ublox._buffer[ublox._payload_counter] = data;
+                }
+                if (++ublox._payload_counter == ublox._payload_length) {
+                    ublox._step++;
+                }
+                break;
+            case 7:
+                ublox._step++;
+                if (ublox._ck_a != data) {
+                    ublox._step = 0;
+                    goto reset;
+                }
+                break;
+            case 8:
+                ublox._step = 0;
+                if (ublox._ck_b != data) {
+                    break;
+                }
+#if GPS_MOVING_BASELINE
+                if (ublox.rtcm3_parser) {
+                    ublox.rtcm3_parser->reset();
+                }
+#endif
+                if (ublox._parse_gps()) {
+                    parsed = true;
+                }
+                break;
+            }
+        }
+        return parsed;
+    }
+};
+
+static void BM_UBXReadBytewise(benchmark::State& state)
+{
+    uint8_t stream[NUM_MESSAGES * FRAME_LEN];
+    AP_GPS_UBLOX_Bench::make_stream(stream);
+
+    AP_GPS::GPS_State gps_state {};
+    StreamUart *uart = new StreamUart();
+    AP_GPS_UBLOX *ublox = new AP_GPS_UBLOX(gps, params, gps_state, uart, AP_GPS::GPS_ROLE_NORMAL);
+    bool parsed = false;
+    while (state.KeepRunning()) {
+        uart->push(stream, sizeof(stream));
+        parsed |= AP_GPS_UBLOX_Bench::read_bytewise(*ublox);
+        gbenchmark_escape(&parsed);
+    }
+    delete ublox;
+    delete uart;
+}
+
+static void BM_UBXRead(benchmark::State& state)
+{
+    uint8_t stream[NUM_MESSAGES * FRAME_LEN];
+    AP_GPS_UBLOX_Bench::make_stream(stream);
+
+    AP_GPS::GPS_State gps_state {};
+    StreamUart *uart = new StreamUart();
+    AP_GPS_UBLOX *ublox = new AP_GPS_UBLOX(gps, params, gps_state, uart, AP_GPS::GPS_ROLE_NORMAL);
+    bool parsed = false;
+    while (state.KeepRunning()) {
+        uart->push(stream, sizeof(stream));
+        parsed |= ublox->read();
+        gbenchmark_escape(&parsed);
+    }
+    delete ublox;
+    delete uart;
+}
+
+BENCHMARK(BM_UBXReadBytewise);
+BENCHMARK(BM_UBXRead);
+
+#endif  // AP_GPS_UBLOX_ENABLED
+
+BENCHMARK_MAIN();
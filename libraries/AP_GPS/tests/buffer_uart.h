@@ -0,0 +1,49 @@
+#pragma once
+
+#include <AP_HAL/AP_HAL.h>
+#include <AP_Math/AP_Math.h>
+
+/*
+  UART returning bytes queued by a test or benchmark, holding up to
+  SIZE unread bytes. Like the drivers it must be allocated with new,
+  which zero fills the base class state
+ */
+template <uint16_t SIZE>
+class BufferUart : public AP_HAL::UARTDriver {
+public:
+    bool is_initialized() override { return true; }
+    bool tx_pending() override { return false; }
+    uint32_t txspace() override { return 1024; }
+
+    // queue bytes after any that have not been read yet
+    void push(const uint8_t *data, uint16_t len) {
+        memmove(buf, &buf[buf_ofs], buf_len - buf_ofs);
+        buf_len -= buf_ofs;
+        buf_ofs = 0;
+        len = MIN(len, sizeof(buf) - buf_len);
+        memcpy(&buf[buf_len], data, len);
+        buf_len += len;
+    }
+
+protected:
+    uint32_t _available() override { return buf_len - buf_ofs; }
+    void _begin(uint32_t baud, uint16_t rxSpace, uint16_t txSpace) override {}
+    void _end() override {}
+    void _flush() override {}
+    size_t _write(const uint8_t *buffer, size_t size) override { return size; }
+    ssize_t _read(uint8_t *buffer, uint16_t count) override {
+        const uint16_t n = MIN(count, uint16_t(buf_len - buf_ofs));
+        memcpy(buffer, &buf[buf_ofs], n);
+        buf_ofs += n;
+        return n;
+    }
+    bool _discard_input() override {
+        buf_len = buf_ofs = 0;
+        return true;
+    }
+
+private:
+    uint8_t buf[SIZE];
+    uint16_t buf_len = 0;
+    uint16_t buf_ofs = 0;
+};
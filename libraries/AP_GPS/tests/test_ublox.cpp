@@ -0,0 +1,228 @@
+#include <AP_gtest.h>
+
+#include <AP_GPS/AP_GPS.h>
+#include <AP_GPS/AP_GPS_UBLOX.h>
+#include <AP_Math/AP_Math.h>
+
+#include "buffer_uart.h"
+
+const AP_HAL::HAL &hal = AP_HAL::get_HAL();
+
+#if AP_GPS_UBLOX_ENABLED
+
+typedef BufferUart<512> TestUart;
+
+static AP_GPS gps;
+static AP_GPS::Params params;
+
+class AP_GPS_UBLOX_Test
+{
+public:
+    // frame a UBX message, returning the frame length
+    static uint16_t make_frame(uint8_t msg_class, uint8_t msg_id, const void *payload, uint16_t len, uint8_t *frame) {
+        frame[0] = AP_GPS_UBLOX::PREAMBLE1;
+        frame[1] = AP_GPS_UBLOX::PREAMBLE2;
+        frame[2] = msg_class;
+        frame[3] = msg_id;
+        frame[4] = len & 0xFF;
+        frame[5] = len >> 8;
+        memcpy(&frame[6], payload, len);
+        uint8_t ck_a = 0, ck_b = 0;
+        AP_GPS_UBLOX::_update_checksum(&frame[2], 4 + len, ck_a, ck_b);
+        frame[6+len] = ck_a;
+        frame[7+len] = ck_b;
+        return len + 8;
+    }
+
+    static uint16_t make_pvt(uint8_t *frame) {
+        AP_GPS_UBLOX::ubx_nav_pvt pvt {};
+        pvt.itow = 123456000;
+        pvt.fix_type = 3;
+        pvt.flags = 1;
+        pvt.num_sv = 17;
+        pvt.lon = 1491652300;
+        pvt.lat = -353632610;
+        pvt.h_ellipsoid = 604000;
+        pvt.h_msl = 584000;
+        pvt.h_acc = 1200;
+        pvt.v_acc = 1800;
+        pvt.velN = 1500;
+        pvt.velE = -250;
+        pvt.velD = 40;
+        pvt.gspeed = 1520;
+        pvt.head_mot = 3500000;
+        pvt.s_acc = 300;
+        pvt.head_acc = 500000;
+        pvt.p_dop = 130;
+        return make_frame(AP_GPS_UBLOX::CLASS_NAV, AP_GPS_UBLOX::MSG_PVT, &pvt, sizeof(pvt), frame);
+    }
+
+    static AP_GPS_UBLOX::ubx_nav_dop dop_payload(void) {
+        AP_GPS_UBLOX::ubx_nav_dop dop {};
+        dop.itow = 123456000;
+        dop.gDOP = 180;
+        dop.pDOP = 150;
+        dop.tDOP = 90;
+        dop.vDOP = 140;
+        dop.hDOP = 110;
+        dop.nDOP = 70;
+        dop.eDOP = 80;
+        return dop;
+    }
+
+    static uint16_t make_dop(uint8_t *frame) {
+        const AP_GPS_UBLOX::ubx_nav_dop dop = dop_payload();
+        return make_frame(AP_GPS_UBLOX::CLASS_NAV, AP_GPS_UBLOX::MSG_DOP, &dop, sizeof(dop), frame);
+    }
+
+    /*
+      feed bytes through the parser one at a time, which runs the byte
+      at a time state machine as read() did before reading in blocks
+     */
+    static void parse_bytewise(AP_GPS_UBLOX &ublox, const uint8_t *bytes, uint16_t len) {
+        for (uint16_t i=0; i<len; i++) {
+            uint8_t used;
+            bool parsed;
+            ublox._parse_bytes(&bytes[i], 1, used, parsed);
+            ublox.clear_RTCMV3();
+        }
+    }
+
+    // check the last message parsed was the DOP message
+    static void expect_last_message_dop(const AP_GPS_UBLOX &ublox) {
+        const AP_GPS_UBLOX::ubx_nav_dop dop = dop_payload();
+        EXPECT_EQ(ublox._class, AP_GPS_UBLOX::CLASS_NAV);
+        EXPECT_EQ(ublox._msg_id, AP_GPS_UBLOX::MSG_DOP);
+        EXPECT_EQ(ublox._payload_length, sizeof(dop));
+        EXPECT_EQ(memcmp(&ublox._buffer, &dop, sizeof(dop)), 0);
+    }
+
+    // true if bytes read from the UART are waiting to be parsed
+    static bool rx_pending(const AP_GPS_UBLOX &ublox) {
+        return ublox._rx_ofs < ublox._rx_len;
+    }
+};
+
+static void expect_same_state(const AP_GPS::GPS_State &a, const AP_GPS::GPS_State &b)
+{
+    EXPECT_EQ(a.status, b.status);
+    EXPECT_EQ(a.time_week_ms, b.time_week_ms);
+    EXPECT_EQ(a.location.lat, b.location.lat);
+    EXPECT_EQ(a.location.lng, b.location.lng);
+    EXPECT_EQ(a.location.alt, b.location.alt);
+    EXPECT_EQ(a.num_sats, b.num_sats);
+    EXPECT_EQ(a.hdop, b.hdop);
+    EXPECT_EQ(a.vdop, b.vdop);
+    EXPECT_EQ(a.velocity, b.velocity);
+    EXPECT_EQ(a.ground_speed, b.ground_speed);
+    EXPECT_EQ(a.horizontal_accuracy, b.horizontal_accuracy);
+}
+
+// messages split across the boundaries of the blocks read from the UART
+TEST(AP_GPS_UBLOX, ChunkBoundaries)
+{
+    for (uint16_t prefix=0; prefix<=UBLOX_RX_CHUNK_SIZE; prefix++) {
+        // noise, a PVT message, a false preamble and a DOP message
+        uint8_t stream[UBLOX_RX_CHUNK_SIZE + 256];
+        uint16_t len = 0;
+        memset(stream, 0x55, prefix);
+        len += prefix;
+        len += AP_GPS_UBLOX_Test::make_pvt(&stream[len]);
+        stream[len++] = 0xB5;
+        stream[len++] = 0x00;
+        stream[len++] = 0x62;
+        len += AP_GPS_UBLOX_Test::make_dop(&stream[len]);
+
+        AP_GPS::GPS_State ref_state {};
+        TestUart *ref_uart = new TestUart();
+        AP_GPS_UBLOX *ref = new AP_GPS_UBLOX(gps, params, ref_state, ref_uart, AP_GPS::GPS_ROLE_NORMAL);
+        ASSERT_NE(ref, nullptr);
+        AP_GPS_UBLOX_Test::parse_bytewise(*ref, stream, len);
+        AP_GPS_UBLOX_Test::expect_last_message_dop(*ref);
+        delete ref;
+        delete ref_uart;
+
+        for (uint16_t split=0; split<=len; split++) {
+            AP_GPS::GPS_State state {};
+            TestUart *uart = new TestUart();
+            AP_GPS_UBLOX *ublox = new AP_GPS_UBLOX(gps, params, state, uart, AP_GPS::GPS_ROLE_NORMAL);
+            ASSERT_NE(ublox, nullptr);
+            uart->push(stream, split);
+            bool parsed = ublox->read();
+            uart->push(&stream[split], len - split);
+            parsed |= ublox->read();
+            EXPECT_TRUE(parsed);
+            EXPECT_EQ(uart->available(), 0U);
+            EXPECT_FALSE(AP_GPS_UBLOX_Test::rx_pending(*ublox));
+            AP_GPS_UBLOX_Test::expect_last_message_dop(*ublox);
+            expect_same_state(state, ref_state);
+            delete ublox;
+            delete uart;
+        }
+    }
+}
+
+#if GPS_MOVING_BASELINE
+/*
+  as a moving baseline base, parsing stops after each RTCMv3 packet and
+  the rest of the block read from the UART is parsed on the next call
+ */
+TEST(AP_GPS_UBLOX, RTCMLeftover)
+{
+    uint8_t rtcm[14] { 0xD3, 0x00, 0x08, 0x3E, 0xD0, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+    const uint32_t crc = crc_crc24(rtcm, sizeof(rtcm) - 3);
+    rtcm[11] = crc >> 16;
+    rtcm[12] = crc >> 8;
+    rtcm[13] = crc;
+
+    for (uint16_t prefix=0; prefix<=UBLOX_RX_CHUNK_SIZE; prefix++) {
+        uint8_t stream[UBLOX_RX_CHUNK_SIZE + 256];
+        uint16_t len = 0;
+        memset(stream, 0x55, prefix);
+        len += prefix;
+        memcpy(&stream[len], rtcm, sizeof(rtcm));
+        len += sizeof(rtcm);
+        const uint16_t rtcm_end = len;
+        len += AP_GPS_UBLOX_Test::make_pvt(&stream[len]);
+        len += AP_GPS_UBLOX_Test::make_dop(&stream[len]);
+
+        AP_GPS::GPS_State ref_state {};
+        TestUart *ref_uart = new TestUart();
+        AP_GPS_UBLOX *ref = new AP_GPS_UBLOX(gps, params, ref_state, ref_uart, AP_GPS::GPS_ROLE_MB_BASE);
+        ASSERT_NE(ref, nullptr);
+        AP_GPS_UBLOX_Test::parse_bytewise(*ref, stream, len);
+        delete ref;
+        delete ref_uart;
+
+        AP_GPS::GPS_State state {};
+        TestUart *uart = new TestUart();
+        AP_GPS_UBLOX *ublox = new AP_GPS_UBLOX(gps, params, state, uart, AP_GPS::GPS_ROLE_MB_BASE);
+        ASSERT_NE(ublox, nullptr);
+        uart->push(stream, len);
+
+        // the first call stops at the end of the RTCMv3 packet
+        EXPECT_FALSE(ublox->read());
+        const uint8_t *bytes;
+        uint16_t rtcm_len;
+        ASSERT_TRUE(ublox->get_RTCMV3(bytes, rtcm_len));
+        ASSERT_EQ(rtcm_len, sizeof(rtcm));
+        EXPECT_EQ(memcmp(bytes, rtcm, sizeof(rtcm)), 0);
+        ublox->clear_RTCMV3();
+        EXPECT_EQ(AP_GPS_UBLOX_Test::rx_pending(*ublox), (rtcm_end % UBLOX_RX_CHUNK_SIZE) != 0);
+
+        // the next call picks up the bytes left in the block
+        EXPECT_TRUE(ublox->read());
+        EXPECT_EQ(uart->available(), 0U);
+        EXPECT_FALSE(AP_GPS_UBLOX_Test::rx_pending(*ublox));
+        EXPECT_FALSE(ublox->get_RTCMV3(bytes, rtcm_len));
+        AP_GPS_UBLOX_Test::expect_last_message_dop(*ublox);
+        expect_same_state(state, ref_state);
+        delete ublox;
+        delete uart;
+    }
+}
+#endif // GPS_MOVING_BASELINE
+
+#endif // AP_GPS_UBLOX_ENABLED
+
+AP_GTEST_MAIN()
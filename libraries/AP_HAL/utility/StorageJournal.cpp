@@ -0,0 +1,216 @@
+/*
+ * This file is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+  write-ahead journal for file backed storage on Linux and SITL
+ */
+#include "StorageJournal.h"
+
+#if AP_HAL_STORAGE_JOURNAL_ENABLED
+
+#include <AP_HAL/AP_HAL.h>
+#include <AP_Math/AP_Math.h>
+#include <AP_Common/ExpandingString.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+StorageJournal::StorageJournal(uint8_t *buffer, uint32_t size) :
+    storage_buffer(buffer),
+    storage_size(size)
+{
+}
+
+StorageJournal::~StorageJournal()
+{
+    if (fd != -1) {
+        close(fd);
+    }
+    free(batch);
+}
+
+bool StorageJournal::init(const char *journal_path, int _storage_fd, bool fresh)
+{
+    if (fd != -1) {
+        return true;
+    }
+    batch_size = sizeof(Header) + MAX_RANGES*sizeof(Range) + storage_size;
+    batch = (uint8_t *)malloc(batch_size);
+    if (batch == nullptr) {
+        return false;
+    }
+    int flags = O_RDWR|O_CREAT|O_CLOEXEC;
+    if (fresh) {
+        // a journal from a previous storage file must not be applied
+        flags |= O_TRUNC;
+    }
+    fd = open(journal_path, flags, 0644);
+    if (fd == -1) {
+        free(batch);
+        batch = nullptr;
+        return false;
+    }
+    storage_fd = _storage_fd;
+    if (!replay()) {
+        close(fd);
+        fd = -1;
+        free(batch);
+        batch = nullptr;
+        return false;
+    }
+    batch_length = 0;
+    batch_ranges = 0;
+    return true;
+}
+
+/*
+  apply the last batch in the journal, if it is complete
+ */
+bool StorageJournal::replay(void)
+{
+    Header hdr;
+    if (pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+        hdr.magic != MAGIC ||
+        hdr.length > batch_size - sizeof(Header)) {
+        // empty or incomplete journal, nothing to do
+        return true;
+    }
+    uint8_t *payload = &batch[sizeof(Header)];
+    if (pread(fd, payload, hdr.length, sizeof(hdr)) != ssize_t(hdr.length) ||
+        crc_crc32(0, payload, hdr.length) != hdr.crc) {
+        // torn write of the journal, so the storage file was never
+        // touched by this batch
+        return true;
+    }
+    sequence = hdr.sequence;
+
+    uint32_t ofs = 0;
+    while (ofs + sizeof(Range) <= hdr.length) {
+        Range r;
+        memcpy(&r, &payload[ofs], sizeof(r));
+        ofs += sizeof(r);
+        if (ofs + r.length > hdr.length ||
+            uint32_t(r.offset) + r.length > storage_size) {
+            // should not happen with a valid crc
+            return false;
+        }
+        memcpy(&storage_buffer[r.offset], &payload[ofs], r.length);
+        if (pwrite(storage_fd, &payload[ofs], r.length, r.offset) != r.length) {
+            return false;
+        }
+        ofs += r.length;
+        stats.replayed_ranges++;
+    }
+    return fsync(storage_fd) == 0 && discard();
+}
+
+/*
+  mark the journal as applied by truncating it. This is not synced: if
+  the truncation is lost then the batch is replayed again, which is
+  harmless as the storage file already holds the same data
+ */
+bool StorageJournal::discard(void)
+{
+    return ftruncate(fd, 0) == 0;
+}
+
+bool StorageJournal::add(uint16_t offset, uint16_t length)
+{
+    if (fd == -1 || uint32_t(offset) + length > storage_size) {
+        return false;
+    }
+    if (batch_ranges >= MAX_RANGES ||
+        sizeof(Header) + batch_length + sizeof(Range) + length > batch_size) {
+        return false;
+    }
+    uint8_t *p = &batch[sizeof(Header) + batch_length];
+    const Range r { offset, length };
+    memcpy(p, &r, sizeof(r));
+    memcpy(p + sizeof(r), &storage_buffer[offset], length);
+    batch_length += sizeof(r) + length;
+    batch_ranges++;
+    return true;
+}
+
+bool StorageJournal::commit(uint32_t dirty_since_ms)
+{
+    if (fd == -1) {
+        return false;
+    }
+    if (batch_length == 0) {
+        return true;
+    }
+    const uint32_t start_us = AP_HAL::micros();
+    const uint8_t *payload = &batch[sizeof(Header)];
+
+    const Header hdr {
+        MAGIC,
+        sequence+1,
+        batch_length,
+        crc_crc32(0, payload, batch_length),
+    };
+    memcpy(batch, &hdr, sizeof(hdr));
+
+    // the journal goes out in one write, then the ranges are applied
+    // from the same copy of the data
+    const ssize_t total = sizeof(hdr) + batch_length;
+    bool ok = pwrite(fd, batch, total, 0) == total && fsync(fd) == 0;
+    uint32_t ofs = 0;
+    while (ok && ofs < batch_length) {
+        Range r;
+        memcpy(&r, &payload[ofs], sizeof(r));
+        ofs += sizeof(r);
+        ok = pwrite(storage_fd, &payload[ofs], r.length, r.offset) == r.length;
+        ofs += r.length;
+    }
+    ok = ok && fsync(storage_fd) == 0 && discard();
+
+    if (ok) {
+        sequence++;
+        stats.batches++;
+        stats.ranges += batch_ranges;
+        stats.bytes += batch_length - batch_ranges*sizeof(Range);
+        stats.last_commit_us = AP_HAL::micros() - start_us;
+        stats.max_commit_us = MAX(stats.max_commit_us, stats.last_commit_us);
+        stats.last_latency_ms = AP_HAL::millis() - dirty_since_ms;
+        stats.max_latency_ms = MAX(stats.max_latency_ms, stats.last_latency_ms);
+    } else {
+        stats.failures++;
+    }
+    batch_length = 0;
+    batch_ranges = 0;
+    return ok;
+}
+
+void StorageJournal::get_stats(ExpandingString &str) const
+{
+    str.printf("batches:     %u\n"
+               "failures:    %u\n"
+               "ranges:      %u\n"
+               "bytes:       %llu\n"
+               "commit_us:   %u (max %u)\n"
+               "latency_ms:  %u (max %u)\n"
+               "replayed:    %u\n",
+               unsigned(stats.batches),
+               unsigned(stats.failures),
+               unsigned(stats.ranges),
+               (unsigned long long)stats.bytes,
+               unsigned(stats.last_commit_us), unsigned(stats.max_commit_us),
+               unsigned(stats.last_latency_ms), unsigned(stats.max_latency_ms),
+               unsigned(stats.replayed_ranges));
+}
+
+#endif // AP_HAL_STORAGE_JOURNAL_ENABLED
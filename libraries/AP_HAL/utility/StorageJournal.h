@@ -0,0 +1,127 @@
+/*
+ * This file is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This file is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+  write-ahead journal for file backed storage on Linux and SITL
+ */
+#pragma once
+
+#include <AP_HAL/AP_HAL_Boards.h>
+
+#ifndef AP_HAL_STORAGE_JOURNAL_ENABLED
+#define AP_HAL_STORAGE_JOURNAL_ENABLED (CONFIG_HAL_BOARD == HAL_BOARD_SITL || CONFIG_HAL_BOARD == HAL_BOARD_LINUX)
+#endif
+
+#if AP_HAL_STORAGE_JOURNAL_ENABLED
+
+#include <stdint.h>
+#include <AP_Common/AP_Common.h>
+
+class ExpandingString;
+
+/*
+  Dirty ranges of an in-memory storage buffer are gathered into a
+  batch, which is written to the journal file and synced before being
+  applied to the storage file and synced again. A batch is therefore
+  either applied completely or not at all, and however many ranges it
+  holds it costs two fsync() calls.
+
+  Once a batch has been applied the journal is truncated, so only a
+  batch that was interrupted before it reached the storage file is
+  replayed on init. A storage file that is restored or replaced
+  while the vehicle is off is therefore not overwritten by old data.
+ */
+class StorageJournal {
+public:
+    StorageJournal(uint8_t *buffer, uint32_t size);
+    ~StorageJournal();
+
+    CLASS_NO_COPY(StorageJournal);
+
+    /*
+      open the journal, replaying the last batch into the storage
+      buffer and storage_fd. The buffer must already have been loaded
+      from storage_fd. If the storage file has just been created then
+      fresh should be true, and any old journal is discarded
+     */
+    bool init(const char *journal_path, int storage_fd, bool fresh);
+
+    // true if init() succeeded
+    bool enabled(void) const { return fd != -1; }
+
+    /*
+      add a range of the storage buffer to the current batch. The data
+      is copied at this point. Returns false if the batch is full, in
+      which case it should be committed and the range added again
+     */
+    bool add(uint16_t offset, uint16_t length);
+
+    // true if there is nothing in the current batch
+    bool empty(void) const { return batch_length == 0; }
+
+    /*
+      make the current batch durable. dirty_since_ms is when the
+      oldest data in the batch was changed, used for latency
+      statistics. On failure the batch is discarded and the caller
+      should mark the ranges dirty again
+     */
+    bool commit(uint32_t dirty_since_ms);
+
+    // report flush statistics
+    void get_stats(ExpandingString &str) const;
+
+private:
+    struct PACKED Header {
+        uint32_t magic;
+        uint32_t sequence;
+        uint32_t length;
+        uint32_t crc;
+    };
+    struct PACKED Range {
+        uint16_t offset;
+        uint16_t length;
+    };
+    static constexpr uint32_t MAGIC = 0x4A524E4C; // "JRNL"
+    // allow for a full storage update split into this many ranges
+    static constexpr uint16_t MAX_RANGES = 128;
+
+    bool replay(void);
+    bool discard(void);
+
+    uint8_t *storage_buffer;
+    const uint32_t storage_size;
+    int fd = -1;
+    int storage_fd = -1;
+    uint32_t sequence = 0;
+
+    // header followed by ranges, each followed by its data
+    uint8_t *batch = nullptr;
+    uint32_t batch_size;
+    uint32_t batch_length = 0;
+    uint16_t batch_ranges = 0;
+
+    struct {
+        uint32_t batches;
+        uint32_t failures;
+        uint32_t ranges;
+        uint64_t bytes;
+        uint32_t last_commit_us;
+        uint32_t max_commit_us;
+        uint32_t last_latency_ms;
+        uint32_t max_latency_ms;
+        uint16_t replayed_ranges;
+    } stats {};
+};
+
+#endif // AP_HAL_STORAGE_JOURNAL_ENABLED
@@ -0,0 +1,190 @@
+#include <AP_gtest.h>
+
+#include <AP_HAL/AP_HAL.h>
+#include <AP_HAL/utility/StorageJournal.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#if AP_HAL_STORAGE_JOURNAL_ENABLED
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static constexpr uint16_t STORAGE_SIZE = 4096;
+
+class StorageJournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        strcpy(storage_path, "/tmp/ap_storage_XXXXXX");
+        storage_fd = mkstemp(storage_path);
+        ASSERT_NE(storage_fd, -1);
+        ASSERT_EQ(ftruncate(storage_fd, STORAGE_SIZE), 0);
+        snprintf(journal_path, sizeof(journal_path), "%s.jnl", storage_path);
+        memset(buffer, 0, sizeof(buffer));
+    }
+
+    void TearDown() override {
+        close(storage_fd);
+        unlink(storage_path);
+        unlink(journal_path);
+    }
+
+    // read the storage file as it would be seen after a reboot
+    void load(uint8_t *dst) {
+        ASSERT_EQ(pread(storage_fd, dst, STORAGE_SIZE, 0), STORAGE_SIZE);
+    }
+
+    char storage_path[64];
+    char journal_path[80];
+    int storage_fd;
+    uint8_t buffer[STORAGE_SIZE];
+};
+
+TEST_F(StorageJournalTest, CommitIsDurable)
+{
+    StorageJournal journal{buffer, sizeof(buffer)};
+    ASSERT_TRUE(journal.init(journal_path, storage_fd, true));
+
+    memset(&buffer[100], 0x55, 50);
+    memset(&buffer[3000], 0xAA, 512);
+    EXPECT_TRUE(journal.add(100, 50));
+    EXPECT_TRUE(journal.add(3000, 512));
+    EXPECT_FALSE(journal.empty());
+    EXPECT_TRUE(journal.commit(AP_HAL::millis()));
+    EXPECT_TRUE(journal.empty());
+
+    uint8_t loaded[STORAGE_SIZE];
+    load(loaded);
+    EXPECT_EQ(memcmp(loaded, buffer, sizeof(buffer)), 0);
+}
+
+TEST_F(StorageJournalTest, ReplayAfterLostStorageWrite)
+{
+    {
+        // the storage write fails after the journal has been synced,
+        // as if power was lost at that point
+        const int ro_fd = open(storage_path, O_RDONLY);
+        ASSERT_NE(ro_fd, -1);
+        StorageJournal journal{buffer, sizeof(buffer)};
+        ASSERT_TRUE(journal.init(journal_path, ro_fd, true));
+        memset(&buffer[200], 0x42, 64);
+        EXPECT_TRUE(journal.add(200, 64));
+        EXPECT_FALSE(journal.commit(AP_HAL::millis()));
+        close(ro_fd);
+    }
+
+    uint8_t rebooted[STORAGE_SIZE];
+    load(rebooted);
+    StorageJournal journal{rebooted, sizeof(rebooted)};
+    ASSERT_TRUE(journal.init(journal_path, storage_fd, false));
+    EXPECT_EQ(memcmp(rebooted, buffer, sizeof(buffer)), 0);
+
+    uint8_t loaded[STORAGE_SIZE];
+    load(loaded);
+    EXPECT_EQ(memcmp(loaded, buffer, sizeof(buffer)), 0);
+}
+
+TEST_F(StorageJournalTest, AppliedJournalNotReplayed)
+{
+    {
+        StorageJournal journal{buffer, sizeof(buffer)};
+        ASSERT_TRUE(journal.init(journal_path, storage_fd, true));
+        memset(&buffer[500], 0x33, 32);
+        EXPECT_TRUE(journal.add(500, 32));
+        EXPECT_TRUE(journal.commit(AP_HAL::millis()));
+    }
+
+    // storage file restored from a backup while powered off
+    const uint8_t restored[32] { 9, 8, 7 };
+    ASSERT_EQ(pwrite(storage_fd, restored, sizeof(restored), 500), ssize_t(sizeof(restored)));
+
+    uint8_t rebooted[STORAGE_SIZE];
+    load(rebooted);
+    StorageJournal journal{rebooted, sizeof(rebooted)};
+    ASSERT_TRUE(journal.init(journal_path, storage_fd, false));
+    EXPECT_EQ(memcmp(&rebooted[500], restored, sizeof(restored)), 0);
+
+    uint8_t loaded[STORAGE_SIZE];
+    load(loaded);
+    EXPECT_EQ(memcmp(&loaded[500], restored, sizeof(restored)), 0);
+}
+
+TEST_F(StorageJournalTest, TornJournalIgnored)
+{
+    {
+        const int ro_fd = open(storage_path, O_RDONLY);
+        ASSERT_NE(ro_fd, -1);
+        StorageJournal journal{buffer, sizeof(buffer)};
+        ASSERT_TRUE(journal.init(journal_path, ro_fd, true));
+        memset(&buffer[10], 0x11, 20);
+        EXPECT_TRUE(journal.add(10, 20));
+        EXPECT_FALSE(journal.commit(AP_HAL::millis()));
+        close(ro_fd);
+    }
+
+    // corrupt the data in the journal, and put different data in storage
+    int jfd = open(journal_path, O_RDWR);
+    ASSERT_NE(jfd, -1);
+    const uint8_t junk = 0x99;
+    ASSERT_EQ(pwrite(jfd, &junk, 1, 30), 1);
+    close(jfd);
+    const uint8_t other[20] { 1, 2, 3 };
+    ASSERT_EQ(pwrite(storage_fd, other, sizeof(other), 10), ssize_t(sizeof(other)));
+
+    uint8_t rebooted[STORAGE_SIZE];
+    load(rebooted);
+    StorageJournal journal{rebooted, sizeof(rebooted)};
+    ASSERT_TRUE(journal.init(journal_path, storage_fd, false));
+    EXPECT_EQ(memcmp(&rebooted[10], other, sizeof(other)), 0);
+}
+
+TEST_F(StorageJournalTest, FreshStorageDiscardsJournal)
+{
+    {
+        const int ro_fd = open(storage_path, O_RDONLY);
+        ASSERT_NE(ro_fd, -1);
+        StorageJournal journal{buffer, sizeof(buffer)};
+        ASSERT_TRUE(journal.init(journal_path, ro_fd, true));
+        memset(&buffer[0], 0x77, 16);
+        EXPECT_TRUE(journal.add(0, 16));
+        EXPECT_FALSE(journal.commit(AP_HAL::millis()));
+        close(ro_fd);
+    }
+
+    // storage file recreated from scratch
+    ASSERT_EQ(ftruncate(storage_fd, 0), 0);
+    ASSERT_EQ(ftruncate(storage_fd, STORAGE_SIZE), 0);
+
+    uint8_t rebooted[STORAGE_SIZE] {};
+    StorageJournal journal{rebooted, sizeof(rebooted)};
+    ASSERT_TRUE(journal.init(journal_path, storage_fd, true));
+    EXPECT_EQ(rebooted[0], 0);
+}
+
+TEST_F(StorageJournalTest, FullBatch)
+{
+    StorageJournal journal{buffer, sizeof(buffer)};
+    ASSERT_TRUE(journal.init(journal_path, storage_fd, true));
+
+    // many small ranges eventually fill the batch
+    uint16_t added = 0;
+    for (uint16_t ofs=0; ofs<STORAGE_SIZE; ofs += 16) {
+        buffer[ofs] = 1;
+        if (!journal.add(ofs, 8)) {
+            break;
+        }
+        added++;
+    }
+    EXPECT_GT(added, 0);
+    EXPECT_LT(added, STORAGE_SIZE/16);
+    EXPECT_TRUE(journal.commit(AP_HAL::millis()));
+    EXPECT_TRUE(journal.add(0, STORAGE_SIZE));
+    EXPECT_TRUE(journal.commit(AP_HAL::millis()));
+}
+
+#endif // AP_HAL_STORAGE_JOURNAL_ENABLED
+
+AP_GTEST_MAIN()
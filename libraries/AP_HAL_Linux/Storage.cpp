@@ -10,12 +10,17 @@
 
 #include <AP_HAL/AP_HAL.h>
 #include <AP_Vehicle/AP_Vehicle_Type.h>
+#include <AP_Common/ExpandingString.h>
 
 using namespace Linux;
 
 /*
   This stores 'eeprom' data on the SD card, with a 4k size, and a
   in-memory buffer. This keeps the latency down.
+
+  Writes are coalesced and flushed in batches through a write-ahead
+  journal kept next to the storage file, so a large parameter or
+  mission update becomes durable with a couple of fsync() calls.
  */
 
 // name the storage file after the sketch so you can use the same board
@@ -113,6 +118,12 @@ int Storage::_storage_create(const char *dpath)
         goto fail;
     }
 
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size == 0) {
+        // brand new storage, so any journal belongs to an old file
+        _created = true;
+    }
+
     // take up all needed space
     if (ftruncate(fd, sizeof(_buffer)) == -1) {
         fprintf(stderr, "Failed to set file size to %u kB (%m)\n",
@@ -161,7 +172,7 @@ void Storage::init()
     if (ret != sizeof(_buffer)) {
         close(fd);
         _storage_create(dpath);
-        fd = open(dpath, O_RDONLY|O_CLOEXEC);
+        fd = open(dpath, O_RDWR|O_CLOEXEC);
         if (fd == -1) {
             AP_HAL::panic("Failed to open %s (%m)", dpath);
         }
@@ -171,6 +182,15 @@ void Storage::init()
     }
 
     _fd = fd;
+
+    char *jpath = nullptr;
+    if (asprintf(&jpath, "%s/%s.jnl", dpath, STORAGE_FILE) > 0) {
+        if (!_journal.init(jpath, _fd, _created)) {
+            fprintf(stderr, "Failed to open storage journal %s (%m)\n", jpath);
+        }
+        free(jpath);
+    }
+
     _initialised = true;
 }
 
@@ -186,6 +206,11 @@ void Storage::_mark_dirty(uint16_t loc, uint16_t length)
     if (length == 0) {
         return;
     }
+    const uint32_t now_ms = AP_HAL::millis();
+    if (_dirty_mask == 0) {
+        _first_dirty_ms = now_ms;
+    }
+    _last_write_ms = now_ms;
     uint16_t end = loc + length - 1;
     for (uint8_t line=loc>>LINUX_STORAGE_LINE_SHIFT;
          line <= end>>LINUX_STORAGE_LINE_SHIFT;
@@ -221,50 +246,75 @@ void Storage::_timer_tick(void)
         return;
     }
 
-    // write out the first dirty set of lines. We don't write more
-    // than one to keep the latency of this call to a minimum
-    uint8_t i, n;
-    for (i=0; i<LINUX_STORAGE_NUM_LINES; i++) {
-        if (_dirty_mask & (1<<i)) {
-            break;
-        }
-    }
-    if (i == LINUX_STORAGE_NUM_LINES) {
-        // this shouldn't be possible
+    // let a burst of writes, such as a mission upload, finish so it
+    // goes out as one batch
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _last_write_ms < LINUX_STORAGE_FLUSH_IDLE_MS &&
+        now_ms - _first_dirty_ms < LINUX_STORAGE_FLUSH_MAX_MS) {
         return;
     }
-    uint32_t write_mask = (1U<<i);
-    // see how many lines to write
-    for (n=1; (i+n) < LINUX_STORAGE_NUM_LINES &&
-             n < (LINUX_STORAGE_MAX_WRITE>>LINUX_STORAGE_LINE_SHIFT); n++) {
-        if (!(_dirty_mask & (1<<(n+i)))) {
-            break;
-        }
-        // mark that line clean
-        write_mask |= (1<<(n+i));
+    _flush(now_ms);
+}
+
+/*
+  write out all dirty lines, coalescing adjacent lines into one range.
+  Note that because this is a SCHED_FIFO thread it will not be
+  preempted by the main task except during blocking calls. This means
+  we don't need a semaphore around the _dirty_mask updates. Lines are
+  marked clean before their data is copied, so a write that races with
+  the copy leaves the line dirty for the next flush
+ */
+void Storage::_flush(uint32_t now_ms)
+{
+    const uint32_t dirty_since_ms = _first_dirty_ms;
+    const uint32_t write_mask = _dirty_mask;
+    _dirty_mask &= ~write_mask;
+    if (_dirty_mask != 0) {
+        _first_dirty_ms = now_ms;
     }
 
-    /*
-      write the lines. This also updates _dirty_mask. Note that
-      because this is a SCHED_FIFO thread it will not be preempted
-      by the main task except during blocking calls. This means we
-      don't need a semaphore around the _dirty_mask updates.
-     */
-    if (lseek(_fd, i<<LINUX_STORAGE_LINE_SHIFT, SEEK_SET) == (i<<LINUX_STORAGE_LINE_SHIFT)) {
-        _dirty_mask &= ~write_mask;
-        if (write(_fd, &_buffer[i<<LINUX_STORAGE_LINE_SHIFT], n<<LINUX_STORAGE_LINE_SHIFT) != n<<LINUX_STORAGE_LINE_SHIFT) {
-            // write error - likely EINTR
-            _dirty_mask |= write_mask;
-            close(_fd);
-            _fd = -1;
+    bool ok = true;
+    uint8_t i = 0;
+    while (ok && i < LINUX_STORAGE_NUM_LINES) {
+        if (!(write_mask & (1U<<i))) {
+            i++;
+            continue;
+        }
+        uint8_t n = 1;
+        while (i+n < LINUX_STORAGE_NUM_LINES && (write_mask & (1U<<(i+n)))) {
+            n++;
         }
-        if (_dirty_mask == 0) {
-            if (fsync(_fd) != 0) {
-                close(_fd);
-                _fd = -1;
+        const uint16_t ofs = i<<LINUX_STORAGE_LINE_SHIFT;
+        const uint16_t len = n<<LINUX_STORAGE_LINE_SHIFT;
+        if (_journal.enabled()) {
+            if (!_journal.add(ofs, len)) {
+                ok = _journal.commit(dirty_since_ms) && _journal.add(ofs, len);
             }
+        } else {
+            ok = pwrite(_fd, &_buffer[ofs], len, ofs) == len;
         }
+        i += n;
     }
+    if (ok) {
+        if (_journal.enabled()) {
+            ok = _journal.commit(dirty_since_ms);
+        } else {
+            ok = fsync(_fd) == 0;
+        }
+    }
+
+    if (!ok) {
+        // write error - likely EINTR
+        _dirty_mask |= write_mask;
+        _first_dirty_ms = dirty_since_ms;
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+void Storage::get_stats(ExpandingString &str)
+{
+    _journal.get_stats(str);
 }
 
 /*
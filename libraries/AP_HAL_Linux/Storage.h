@@ -1,6 +1,7 @@
 #pragma once
 
 #include <AP_HAL/AP_HAL.h>
+#include <AP_HAL/utility/StorageJournal.h>
 
 #define LINUX_STORAGE_SIZE HAL_STORAGE_SIZE
 #define LINUX_STORAGE_MAX_WRITE 512
@@ -8,6 +9,15 @@
 #define LINUX_STORAGE_LINE_SIZE (1<<LINUX_STORAGE_LINE_SHIFT)
 #define LINUX_STORAGE_NUM_LINES (LINUX_STORAGE_SIZE/LINUX_STORAGE_LINE_SIZE)
 
+// flush once writes have stopped for this long
+#ifndef LINUX_STORAGE_FLUSH_IDLE_MS
+#define LINUX_STORAGE_FLUSH_IDLE_MS 10
+#endif
+// but never leave data dirty for longer than this
+#ifndef LINUX_STORAGE_FLUSH_MAX_MS
+#define LINUX_STORAGE_FLUSH_MAX_MS 100
+#endif
+
 namespace Linux {
 
 class Storage : public AP_HAL::Storage
@@ -36,14 +46,22 @@ public:
 
     virtual void _timer_tick(void) override;
 
+    void get_stats(ExpandingString &str) override;
+
 protected:
     void _mark_dirty(uint16_t loc, uint16_t length);
     int _storage_create(const char *dpath);
+    void _flush(uint32_t now_ms);
 
     int _fd;
     volatile bool _initialised;
     volatile uint32_t _dirty_mask;
+    // when the oldest unflushed write and the latest write happened
+    volatile uint32_t _first_dirty_ms;
+    volatile uint32_t _last_write_ms;
+    bool _created;
     uint8_t _buffer[LINUX_STORAGE_SIZE];
+    StorageJournal _journal{_buffer, sizeof(_buffer)};
 };
 
 }
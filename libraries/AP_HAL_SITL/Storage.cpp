@@ -2,6 +2,8 @@
 
 #include <AP_Vehicle/AP_Vehicle_Type.h>
 #include <AP_HAL/AP_HAL.h>
+#include <AP_Common/ExpandingString.h>
+#include <AP_Math/AP_Math.h>
 #include "AP_HAL_SITL.h"
 
 #include <assert.h>
@@ -111,6 +113,10 @@ void Storage::_storage_open(void)
             log_fd = -1;
             return;
         }
+        // without a journal we fall back to writing a line per tick
+        if (!_journal.init(HAL_STORAGE_FILE ".jnl", log_fd, ret == 0)) {
+            hal.console->printf("journal failed for " HAL_STORAGE_FILE "\n");
+        }
         _initialisedType = StorageBackend::SDCard;  // AKA POSIX
         return;
     }
@@ -131,6 +137,11 @@ void Storage::_mark_dirty(uint16_t loc, uint16_t length)
     if (length == 0) {
         return;
     }
+    const uint32_t now_ms = AP_HAL::millis();
+    if (_dirty_mask.empty()) {
+        _first_dirty_ms = now_ms;
+    }
+    _last_write_ms = now_ms;
     uint16_t end = loc + length - 1;
     for (uint16_t line=loc>>STORAGE_LINE_SHIFT;
          line <= end>>STORAGE_LINE_SHIFT;
@@ -170,6 +181,13 @@ void Storage::_timer_tick(void)
         return;
     }
 
+#if STORAGE_USE_POSIX
+    if (_initialisedType == StorageBackend::SDCard && _journal.enabled()) {
+        _posix_flush();
+        return;
+    }
+#endif
+
     // write out the first dirty line. We don't write more
     // than one to keep the latency of this call to a minimum
     uint16_t i;
@@ -215,6 +233,69 @@ void Storage::_timer_tick(void)
 #endif
 }
 
+#if STORAGE_USE_POSIX
+/*
+  once a burst of writes has finished, send all dirty lines through
+  the journal as one batch, coalescing adjacent lines into one range
+ */
+void Storage::_posix_flush(void)
+{
+    const uint32_t now_ms = AP_HAL::millis();
+    if (now_ms - _last_write_ms < STORAGE_FLUSH_IDLE_MS &&
+        now_ms - _first_dirty_ms < STORAGE_FLUSH_MAX_MS) {
+        return;
+    }
+    if (_flush_retry_ms != 0 && now_ms - _flush_fail_ms < _flush_retry_ms) {
+        // back off after a failure rather than retrying every tick
+        return;
+    }
+    const uint32_t dirty_since_ms = _first_dirty_ms;
+    _flush_mask.clearall();
+    uint16_t i = 0;
+    while (i < STORAGE_NUM_LINES) {
+        if (!_dirty_mask.get(i)) {
+            i++;
+            continue;
+        }
+        uint16_t n = 1;
+        while (i+n < STORAGE_NUM_LINES && _dirty_mask.get(i+n)) {
+            n++;
+        }
+        // clear before the data is copied, so a write that races
+        // with the copy leaves the line dirty for the next flush
+        for (uint16_t j=i; j<i+n; j++) {
+            _dirty_mask.clear(j);
+            _flush_mask.set(j);
+        }
+        if (!_journal.add(i*STORAGE_LINE_SIZE, n*STORAGE_LINE_SIZE)) {
+            // batch is full, finish with what we have
+            for (uint16_t j=i; j<i+n; j++) {
+                _dirty_mask.set(j);
+                _flush_mask.clear(j);
+            }
+            break;
+        }
+        i += n;
+    }
+    if (!_journal.commit(dirty_since_ms)) {
+        // mark the lines of this batch dirty again and retry later
+        for (uint16_t j=0; j<STORAGE_NUM_LINES; j++) {
+            if (_flush_mask.get(j)) {
+                _dirty_mask.set(j);
+            }
+        }
+        _first_dirty_ms = dirty_since_ms;
+        _flush_fail_ms = now_ms;
+        _flush_retry_ms = constrain_uint32(_flush_retry_ms*2, STORAGE_FLUSH_RETRY_MIN_MS, STORAGE_FLUSH_RETRY_MAX_MS);
+        return;
+    }
+    _flush_retry_ms = 0;
+    if (!_dirty_mask.empty()) {
+        _first_dirty_ms = now_ms;
+    }
+}
+#endif // STORAGE_USE_POSIX
+
 #if STORAGE_USE_FLASH
 
 /*
@@ -388,6 +469,15 @@ bool Storage::healthy(void)
     return AP_HAL::millis() - _last_empty_ms < 2000;
 }
 
+void Storage::get_stats(ExpandingString &str)
+{
+#if STORAGE_USE_POSIX
+    if (_initialisedType == StorageBackend::SDCard) {
+        _journal.get_stats(str);
+    }
+#endif
+}
+
 /*
   get storage size and ptr
  */
@@ -5,6 +5,7 @@
 #include "AP_HAL_SITL_Namespace.h"
 #include <AP_FlashStorage/AP_FlashStorage.h>
 #include <AP_RAMTRON/AP_RAMTRON.h>
+#include <AP_HAL/utility/StorageJournal.h>
 
 #ifndef STORAGE_USE_FLASH
 #define STORAGE_USE_FLASH 1
@@ -23,6 +24,23 @@
 #define STORAGE_LINE_SIZE (1<<STORAGE_LINE_SHIFT)
 #define STORAGE_NUM_LINES (HAL_STORAGE_SIZE/STORAGE_LINE_SIZE)
 
+// with POSIX storage, flush once writes have stopped for this long
+#ifndef STORAGE_FLUSH_IDLE_MS
+#define STORAGE_FLUSH_IDLE_MS 10
+#endif
+// but never leave data dirty for longer than this
+#ifndef STORAGE_FLUSH_MAX_MS
+#define STORAGE_FLUSH_MAX_MS 100
+#endif
+// after a failed flush wait this long before retrying, doubling on each
+// further failure up to the maximum
+#ifndef STORAGE_FLUSH_RETRY_MIN_MS
+#define STORAGE_FLUSH_RETRY_MIN_MS 100
+#endif
+#ifndef STORAGE_FLUSH_RETRY_MAX_MS
+#define STORAGE_FLUSH_RETRY_MAX_MS 5000
+#endif
+
 class HALSITL::Storage : public AP_HAL::Storage {
 public:
     void init() override {}
@@ -32,6 +50,7 @@ public:
 
     void _timer_tick(void) override;
     bool healthy(void) override;
+    void get_stats(ExpandingString &str) override;
 
 private:
     enum class StorageBackend: uint8_t {
@@ -50,6 +69,9 @@ private:
     Bitmask<STORAGE_NUM_LINES> _dirty_mask;
 
     uint32_t _last_empty_ms;
+    // when the oldest unflushed write and the latest write happened
+    uint32_t _first_dirty_ms;
+    uint32_t _last_write_ms;
 
 #if STORAGE_USE_FLASH
     bool _flash_write_data(uint8_t sector, uint32_t offset, const uint8_t *data, uint16_t length);
@@ -73,6 +95,13 @@ private:
 
 #if STORAGE_USE_POSIX
     int log_fd;
+    StorageJournal _journal{_buffer, sizeof(_buffer)};
+    // lines in the batch being flushed
+    Bitmask<STORAGE_NUM_LINES> _flush_mask;
+    // time of the last failed flush and the delay before the next attempt
+    uint32_t _flush_fail_ms;
+    uint32_t _flush_retry_ms;
+    void _posix_flush(void);
 #endif
 
 #if STORAGE_USE_FRAM
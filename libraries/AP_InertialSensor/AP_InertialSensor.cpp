@@ -1851,10 +1851,13 @@ void AP_InertialSensor::HarmonicNotch::update_params(uint8_t instance, bool conv
         last_bandwidth_hz[instance] = params.bandwidth_hz();
         last_attenuation_dB[instance] = params.attenuation_dB();
     } else if (params.tracking_mode() != HarmonicNotchDynamicMode::Fixed) {
+        // IMUs at the same sample rate need the same coefficients, so
+        // take them from the previous IMU where they match
+        const HarmonicNotchFilterVector3f *share = instance > 0 ? &filter[instance-1] : nullptr;
         if (num_calculated_notch_frequencies > 1) {
-            filter[instance].update(num_calculated_notch_frequencies, calculated_notch_freq_hz);
+            filter[instance].update(num_calculated_notch_frequencies, calculated_notch_freq_hz, share);
         } else {
-            filter[instance].update(calculated_notch_freq_hz[0]);
+            filter[instance].update(calculated_notch_freq_hz[0], share);
         }
     }
 }
@@ -638,6 +638,18 @@ struct PACKED log_Scripting {
     int32_t run_mem;
 };
 
+struct PACKED log_Scripting_Stats {
+    LOG_PACKET_HEADER;
+    uint64_t time_us;
+    char name[16];
+    uint16_t run_count;
+    uint32_t run_time;
+    uint32_t max_run_time;
+    uint32_t period;
+    uint32_t alloc;
+    uint32_t max_late;
+};
+
 struct PACKED log_MotBatt {
     LOG_PACKET_HEADER;
     uint64_t time_us;
@@ -1160,6 +1172,17 @@ struct PACKED log_VER {
 // @Field: Total_mem: total memory usage of all scripts
 // @Field: Run_mem: run memory usage
 
+// @LoggerMessage: SCRS
+// @Description: Per-script scheduling and resource usage since the last report
+// @Field: TimeUS: Time since system startup
+// @Field: Name: script name
+// @Field: Runs: number of times the script ran
+// @Field: RunT: total run time
+// @Field: MaxT: longest single run time
+// @Field: Per: run period requested by the script
+// @Field: Alloc: bytes allocated by the script
+// @Field: Late: longest delay past the requested run time
+
 // @LoggerMessage: VER
 // @Description: Ardupilot version
 // @Field: TimeUS: Time since system startup
@@ -1304,6 +1327,8 @@ LOG_STRUCTURE_FROM_VISUALODOM \
 LOG_STRUCTURE_FROM_AIS \
     { LOG_SCRIPTING_MSG, sizeof(log_Scripting), \
       "SCR",   "QNIii", "TimeUS,Name,Runtime,Total_mem,Run_mem", "s#sbb", "F-F--", true }, \
+    { LOG_SCRIPTING_STATS_MSG, sizeof(log_Scripting_Stats), \
+      "SCRS",  "QNHIIIII", "TimeUS,Name,Runs,RunT,MaxT,Per,Alloc,Late", "s#-sssbs", "F--FFC-C", true }, \
     { LOG_VER_MSG, sizeof(log_VER), \
       "VER",   "QBHBBBBIZHBB", "TimeUS,BT,BST,Maj,Min,Pat,FWT,GH,FWS,APJ,BU,FV", "s-----------", "F-----------", false }, \
     { LOG_MOTBATT_MSG, sizeof(log_MotBatt), \
@@ -1387,6 +1412,7 @@ enum LogMessages : uint8_t {
     LOG_STAK_MSG,
     LOG_FILE_MSG,
     LOG_SCRIPTING_MSG,
+    LOG_SCRIPTING_STATS_MSG,
     LOG_VIDEO_STABILISATION_MSG,
     LOG_MOTBATT_MSG,
     LOG_VER_MSG,
@@ -97,7 +97,30 @@ static void BM_GeodesicGridSections(benchmark::State& state)
     }
 }
 
+/* Directions spread over the sphere, as magnetometer samples or obstacle
+ * directions would be, including ones near the sections' edges */
+static void BM_GeodesicGridDirections(benchmark::State& state)
+{
+    const int num_directions = 1024;
+    Vector3f v[num_directions];
+    uint32_t seed = 1;
+    for (int i = 0; i < num_directions; i++) {
+        for (int j = 0; j < 3; j++) {
+            seed = seed * 1664525 + 1013904223;
+            v[i][j] = (seed >> 8) * (2.0f / (1 << 24)) - 1.0f;
+        }
+    }
+
+    while (state.KeepRunning()) {
+        for (int i = 0; i < num_directions; i++) {
+            int s = AP_GeodesicGrid::section(v[i], true);
+            gbenchmark_escape(&s);
+        }
+    }
+}
+
 /* Benchmark each section */
 BENCHMARK(BM_GeodesicGridSections)->DenseRange(0, 79);
+BENCHMARK(BM_GeodesicGridDirections);
 
 BENCHMARK_MAIN();
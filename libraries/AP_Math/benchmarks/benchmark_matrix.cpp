@@ -1,6 +1,7 @@
 #include <AP_gbenchmark.h>
 
 #include <AP_Math/AP_Math.h>
+#include <AP_Math/matrixN.h>
 
 const AP_HAL::HAL& hal = AP_HAL::get_HAL();
 
@@ -19,6 +20,70 @@ static void BM_MatrixMultiplication(benchmark::State& state)
     }
 }
 
+#define MAX_DIM 24
+
+// a well conditioned matrix, as the normal equations of a calibration fit are
+template <typename T>
+static void make_matrix(T *A, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++) {
+        for (uint16_t j = 0; j < n; j++) {
+            A[i*n + j] = ((i * 7 + j * 13) % 11) * 0.1 - 0.5;
+        }
+        A[i*n + i] += n;
+    }
+}
+
+template <typename T>
+static void BM_MatMul(benchmark::State& state)
+{
+    const uint16_t n = state.range(0);
+    T A[MAX_DIM*MAX_DIM], B[MAX_DIM*MAX_DIM], C[MAX_DIM*MAX_DIM];
+    make_matrix(A, n);
+    make_matrix(B, n);
+    while (state.KeepRunning()) {
+        mat_mul(A, B, C, n);
+        gbenchmark_escape(C);
+    }
+}
+
+template <typename T>
+static void BM_MatInverse(benchmark::State& state)
+{
+    const uint16_t n = state.range(0);
+    T A[MAX_DIM*MAX_DIM], inv[MAX_DIM*MAX_DIM];
+    make_matrix(A, n);
+    while (state.KeepRunning()) {
+        bool ret = mat_inverse(A, inv, n);
+        gbenchmark_escape(&ret);
+        gbenchmark_escape(inv);
+    }
+}
+
+// the rank one update of a Kalman filter covariance
+static void BM_MatrixNOuterProductUpdate(benchmark::State& state)
+{
+    const float d[4] {1.0f, 2.0f, 3.0f, 4.0f};
+    MatrixN<float,4> P(d);
+    VectorN<float,4> a, b;
+    for (uint8_t i = 0; i < 4; i++) {
+        a[i] = 0.1f * (i + 1);
+        b[i] = 0.01f * (4 - i);
+    }
+    while (state.KeepRunning()) {
+        MatrixN<float,4> update;
+        update.mult(a, b);
+        P -= update;
+        P.force_symmetry();
+        gbenchmark_escape(&P);
+    }
+}
+
 BENCHMARK(BM_MatrixMultiplication);
+BENCHMARK_TEMPLATE(BM_MatMul, float)->Arg(3)->Arg(4)->Arg(6)->Arg(9)->Arg(24);
+BENCHMARK_TEMPLATE(BM_MatMul, double)->Arg(3)->Arg(4)->Arg(6)->Arg(9)->Arg(24);
+BENCHMARK_TEMPLATE(BM_MatInverse, float)->Arg(3)->Arg(4)->Arg(6)->Arg(9)->Arg(24);
+BENCHMARK_TEMPLATE(BM_MatInverse, double)->Arg(3)->Arg(4)->Arg(6)->Arg(9)->Arg(24);
+BENCHMARK(BM_MatrixNOuterProductUpdate);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,48 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_Math/AP_Math.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#define NUM_VERTICES 201
+
+// a closed star shaped polygon, in lat/lon * 1e7 like a fence
+static Vector2l vertices[NUM_VERTICES];
+
+static void make_polygon(void)
+{
+    for (uint16_t i=0; i<NUM_VERTICES-1; i++) {
+        const float angle = i * M_2PI / (NUM_VERTICES-1);
+        const float radius = (i % 2) ? 80000 : 100000;
+        vertices[i].x = -353632610 + radius * cosf(angle);
+        vertices[i].y = 1491652300 + radius * sinf(angle);
+    }
+    vertices[NUM_VERTICES-1] = vertices[0];
+}
+
+static const Vector2l test_point { -353632610 + 30000, 1491652300 - 20000 };
+
+static void BM_PolygonOutside(benchmark::State& state)
+{
+    make_polygon();
+    while (state.KeepRunning()) {
+        bool outside = Polygon_outside(test_point, vertices, NUM_VERTICES);
+        gbenchmark_escape(&outside);
+    }
+}
+
+static void BM_PolygonIndexOutside(benchmark::State& state)
+{
+    make_polygon();
+    PolygonIndex<int32_t> index;
+    index.init(vertices, NUM_VERTICES);
+    while (state.KeepRunning()) {
+        bool outside = index.outside(test_point);
+        gbenchmark_escape(&outside);
+    }
+}
+
+BENCHMARK(BM_PolygonOutside);
+BENCHMARK(BM_PolygonIndexOutside);
+
+BENCHMARK_MAIN();
@@ -25,27 +25,34 @@
 #endif
 
 /*
- *    Does matrix multiplication of two regular/square matrices
+ *    Does matrix multiplication of two regular/square matrices, C = A*B
+ *    N is the dimension when known at compile time, letting the compiler unroll and
+ *    vectorise the loops, or 0 to use n. The inner loop runs along rows of B and C
+ *    so it reads memory in order, and each element is summed in the same order as
+ *    the textbook i,j,k loop
  *
  *    @param     A,           Matrix A
  *    @param     B,           Matrix B
- *    @param     n,           dimemsion of square matrices
- *    @returns                multiplied matrix i.e. A*B
+ *    @param     C,           Output matrix, must not be A or B
+ *    @param     n,           dimension of square matrices
  */
-template<typename T>
-static T* matrix_multiply(const T *A, const T *B, uint16_t n)
+template<typename T, uint16_t N>
+static void mat_mul_kernel(const T *A, const T *B, T *C, uint16_t n)
 {
-    T* ret = new T[n*n];
-    memset(ret,0.0f,n*n*sizeof(T));
-
-    for(uint16_t i = 0; i < n; i++) {
-        for(uint16_t j = 0; j < n; j++) {
-            for(uint16_t k = 0;k < n; k++) {
-                ret[i*n + j] += A[i*n + k] * B[k*n + j];
+    const uint16_t dim = N ? N : n;
+    for (uint16_t i = 0; i < dim; i++) {
+        T *c = &C[i*dim];
+        for (uint16_t j = 0; j < dim; j++) {
+            c[j] = 0;
+        }
+        for (uint16_t k = 0; k < dim; k++) {
+            const T a = A[i*dim + k];
+            const T *b = &B[k*dim];
+            for (uint16_t j = 0; j < dim; j++) {
+                c[j] += a * b[j];
             }
         }
     }
-    return ret;
 }
 
 template<typename T>
@@ -58,179 +65,114 @@ static inline void swap(T &a, T &b)
 }
 
 /*
- *    calculates pivot matrix such that all the larger elements in the row are on diagonal
- *
- *    @param     A,           input matrix matrix
- *    @param     pivot
- *    @param     n,           dimenstion of square matrix
- *    @returns                false = matrix is Singular or non positive definite, true = matrix inversion successful
+ *    matrix inverse code for any square matrix using in-place Gauss-Jordan elimination with
+ *    partial pivoting. N is the dimension when known at compile time, or 0 to use n
+ *    ref: Numerical Recipes in C, 2nd edition, section 2.1
+ *    @param     a,           input matrix, replaced by its inverse
+ *    @param     perm,        workspace for n row swaps
+ *    @param     n,           dimension of square matrix
+ *    @returns                false = matrix is Singular, true = matrix inversion successful
  */
-template<typename T>
-static void mat_pivot(const T* A, T* pivot, uint16_t n)
+template<typename T, uint16_t N>
+static bool mat_inverse_gauss_jordan(T *a, uint16_t *perm, uint16_t n)
 {
-    for(uint16_t i = 0;i<n;i++){
-        for(uint16_t j=0;j<n;j++) {
-            pivot[i*n+j] = static_cast<T>(i==j);
+    const uint16_t dim = N ? N : n;
+
+    for (uint16_t k = 0; k < dim; k++) {
+        // use the largest remaining element in this column as the pivot
+        uint16_t max_i = k;
+        for (uint16_t i = k+1; i < dim; i++) {
+            if (fabsF(a[i*dim + k]) > fabsF(a[max_i*dim + k])) {
+                max_i = i;
+            }
         }
-    }
-
-    for(uint16_t i = 0;i < n; i++) {
-        uint16_t max_j = i;
-        for(uint16_t j=i;j<n;j++){
-            if (std::is_same<T, double>::value) {
-                if(fabsF(A[j*n + i]) > fabsF(A[max_j*n + i])) {
-                    max_j = j;
-                }
-            } else {
-                if(fabsF(A[j*n + i]) > fabsF(A[max_j*n + i])) {
-                    max_j = j;
-                }
+        perm[k] = max_i;
+        if (max_i != k) {
+            for (uint16_t j = 0; j < dim; j++) {
+                swap(a[k*dim + j], a[max_i*dim + j]);
             }
         }
+        if (a[k*dim + k] == 0) {
+            return false;
+        }
+
+        // scale the pivot row, the pivot element becomes the inverse of the pivot
+        T *row_k = &a[k*dim];
+        const T pivot_inv = 1 / row_k[k];
+        row_k[k] = 1;
+        for (uint16_t j = 0; j < dim; j++) {
+            row_k[j] *= pivot_inv;
+        }
 
-        if(max_j != i) {
-            for(uint16_t k = 0; k < n; k++) {
-                swap(pivot[i*n + k], pivot[max_j*n + k]);
+        // eliminate this column from all other rows
+        for (uint16_t i = 0; i < dim; i++) {
+            if (i == k) {
+                continue;
+            }
+            T *row_i = &a[i*dim];
+            const T f = row_i[k];
+            row_i[k] = 0;
+            for (uint16_t j = 0; j < dim; j++) {
+                row_i[j] -= f * row_k[j];
             }
         }
     }
-}
 
-/*
- *    calculates matrix inverse of Lower trangular matrix using forward substitution
- *
- *    @param     L,           lower triangular matrix
- *    @param     out,         Output inverted lower triangular matrix
- *    @param     n,           dimension of matrix
- */
-template<typename T>
-static void mat_forward_sub(const T *L, T *out, uint16_t n)
-{
-    // Forward substitution solve LY = I
-    for(int i = 0; i < n; i++) {
-        out[i*n + i] = 1/L[i*n + i];
-        for (int j = i+1; j < n; j++) {
-            for (int k = i; k < j; k++) {
-                out[j*n + i] -= L[j*n + k] * out[k*n + i];
+    // undo the row swaps, as column swaps in reverse order
+    for (int16_t k = dim-1; k >= 0; k--) {
+        if (perm[k] != k) {
+            for (uint16_t i = 0; i < dim; i++) {
+                swap(a[i*dim + k], a[i*dim + perm[k]]);
             }
-            out[j*n + i] /= L[j*n + j];
         }
     }
-}
 
-/*
- *    calculates matrix inverse of Upper trangular matrix using backward substitution
- *
- *    @param     U,           upper triangular matrix
- *    @param     out,         Output inverted upper triangular matrix
- *    @param     n,           dimension of matrix
- */
-template<typename T>
-static void mat_back_sub(const T *U, T *out, uint16_t n)
-{
-    // Backward Substitution solve UY = I
-    for(int i = n-1; i >= 0; i--) {
-        out[i*n + i] = 1/U[i*n + i];
-        for (int j = i - 1; j >= 0; j--) {
-            for (int k = i; k > j; k--) {
-                out[j*n + i] -= U[j*n + k] * out[k*n + i];
-            }
-            out[j*n + i] /= U[j*n + j];
+    //check sanity of results
+    for (uint16_t i = 0; i < dim*dim; i++) {
+        if (isnan(a[i]) || isinf(a[i])) {
+            return false;
         }
     }
+    return true;
 }
 
 /*
- *    Decomposes square matrix into Lower and Upper triangular matrices such that
- *    A*P = L*U, where P is the pivot matrix
- *    ref: http://rosettacode.org/wiki/LU_decomposition
- *    @param     U,           upper triangular matrix
- *    @param     out,         Output inverted upper triangular matrix
- *    @param     n,           dimension of matrix
+ *    matrix inverse for a size known at compile time, needing no allocation
+ *
+ *    @param     A,           input matrix
+ *    @param     inv,         Output inverted matrix, may be A
+ *    @returns                false = matrix is Singular, true = matrix inversion successful
  */
-template<typename T>
-static void mat_LU_decompose(const T* A, T* L, T* U, T *P, uint16_t n)
+template<typename T, uint16_t N>
+static bool mat_inverse_fixed(const T* A, T* inv)
 {
-    memset(L,0,n*n*sizeof(T));
-    memset(U,0,n*n*sizeof(T));
-    memset(P,0,n*n*sizeof(T));
-    mat_pivot(A,P,n);
-
-    T *APrime = matrix_multiply(P,A,n);
-    for(uint16_t i = 0; i < n; i++) {
-        L[i*n + i] = 1;
+    uint16_t perm[N];
+    if (inv != A) {
+        memcpy(inv, A, N*N*sizeof(T));
     }
-    for(uint16_t i = 0; i < n; i++) {
-        for(uint16_t j = 0; j < n; j++) {
-            if(j <= i) {    
-                U[j*n + i] = APrime[j*n + i];
-                for(uint16_t k = 0; k < j; k++) {
-                    U[j*n + i] -= L[j*n + k] * U[k*n + i]; 
-                }
-            }
-            if(j >= i) {
-                L[j*n + i] = APrime[j*n + i];
-                for(uint16_t k = 0; k < i; k++) {
-                    L[j*n + i] -= L[j*n + k] * U[k*n + i]; 
-                }
-                L[j*n + i] /= U[i*n + i];
-            }
-        }
-    }
-    delete[] APrime;
+    return mat_inverse_gauss_jordan<T,N>(inv, perm, N);
 }
 
 /*
- *    matrix inverse code for any square matrix using LU decomposition
- *    inv = inv(U)*inv(L)*P, where L and U are triagular matrices and P the pivot matrix
- *    ref: http://www.cl.cam.ac.uk/teaching/1314/NumMethods/supporting/mcmaster-kiruba-ludecomp.pdf
- *    @param     m,           input 4x4 matrix
- *    @param     inv,      Output inverted 4x4 matrix
+ *    matrix inverse code for any square matrix
+ *
+ *    @param     A,           input matrix
+ *    @param     inv,         Output inverted matrix, may be A
  *    @param     n,           dimension of square matrix
  *    @returns                false = matrix is Singular, true = matrix inversion successful
  */
 template<typename T>
 static bool mat_inverseN(const T* A, T* inv, uint16_t n)
 {
-    T *L, *U, *P;
-    bool ret = true;
-    L = new T[n*n];
-    U = new T[n*n];
-    P = new T[n*n];
-    mat_LU_decompose(A,L,U,P,n);
-
-    T *L_inv = new T[n*n];
-    T *U_inv = new T[n*n];
-
-    memset(L_inv,0,n*n*sizeof(T));
-    mat_forward_sub(L,L_inv,n);
-
-    memset(U_inv,0,n*n*sizeof(T));
-    mat_back_sub(U,U_inv,n);
-
-    // decomposed matrices no longer required
-    delete[] L;
-    delete[] U;
-
-    T *inv_unpivoted = matrix_multiply(U_inv,L_inv,n);
-    T *inv_pivoted = matrix_multiply(inv_unpivoted, P, n);
-
-    //check sanity of results
-    for(uint16_t i = 0; i < n; i++) {
-        for(uint16_t j = 0; j < n; j++) {
-            if(isnan(inv_pivoted[i*n+j]) || isinf(inv_pivoted[i*n+j])){
-                ret = false;
-            }
-        }
+    uint16_t *perm = new uint16_t[n];
+    if (perm == nullptr) {
+        return false;
     }
-    memcpy(inv,inv_pivoted,n*n*sizeof(T));
-
-    //free memory
-    delete[] inv_pivoted;
-    delete[] inv_unpivoted;
-    delete[] P;
-    delete[] U_inv;
-    delete[] L_inv;
+    if (inv != A) {
+        memcpy(inv, A, n*n*sizeof(T));
+    }
+    const bool ret = mat_inverse_gauss_jordan<T,0>(inv, perm, n);
+    delete[] perm;
     return ret;
 }
 
@@ -440,6 +382,9 @@ bool mat_inverse(const T x[], T y[], uint16_t dim)
     switch(dim){
     case 3: return inverse3x3(x,y);
     case 4: return inverse4x4(x,y);
+    // accel calibration fits
+    case 6: return mat_inverse_fixed<T,6>(x,y);
+    case 9: return mat_inverse_fixed<T,9>(x,y);
     default: return mat_inverseN(x,y,dim);
     }
 }
@@ -447,13 +392,12 @@ bool mat_inverse(const T x[], T y[], uint16_t dim)
 template <typename T>
 void mat_mul(const T *A, const T *B, T *C, uint16_t n)
 {
-    memset(C, 0, sizeof(T)*n*n);
-    for(uint16_t i = 0; i < n; i++) {
-        for(uint16_t j = 0; j < n; j++) {
-            for(uint16_t k = 0;k < n; k++) {
-                C[i*n + j] += A[i*n + k] * B[k*n + j];
-            }
-        }
+    switch (n) {
+    case 3: mat_mul_kernel<T,3>(A, B, C, n); break;
+    case 4: mat_mul_kernel<T,4>(A, B, C, n); break;
+    case 6: mat_mul_kernel<T,6>(A, B, C, n); break;
+    case 9: mat_mul_kernel<T,9>(A, B, C, n); break;
+    default: mat_mul_kernel<T,0>(A, B, C, n); break;
     }
 }
 
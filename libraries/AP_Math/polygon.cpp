@@ -36,6 +36,54 @@
  *  expect that to be very small over the distances involved in the
  *  fence boundary
  */
+/*
+  return true if the edge from Vi to Vj crosses the ray used by
+  Polygon_outside() for point P
+ */
+template <typename T>
+static inline bool Polygon_edge_crossed(const Vector2<T> &P, const Vector2<T> &Vi, const Vector2<T> &Vj)
+{
+    if ((Vi.y > P.y) == (Vj.y > P.y)) {
+        return false;
+    }
+    const T dx1 = P.x - Vi.x;
+    const T dx2 = Vj.x - Vi.x;
+    const T dy1 = P.y - Vi.y;
+    const T dy2 = Vj.y - Vi.y;
+    const int8_t dx1s = (dx1 < 0) ? -1 : 1;
+    const int8_t dx2s = (dx2 < 0) ? -1 : 1;
+    const int8_t dy1s = (dy1 < 0) ? -1 : 1;
+    const int8_t dy2s = (dy2 < 0) ? -1 : 1;
+    const int8_t m1 = dx1s * dy2s;
+    const int8_t m2 = dx2s * dy1s;
+    // we avoid the 64 bit multiplies if we can based on sign checks.
+    if (dy2 < 0) {
+        if (m1 > m2) {
+            return true;
+        } else if (m1 < m2) {
+            return false;
+        } else {
+            if (std::is_floating_point<T>::value) {
+                return dx1 * dy2 > dx2 * dy1;
+            } else {
+                return dx1 * (int64_t)dy2 > dx2 * (int64_t)dy1;
+            }
+        }
+    } else {
+        if (m1 < m2) {
+            return true;
+        } else if (m1 > m2) {
+            return false;
+        } else {
+            if (std::is_floating_point<T>::value) {
+                return dx1 * dy2 < dx2 * dy1;
+            } else {
+                return dx1 * (int64_t)dy2 < dx2 * (int64_t)dy1;
+            }
+        }
+    }
+}
+
 template <typename T>
 bool Polygon_outside(const Vector2<T> &P, const Vector2<T> *V, unsigned n)
 {
@@ -54,52 +102,8 @@ bool Polygon_outside(const Vector2<T> &P, const Vector2<T> *V, unsigned n)
         if (j >= n) {
             j = 0;
         }
-        if ((V[i].y > P.y) == (V[j].y > P.y)) {
-            continue;
-        }
-        const T dx1 = P.x - V[i].x;
-        const T dx2 = V[j].x - V[i].x;
-        const T dy1 = P.y - V[i].y;
-        const T dy2 = V[j].y - V[i].y;
-        const int8_t dx1s = (dx1 < 0) ? -1 : 1;
-        const int8_t dx2s = (dx2 < 0) ? -1 : 1;
-        const int8_t dy1s = (dy1 < 0) ? -1 : 1;
-        const int8_t dy2s = (dy2 < 0) ? -1 : 1;
-        const int8_t m1 = dx1s * dy2s;
-        const int8_t m2 = dx2s * dy1s;
-        // we avoid the 64 bit multiplies if we can based on sign checks.
-        if (dy2 < 0) {
-            if (m1 > m2) {
-                outside = !outside;
-            } else if (m1 < m2) {
-                continue;
-            } else {
-                if (std::is_floating_point<T>::value) {
-                    if ( dx1 * dy2 > dx2 * dy1 ) {
-                        outside = !outside;
-                    }
-                } else {
-                    if ( dx1 * (int64_t)dy2 > dx2 * (int64_t)dy1 ) {
-                        outside = !outside;
-                    }
-                }
-            }
-        } else {
-            if (m1 < m2) {
-                outside = !outside;
-            } else if (m1 > m2) {
-                continue;
-            } else {
-                if (std::is_floating_point<T>::value) {
-                    if ( dx1 * dy2 < dx2 * dy1 ) {
-                        outside = !outside;
-                    }
-                } else {
-                    if ( dx1 * (int64_t)dy2 < dx2 * (int64_t)dy1 ) {
-                        outside = !outside;
-                    }
-                }
-            }
+        if (Polygon_edge_crossed(P, V[i], V[j])) {
+            outside = !outside;
         }
     }
     return outside;
@@ -214,3 +218,186 @@ float Polygon_closest_distance_point(const Vector2f *V, unsigned N, const Vector
     }
     return sqrtf(closest_sq);
 }
+
+template <typename T>
+PolygonIndex<T>::~PolygonIndex()
+{
+    delete[] band_start;
+    delete[] band_edges;
+}
+
+/*
+  band number holding y. This only needs to be monotonic in y for
+  every edge straddling y to be found in its band
+ */
+template <typename T>
+int16_t PolygonIndex<T>::band(T y) const
+{
+    const int32_t b = (float(y) - float(min.y)) * band_scale;
+    return constrain_int32(b, 0, num_bands-1);
+}
+
+template <typename T>
+bool PolygonIndex<T>::init(const Vector2<T> *V, unsigned n)
+{
+    delete[] band_start;
+    delete[] band_edges;
+    band_start = nullptr;
+    band_edges = nullptr;
+
+    points = V;
+    num_points = n;
+    if (Polygon_complete(V, n)) {
+        num_points--;
+    }
+    if (num_points < 3) {
+        return false;
+    }
+
+    min = max = V[0];
+    for (uint16_t i=1; i<num_points; i++) {
+        min.x = MIN(min.x, V[i].x);
+        min.y = MIN(min.y, V[i].y);
+        max.x = MAX(max.x, V[i].x);
+        max.y = MAX(max.y, V[i].y);
+    }
+
+    // aim for a few edges per band
+    num_bands = constrain_int16(num_points / 4, 1, MAX_BANDS);
+    const float height = float(max.y) - float(min.y);
+    band_scale = is_positive(height) ? num_bands / height : 0;
+
+    // count the edges in each band, then fill them in
+    band_start = new uint16_t[num_bands+1];
+    if (band_start == nullptr) {
+        return false;
+    }
+    memset(band_start, 0, (num_bands+1)*sizeof(band_start[0]));
+    uint32_t total = 0;
+    for (uint16_t i=0; i<num_points; i++) {
+        const uint16_t j = (i+1 < num_points) ? i+1 : 0;
+        const int16_t b1 = band(MIN(V[i].y, V[j].y));
+        const int16_t b2 = band(MAX(V[i].y, V[j].y));
+        for (int16_t b=b1; b<=b2; b++) {
+            band_start[b+1]++;
+        }
+        total += 1 + b2 - b1;
+    }
+    if (total > UINT16_MAX) {
+        delete[] band_start;
+        band_start = nullptr;
+        return false;
+    }
+    for (uint8_t b=0; b<num_bands; b++) {
+        band_start[b+1] += band_start[b];
+    }
+    band_edges = new uint16_t[total];
+    if (band_edges == nullptr) {
+        delete[] band_start;
+        band_start = nullptr;
+        return false;
+    }
+    uint16_t fill[MAX_BANDS];
+    memcpy(fill, band_start, num_bands*sizeof(fill[0]));
+    for (uint16_t i=0; i<num_points; i++) {
+        const uint16_t j = (i+1 < num_points) ? i+1 : 0;
+        const int16_t b1 = band(MIN(V[i].y, V[j].y));
+        const int16_t b2 = band(MAX(V[i].y, V[j].y));
+        for (int16_t b=b1; b<=b2; b++) {
+            band_edges[fill[b]++] = i;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool PolygonIndex<T>::outside(const Vector2<T> &P) const
+{
+    if (band_start == nullptr) {
+        return points == nullptr || Polygon_outside(P, points, num_points);
+    }
+    if (P.x < min.x || P.x > max.x || P.y < min.y || P.y > max.y) {
+        return true;
+    }
+    // an edge can only be crossed if it straddles P.y, so it must be
+    // in this band
+    const int16_t b = band(P.y);
+    bool outside = true;
+    for (uint16_t k=band_start[b]; k<band_start[b+1]; k++) {
+        const uint16_t i = band_edges[k];
+        const uint16_t j = (i+1 < num_points) ? i+1 : 0;
+        if (Polygon_edge_crossed(P, points[i], points[j])) {
+            outside = !outside;
+        }
+    }
+    return outside;
+}
+
+template <typename T>
+float PolygonIndex<T>::edge_distance_squared(uint16_t edge, const Vector2<T> &P) const
+{
+    const uint16_t next = (edge+1 < num_points) ? edge+1 : 0;
+    const Vector2<T> &v1 = points[edge];
+    const Vector2<T> &v2 = points[next];
+    const Vector2f w { float(v2.x - v1.x), float(v2.y - v1.y) };
+    const Vector2f p { float(P.x - v1.x), float(P.y - v1.y) };
+    return Vector2f::closest_distance_between_radial_and_point_squared(w, p);
+}
+
+/*
+  search outwards from the band holding P. Every edge within distance
+  d of P overlaps a band within d of P.y, so once the next band is
+  further away than the closest edge found the search can stop
+ */
+template <typename T>
+float PolygonIndex<T>::closest_distance_point(const Vector2<T> &P) const
+{
+    if (band_start == nullptr) {
+        if (points == nullptr) {
+            return FLT_MAX;
+        }
+        float closest_sq = FLT_MAX;
+        for (uint16_t i=0; i<num_points; i++) {
+            closest_sq = MIN(closest_sq, edge_distance_squared(i, P));
+        }
+        return sqrtf(closest_sq);
+    }
+
+    const float band_height = is_positive(band_scale) ? 1.0 / band_scale : 0;
+    const float y = float(P.y) - float(min.y);
+    const int16_t start = band(P.y);
+    float closest_sq = FLT_MAX;
+    for (int16_t step=0; step<num_bands; step++) {
+        bool searched = false;
+        for (int8_t dir=-1; dir<=1; dir+=2) {
+            if (step == 0 && dir == 1) {
+                break;
+            }
+            const int16_t b = start + dir*step;
+            if (b < 0 || b >= num_bands) {
+                continue;
+            }
+            // vertical gap between P and this band
+            float gap = 0;
+            if (y < b * band_height) {
+                gap = b * band_height - y;
+            } else if (y > (b+1) * band_height) {
+                gap = y - (b+1) * band_height;
+            }
+            if (sq(gap) > closest_sq || (band_height <= 0 && b != start)) {
+                continue;
+            }
+            searched = true;
+            for (uint16_t k=band_start[b]; k<band_start[b+1]; k++) {
+                closest_sq = MIN(closest_sq, edge_distance_squared(band_edges[k], P));
+            }
+        }
+        if (!searched && step > 0) {
+            break;
+        }
+    }
+    return sqrtf(closest_sq);
+}
+
+template class PolygonIndex<int32_t>;
+template class PolygonIndex<float>;
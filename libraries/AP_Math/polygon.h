@@ -44,3 +44,44 @@ float Polygon_closest_distance_line(const Vector2f *V, unsigned N, const Vector2
   closed polygon V, defined by N points
  */
 float Polygon_closest_distance_point(const Vector2f *V, unsigned N, const Vector2f &p);
+
+/*
+  acceleration structure for repeated queries against one polygon,
+  such as a fence. The polygon is split into horizontal bands, each
+  listing the edges that overlap it, so a query only visits the edges
+  near the point. Results match Polygon_outside() and
+  Polygon_closest_distance_point() on the same points. If the index
+  could not be allocated the queries fall back to those functions.
+ */
+template <typename T>
+class PolygonIndex {
+public:
+    PolygonIndex() {}
+    ~PolygonIndex();
+
+    CLASS_NO_COPY(PolygonIndex);
+
+    // build the index. V must remain valid while the index is used
+    bool init(const Vector2<T> *V, unsigned n);
+
+    // true if P is outside the polygon
+    bool outside(const Vector2<T> &P) const WARN_IF_UNUSED;
+
+    // distance from P to the closest edge of the polygon
+    float closest_distance_point(const Vector2<T> &P) const WARN_IF_UNUSED;
+
+private:
+    static constexpr uint8_t MAX_BANDS = 64;
+
+    int16_t band(T y) const;
+    float edge_distance_squared(uint16_t edge, const Vector2<T> &P) const;
+
+    const Vector2<T> *points = nullptr;
+    uint16_t num_points = 0;    // not counting a repeated first point
+    Vector2<T> min;
+    Vector2<T> max;
+    float band_scale;
+    uint8_t num_bands;
+    uint16_t *band_start = nullptr;  // num_bands+1 offsets into band_edges
+    uint16_t *band_edges = nullptr;  // index of the first point of each edge
+};
@@ -0,0 +1,108 @@
+#include <AP_gtest.h>
+
+#include <AP_Math/AP_Math.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+// results are compared exactly where they must be computed the same way
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+
+#define MAX_DIM 12
+
+// a well conditioned matrix with a different pattern for each size
+template <typename T>
+static void make_matrix(T *A, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++) {
+        for (uint16_t j = 0; j < n; j++) {
+            A[i*n + j] = ((i * 7 + j * 13 + n) % 11) * 0.1 - 0.5;
+        }
+        A[i*n + i] += n;
+    }
+}
+
+template <typename T>
+static void check_inverse(uint16_t n, T tolerance)
+{
+    T A[MAX_DIM*MAX_DIM], inv[MAX_DIM*MAX_DIM], product[MAX_DIM*MAX_DIM];
+    make_matrix(A, n);
+    EXPECT_TRUE(mat_inverse(A, inv, n));
+    mat_mul(A, inv, product, n);
+    for (uint16_t i = 0; i < n; i++) {
+        for (uint16_t j = 0; j < n; j++) {
+            EXPECT_NEAR(i == j ? 1 : 0, product[i*n + j], tolerance);
+        }
+    }
+
+    // inverting in place gives the same result
+    EXPECT_TRUE(mat_inverse(A, A, n));
+    for (uint16_t i = 0; i < n*n; i++) {
+        EXPECT_EQ(inv[i], A[i]);
+    }
+}
+
+TEST(MatrixAlgTest, Inverse)
+{
+    for (uint16_t n = 2; n <= MAX_DIM; n++) {
+        check_inverse<float>(n, 1.0e-5f);
+        check_inverse<double>(n, 1.0e-12);
+    }
+}
+
+// rows in the wrong order need pivoting
+TEST(MatrixAlgTest, InversePivot)
+{
+    const float A[36] {
+        0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 2, 0,
+        0, 0, 0, 3, 0, 0,
+        0, 0, 4, 0, 0, 0,
+        0, 5, 0, 0, 0, 0,
+        6, 0, 0, 0, 0, 0,
+    };
+    float inv[36];
+    EXPECT_TRUE(mat_inverse(A, inv, 6));
+    for (uint16_t i = 0; i < 6; i++) {
+        for (uint16_t j = 0; j < 6; j++) {
+            EXPECT_FLOAT_EQ(i + j == 5 ? 1.0f / (6 - i) : 0, inv[i*6 + j]);
+        }
+    }
+}
+
+TEST(MatrixAlgTest, InverseSingular)
+{
+    for (uint16_t n = 3; n <= MAX_DIM; n++) {
+        float A[MAX_DIM*MAX_DIM], inv[MAX_DIM*MAX_DIM];
+        make_matrix(A, n);
+        // no element in the last column
+        for (uint16_t i = 0; i < n; i++) {
+            A[i*n + n-1] = 0;
+        }
+        EXPECT_FALSE(mat_inverse(A, inv, n));
+    }
+}
+
+TEST(MatrixAlgTest, Multiply)
+{
+    for (uint16_t n = 2; n <= MAX_DIM; n++) {
+        double A[MAX_DIM*MAX_DIM], B[MAX_DIM*MAX_DIM], C[MAX_DIM*MAX_DIM];
+        make_matrix(A, n);
+        make_matrix(B, n);
+        B[n-1] = 3;
+        mat_mul(A, B, C, n);
+        for (uint16_t i = 0; i < n; i++) {
+            for (uint16_t j = 0; j < n; j++) {
+                double sum = 0;
+                for (uint16_t k = 0; k < n; k++) {
+                    sum += A[i*n + k] * B[k*n + j];
+                }
+                EXPECT_EQ(sum, C[i*n + j]);
+            }
+        }
+    }
+}
+
+#pragma GCC diagnostic pop
+
+AP_GTEST_MAIN()
@@ -356,6 +356,71 @@ TEST(Polygon, simple)
     TEST_POLYGON_POINTS(SIMPLE_boundary, SIMPLE_test_points);
 }
 
+/*
+  random star shaped polygons with many vertices, checking the index
+  gives the same answers as the plain functions
+ */
+template <typename T>
+static void random_polygon(Vector2<T> *V, uint16_t n, float scale, float offset)
+{
+    for (uint16_t i=0; i<n-1; i++) {
+        const float angle = i * M_2PI / (n-1);
+        const float radius = scale * (0.2f + 0.8f * (unsigned(random()) % 1000) * 0.001f);
+        V[i].x = offset + radius * cosf(angle);
+        V[i].y = offset + radius * sinf(angle);
+    }
+    V[n-1] = V[0];
+}
+
+template <typename T>
+static Vector2<T> random_point(float scale, float offset)
+{
+    Vector2<T> P;
+    P.x = offset + scale * 1.2f * ((int32_t(unsigned(random()) % 2001) - 1000) * 0.001f);
+    P.y = offset + scale * 1.2f * ((int32_t(unsigned(random()) % 2001) - 1000) * 0.001f);
+    return P;
+}
+
+TEST(Polygon, index_outside_float)
+{
+    Vector2f V[201];
+    for (uint8_t p=0; p<20; p++) {
+        const uint16_t n = 4 + (unsigned(random()) % (ARRAY_SIZE(V)-4));
+        random_polygon(V, n, 100.0f, 10.0f);
+        PolygonIndex<float> index;
+        EXPECT_TRUE(index.init(V, n));
+        for (uint16_t i=0; i<500; i++) {
+            const Vector2f P = random_point<float>(100.0f, 10.0f);
+            EXPECT_EQ(Polygon_outside(P, V, n), index.outside(P));
+            EXPECT_FLOAT_EQ(Polygon_closest_distance_point(V, n, P), index.closest_distance_point(P));
+        }
+        // vertices are the hardest case for the crossing test
+        for (uint16_t i=0; i<n; i++) {
+            EXPECT_EQ(Polygon_outside(V[i], V, n), index.outside(V[i]));
+        }
+    }
+}
+
+TEST(Polygon, index_outside_latlon)
+{
+    Vector2l V[201];
+    for (uint8_t p=0; p<20; p++) {
+        const uint16_t n = 4 + (unsigned(random()) % (ARRAY_SIZE(V)-4));
+        random_polygon(V, n, 1.0e5, -353632610);
+        // fences are stored without the closing point
+        const uint16_t num_fence_points = n - 1;
+        PolygonIndex<int32_t> index;
+        EXPECT_TRUE(index.init(V, num_fence_points));
+        for (uint16_t i=0; i<500; i++) {
+            const Vector2l P = random_point<int32_t>(1.0e5, -353632610);
+            EXPECT_EQ(Polygon_outside(P, V, num_fence_points), index.outside(P));
+        }
+        for (uint16_t i=0; i<num_fence_points; i++) {
+            EXPECT_EQ(Polygon_outside(V[i], V, num_fence_points), index.outside(V[i]));
+        }
+    }
+}
+
 AP_GTEST_MAIN()
 
 
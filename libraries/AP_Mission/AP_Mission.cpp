@@ -512,6 +512,18 @@ bool AP_Mission::get_next_nav_cmd(uint16_t start_index, Mission_Command& cmd)
 {
     // search until the end of the mission command list
     for (uint16_t cmd_index = start_index; cmd_index < (unsigned)_cmd_total; cmd_index++) {
+#if AP_MISSION_CACHE_ENABLED
+        // skip over do commands, which can't lead to a nav command
+        {
+            WITH_SEMAPHORE(_rsem);
+            if (cmd_index < _cache.size && cache_update_indexes()) {
+                cmd_index = _cache.next_stop[cmd_index];
+                if (cmd_index >= (unsigned)_cmd_total) {
+                    return false;
+                }
+            }
+        }
+#endif
         // get next command
         if (!get_next_cmd(cmd_index, cmd, false)) {
             // no more commands so return failure
@@ -777,6 +789,25 @@ bool AP_Mission::read_cmd_from_storage(uint16_t index, Mission_Command& cmd) con
         return false;
     }
 
+#if AP_MISSION_CACHE_ENABLED
+    if (cache_read(index, cmd)) {
+        return true;
+    }
+#endif
+
+    unpack_cmd_from_storage(index, cmd);
+
+#if AP_MISSION_CACHE_ENABLED
+    cache_store(cmd);
+#endif
+
+    // return success
+    return true;
+}
+
+/// unpack_cmd_from_storage - decode a command from its storage format
+void AP_Mission::unpack_cmd_from_storage(uint16_t index, Mission_Command& cmd) const
+{
     // ensure all bytes of cmd are zeroed
     cmd = {};
 
@@ -834,9 +865,6 @@ bool AP_Mission::read_cmd_from_storage(uint16_t index, Mission_Command& cmd) con
 
     // set command's index to it's position in eeprom
     cmd.index = index;
-
-    // return success
-    return true;
 }
 
 bool AP_Mission::stored_in_location(uint16_t id)
@@ -921,6 +949,10 @@ bool AP_Mission::write_cmd_to_storage(uint16_t index, const Mission_Command& cmd
         _storage.write_block(pos_in_storage+5, packed.bytes, 10);
     }
 
+#if AP_MISSION_CACHE_ENABLED
+    cache_invalidate(index);
+#endif
+
     // remember when the mission last changed
     _last_change_time_ms = AP_HAL::millis();
 
@@ -2207,11 +2239,7 @@ bool AP_Mission::jump_to_tag(const uint16_t tag)
 // Returns 0 if no appropriate JUMP_TAG match can be found.
 uint16_t AP_Mission::get_index_of_jump_tag(const uint16_t tag) const
 {
-    const auto count = num_commands();
-    for (uint16_t i = 1; i < count; i++) {
-        if (get_command_id(i) != uint16_t(MAV_CMD_JUMP_TAG)) {
-            continue;
-        }
+    for (uint16_t i = find_next_cmd_with_id(MAV_CMD_JUMP_TAG, 0); i != 0; i = find_next_cmd_with_id(MAV_CMD_JUMP_TAG, i)) {
         Mission_Command tmp;
         if (!read_cmd_from_storage(i, tmp)) {
             continue;
@@ -2319,45 +2347,60 @@ void AP_Mission::check_eeprom_version()
 // be found.
 uint16_t AP_Mission::get_landing_sequence_start(const Location &current_loc)
 {
-    const Location::AltFrame current_loc_alt_frame = current_loc.get_alt_frame();
+#if AP_MISSION_CACHE_ENABLED
+    if (update_landing_index()) {
+        auto distance_fn = [&](uint16_t i) -> float {
+            return landing_sequence_distance(i, current_loc);
+        };
+        uint16_t landing_start_index;
+        float distance;
+        if (!_land_start_index.find_nearest(current_loc, distance_fn, landing_start_index, distance)) {
+            return 0;
+        }
+        return landing_start_index;
+    }
+#endif
+
     uint16_t landing_start_index = 0;
     float min_distance = -1;
 
     // Go through mission looking for nearest landing start command
-    const auto count = num_commands();
-    for (uint16_t i = 1; i < count; i++) {
-        if (get_command_id(i) != uint16_t(MAV_CMD_DO_LAND_START)) {
+    for (uint16_t i = find_next_cmd_with_id(MAV_CMD_DO_LAND_START, 0); i != 0; i = find_next_cmd_with_id(MAV_CMD_DO_LAND_START, i)) {
+        const float tmp_distance = landing_sequence_distance(i, current_loc);
+        if (tmp_distance < 0) {
             continue;
         }
-        Mission_Command tmp;
-        if (!read_cmd_from_storage(i, tmp)) {
-            continue;
-        }
-        if (tmp.id == MAV_CMD_DO_LAND_START) {
-            if (!tmp.content.location.initialised() && !get_next_nav_cmd(i, tmp)) {
-                // command does not have a valid location and cannot get next valid
-                continue;
-            }
-
-            float tmp_distance;
-            if (current_loc_alt_frame == tmp.content.location.get_alt_frame() || tmp.content.location.change_alt_frame(current_loc_alt_frame)) {
-                // 3D distance - altitudes are able to be compared in the same frame
-                tmp_distance = tmp.content.location.get_distance_NED(current_loc).length();
-            } else {
-                // 2D distance - no altitude
-                tmp_distance = tmp.content.location.get_distance(current_loc);
-            }
-            
-            if (min_distance < 0 || tmp_distance < min_distance) {
-                min_distance = tmp_distance;
-                landing_start_index = i;
-            }
+        if (min_distance < 0 || tmp_distance < min_distance) {
+            min_distance = tmp_distance;
+            landing_start_index = i;
         }
     }
 
     return landing_start_index;
 }
 
+// return the distance from current_loc to the landing sequence
+// starting at index, or -1 if it is not a usable DO_LAND_START
+float AP_Mission::landing_sequence_distance(uint16_t index, const Location &current_loc)
+{
+    Mission_Command tmp;
+    if (!read_cmd_from_storage(index, tmp) || tmp.id != MAV_CMD_DO_LAND_START) {
+        return -1;
+    }
+    if (!tmp.content.location.initialised() && !get_next_nav_cmd(index, tmp)) {
+        // command does not have a valid location and cannot get next valid
+        return -1;
+    }
+
+    const Location::AltFrame current_loc_alt_frame = current_loc.get_alt_frame();
+    if (current_loc_alt_frame == tmp.content.location.get_alt_frame() || tmp.content.location.change_alt_frame(current_loc_alt_frame)) {
+        // 3D distance - altitudes are able to be compared in the same frame
+        return tmp.content.location.get_distance_NED(current_loc).length();
+    }
+    // 2D distance - no altitude
+    return tmp.content.location.get_distance(current_loc);
+}
+
 /*
    find the nearest landing sequence starting point (DO_LAND_START) and
    switch to that mission item.  Returns false if no DO_LAND_START
@@ -2388,11 +2431,7 @@ bool AP_Mission::jump_to_abort_landing_sequence(const Location &current_loc)
     uint16_t abort_index = 0;
     float min_distance = FLT_MAX;
 
-    const auto count = num_commands();
-    for (uint16_t i = 1; i < count; i++) {
-        if (get_command_id(i) != uint16_t(MAV_CMD_DO_GO_AROUND)) {
-            continue;
-        }
+    for (uint16_t i = find_next_cmd_with_id(MAV_CMD_DO_GO_AROUND, 0); i != 0; i = find_next_cmd_with_id(MAV_CMD_DO_GO_AROUND, i)) {
         Mission_Command tmp;
         if (!read_cmd_from_storage(i, tmp)) {
             continue;
@@ -2702,6 +2741,14 @@ const char *AP_Mission::Mission_Command::type() const
  */
 uint16_t AP_Mission::get_command_id(uint16_t index) const
 {
+#if AP_MISSION_CACHE_ENABLED
+    {
+        WITH_SEMAPHORE(_rsem);
+        if (index < _cache.size && _cache.cmds[index].index == index) {
+            return _cache.cmds[index].id;
+        }
+    }
+#endif
     const uint16_t pos_in_storage = 4 + (index * AP_MISSION_EEPROM_COMMAND_SIZE);
     uint8_t b[3] {};
     if (!_storage.read_block(b, pos_in_storage, sizeof(b))) {
@@ -2716,16 +2763,41 @@ uint16_t AP_Mission::get_command_id(uint16_t index) const
     return id;
 }
 
+/*
+  find the next command with a given ID after prev. Returns 0 if there
+  are no more
+ */
+uint16_t AP_Mission::find_next_cmd_with_id(uint16_t id, uint16_t prev) const
+{
+#if AP_MISSION_CACHE_ENABLED
+    if (is_cache_marker(id)) {
+        WITH_SEMAPHORE(_rsem);
+        if (cache_update_indexes()) {
+            for (uint16_t i = 0; i < _cache.num_markers; i++) {
+                const uint16_t index = _cache.markers[i];
+                if (index > prev && get_command_id(index) == id) {
+                    return index;
+                }
+            }
+            return 0;
+        }
+    }
+#endif
+    const auto count = num_commands();
+    for (uint16_t i = prev+1; i < count; i++) {
+        if (get_command_id(i) == id) {
+            return i;
+        }
+    }
+    return 0;
+}
+
 /*
   see if the mission contains a particular item
  */
 bool AP_Mission::contains_item(MAV_CMD command) const
 {
-    const auto count = num_commands();
-    for (uint16_t i = 1; i < count; i++) {
-        if (get_command_id(i) != uint16_t(command)) {
-            continue;
-        }
+    for (uint16_t i = find_next_cmd_with_id(command, 0); i != 0; i = find_next_cmd_with_id(command, i)) {
         // confirm with full read
         Mission_Command tmp;
         if (!read_cmd_from_storage(i, tmp)) {
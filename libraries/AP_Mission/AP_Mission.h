@@ -18,6 +18,7 @@
 #include <AP_Math/AP_Math.h>
 #include <AP_Common/AP_Common.h>
 #include <AP_Common/Location.h>
+#include <AP_Common/LocationIndex.h>
 #include <AP_Param/AP_Param.h>
 #include <StorageManager/StorageManager.h>
 #include <AP_Common/float16.h>
@@ -897,9 +898,52 @@ private:
     bool _failed_sdcard_storage;
 #endif
 
+    // distance to a landing sequence, or -1 if it can't be used
+    float landing_sequence_distance(uint16_t index, const Location &current_loc);
+
     // fast call to get command ID of a mission index
     uint16_t get_command_id(uint16_t index) const;
 
+    // return the first index after prev holding a command with this
+    // id, or 0 if there are none
+    uint16_t find_next_cmd_with_id(uint16_t id, uint16_t prev) const;
+
+    // unpack a command from storage, index must be in range
+    void unpack_cmd_from_storage(uint16_t index, Mission_Command& cmd) const;
+
+#if AP_MISSION_CACHE_ENABLED
+    /*
+      decoded copy of the first commands of the mission. An entry is
+      loaded if its index field matches its position. The indexes
+      below are rebuilt on first use after the mission changes
+     */
+    mutable struct {
+        Mission_Command *cmds;
+        uint16_t size;
+        bool indexes_valid;
+        uint16_t indexed_total;
+        // for each cached index, the first nav or jump command at or
+        // after it
+        uint16_t *next_stop;
+        // indexes of commands found with find_next_cmd_with_id()
+        uint16_t *markers;
+        uint16_t num_markers;
+        uint16_t markers_size;
+        // cleared when the mission changes
+        bool land_index_valid;
+    } _cache;
+
+    // positions of DO_LAND_START commands
+    LocationIndex _land_start_index;
+    bool update_landing_index();
+
+    bool cache_read(uint16_t index, Mission_Command& cmd) const;
+    void cache_store(const Mission_Command& cmd) const;
+    void cache_invalidate(uint16_t index);
+    bool cache_update_indexes() const;
+    static bool is_cache_marker(uint16_t id);
+#endif
+
     // memoisation of contains-relative:
     bool _contains_terrain_alt_items;  // true if the mission has terrain-relative items
     uint32_t _last_contains_relative_calculated_ms;  // will be equal to _last_change_time_ms if _contains_terrain_alt_items is up-to-date
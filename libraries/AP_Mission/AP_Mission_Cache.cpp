@@ -0,0 +1,189 @@
+/// @file    AP_Mission_Cache.cpp
+/// @brief   In-RAM copy of decoded mission commands and indexes over them
+
+#include "AP_Mission_config.h"
+
+#if AP_MISSION_CACHE_ENABLED
+
+#include "AP_Mission.h"
+
+// the cache grows in steps of this many commands
+#define AP_MISSION_CACHE_CHUNK 32
+
+/*
+  return true if the command is one we keep the index of, so that
+  find_next_cmd_with_id() does not need to scan the mission
+ */
+bool AP_Mission::is_cache_marker(uint16_t id)
+{
+    switch (id) {
+    case MAV_CMD_DO_LAND_START:
+    case MAV_CMD_DO_GO_AROUND:
+    case MAV_CMD_JUMP_TAG:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*
+  get a command from the cache. Caller must hold _rsem and have checked
+  the index is in range
+ */
+bool AP_Mission::cache_read(uint16_t index, Mission_Command& cmd) const
+{
+    if (index >= _cache.size || _cache.cmds[index].index != index) {
+        return false;
+    }
+    cmd = _cache.cmds[index];
+    return true;
+}
+
+/*
+  store a command just read from storage in the cache, growing it if
+  needed. Caller must hold _rsem
+ */
+void AP_Mission::cache_store(const Mission_Command& cmd) const
+{
+    const uint16_t index = cmd.index;
+    if (index >= AP_MISSION_CACHE_MAX_COMMANDS) {
+        return;
+    }
+    if (index >= _cache.size) {
+        const uint16_t new_size = MIN(((index / AP_MISSION_CACHE_CHUNK) + 1) * AP_MISSION_CACHE_CHUNK,
+                                      AP_MISSION_CACHE_MAX_COMMANDS);
+        Mission_Command *new_cmds = new Mission_Command[new_size];
+        uint16_t *new_next_stop = new uint16_t[new_size];
+        if (new_cmds == nullptr || new_next_stop == nullptr) {
+            delete[] new_cmds;
+            delete[] new_next_stop;
+            return;
+        }
+        for (uint16_t i = 0; i < new_size; i++) {
+            if (i < _cache.size) {
+                new_cmds[i] = _cache.cmds[i];
+            } else {
+                new_cmds[i].index = AP_MISSION_CMD_INDEX_NONE;
+            }
+        }
+        delete[] _cache.cmds;
+        delete[] _cache.next_stop;
+        _cache.cmds = new_cmds;
+        _cache.next_stop = new_next_stop;
+        _cache.size = new_size;
+        // next_stop needs to be filled in for the new entries
+        _cache.indexes_valid = false;
+    }
+    _cache.cmds[index] = cmd;
+}
+
+/*
+  forget a cached command after it is written. Caller must hold _rsem
+ */
+void AP_Mission::cache_invalidate(uint16_t index)
+{
+    if (index < _cache.size) {
+        _cache.cmds[index].index = AP_MISSION_CMD_INDEX_NONE;
+    }
+    _cache.indexes_valid = false;
+    _cache.land_index_valid = false;
+}
+
+/*
+  rebuild the indexes if the mission has changed since they were
+  last built. This only needs the command IDs, so is much cheaper than
+  decoding every command. Caller must hold _rsem. Returns false if the
+  indexes are not available
+ */
+bool AP_Mission::cache_update_indexes() const
+{
+    const uint16_t total = num_commands();
+    if (_cache.indexes_valid && _cache.indexed_total == total) {
+        return true;
+    }
+
+    // walk backwards so each entry knows the next nav or jump command
+    // after it. Beyond the end of the cache the search continues
+    // from storage, so use the first uncached index as the stop
+    uint16_t num_markers = 0;
+    uint16_t next_stop = MIN(total, _cache.size);
+    for (int32_t i = total-1; i > 0; i--) {
+        const uint16_t id = get_command_id(i);
+        if (is_cache_marker(id)) {
+            num_markers++;
+        }
+        if (i >= _cache.size) {
+            continue;
+        }
+        Mission_Command tmp {};
+        tmp.id = id;
+        if (is_nav_cmd(tmp) || id == MAV_CMD_DO_JUMP || id == MAV_CMD_DO_JUMP_TAG) {
+            next_stop = i;
+        }
+        _cache.next_stop[i] = next_stop;
+    }
+    if (_cache.size > 0) {
+        // index 0 is home, which is a waypoint
+        _cache.next_stop[0] = 0;
+    }
+
+    if (num_markers > _cache.markers_size) {
+        uint16_t *new_markers = new uint16_t[num_markers];
+        if (new_markers == nullptr) {
+            return false;
+        }
+        delete[] _cache.markers;
+        _cache.markers = new_markers;
+        _cache.markers_size = num_markers;
+    }
+    _cache.num_markers = 0;
+    for (uint16_t i = 1; i < total && _cache.num_markers < num_markers; i++) {
+        if (is_cache_marker(get_command_id(i))) {
+            _cache.markers[_cache.num_markers++] = i;
+        }
+    }
+
+    if (_cache.indexed_total != total) {
+        _cache.land_index_valid = false;
+    }
+    _cache.indexed_total = total;
+    _cache.indexes_valid = true;
+    return true;
+}
+
+/*
+  rebuild the spatial index of DO_LAND_START commands if the mission
+  has changed. Returns false if it is not available
+ */
+bool AP_Mission::update_landing_index()
+{
+    WITH_SEMAPHORE(_rsem);
+    if (!cache_update_indexes()) {
+        return false;
+    }
+    if (_cache.land_index_valid) {
+        return true;
+    }
+    uint16_t count = 0;
+    for (uint16_t i = find_next_cmd_with_id(MAV_CMD_DO_LAND_START, 0); i != 0; i = find_next_cmd_with_id(MAV_CMD_DO_LAND_START, i)) {
+        count++;
+    }
+    if (!_land_start_index.reset(count)) {
+        return false;
+    }
+    for (uint16_t i = find_next_cmd_with_id(MAV_CMD_DO_LAND_START, 0); i != 0; i = find_next_cmd_with_id(MAV_CMD_DO_LAND_START, i)) {
+        Mission_Command tmp;
+        if (!read_cmd_from_storage(i, tmp)) {
+            continue;
+        }
+        if (!tmp.content.location.initialised() && !get_next_nav_cmd(i, tmp)) {
+            continue;
+        }
+        _land_start_index.add(tmp.content.location, i);
+    }
+    _land_start_index.build();
+    _cache.land_index_valid = true;
+    return true;
+}
+
+#endif  // AP_MISSION_CACHE_ENABLED
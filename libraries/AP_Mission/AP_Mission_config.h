@@ -7,3 +7,18 @@
 #ifndef AP_MISSION_NAV_PAYLOAD_PLACE_ENABLED
 #define AP_MISSION_NAV_PAYLOAD_PLACE_ENABLED 1
 #endif
+
+// keep a decoded copy of the mission in RAM, with indexes of landing
+// and jump-tag commands, to avoid repeated scans of storage
+#ifndef AP_MISSION_CACHE_ENABLED
+#define AP_MISSION_CACHE_ENABLED (AP_MISSION_ENABLED && HAL_MEM_CLASS >= HAL_MEM_CLASS_500)
+#endif
+
+// number of commands from the start of the mission that are cached
+#ifndef AP_MISSION_CACHE_MAX_COMMANDS
+#if HAL_MEM_CLASS >= HAL_MEM_CLASS_1000
+#define AP_MISSION_CACHE_MAX_COMMANDS 1024
+#else
+#define AP_MISSION_CACHE_MAX_COMMANDS 256
+#endif
+#endif
@@ -124,3 +124,66 @@ void AP_OSD_Backend::init_symbol_set(uint8_t *lookup_table, const uint8_t size)
 {
     memcpy(lookup_table, symbols, size);
 }
+
+// set the size of the frame for the current text resolution
+void AP_OSD_Backend::TextFrame::set_size(uint8_t lines, uint8_t columns)
+{
+    video_lines = MIN(lines, max_lines);
+    video_columns = MIN(columns, max_columns);
+}
+
+// clear the frame being drawn
+void AP_OSD_Backend::TextFrame::clear(void)
+{
+    memset(frame, ' ', sizeof(frame));
+}
+
+// draw text into the frame
+void AP_OSD_Backend::TextFrame::write(uint8_t x, uint8_t y, const char *text)
+{
+    if (y >= video_lines || text == nullptr) {
+        return;
+    }
+    while ((x < video_columns) && (*text != 0)) {
+        frame[y][x] = *text;
+        ++text;
+        ++x;
+    }
+}
+
+// the remote screen has been cleared, so all text needs sending
+void AP_OSD_Backend::TextFrame::remote_cleared(void)
+{
+    memset(shadow_frame, ' ', sizeof(shadow_frame));
+}
+
+/*
+  find the next run of changed characters at or after x,y and record
+  it as sent. Unchanged gaps shorter than max_gap are included in the
+  run, which is at most max_len long. Returns false when nothing else
+  has changed
+ */
+bool AP_OSD_Backend::TextFrame::next_changed_run(uint8_t &x, uint8_t &y, uint8_t &len, uint8_t max_len, uint8_t max_gap)
+{
+    for (; y < video_lines; y++, x = 0) {
+        for (; x < video_columns; x++) {
+            if (frame[y][x] == shadow_frame[y][x]) {
+                continue;
+            }
+            // collect a run up to the last changed character that
+            // isn't too far from the one before it
+            uint8_t end = x + 1;
+            for (uint8_t i = end; i < video_columns && i - x < max_len; i++) {
+                if (frame[y][i] != shadow_frame[y][i]) {
+                    end = i + 1;
+                } else if (i - end >= max_gap) {
+                    break;
+                }
+            }
+            len = end - x;
+            memcpy(&shadow_frame[y][x], &frame[y][x], len);
+            return true;
+        }
+    }
+    return false;
+}
@@ -66,6 +66,59 @@ public:
         return &_osd;
     }
 
+    /*
+      a frame of text and a copy of what has been sent to a remote
+      OSD, so backends drawing over a link can send only the
+      characters that changed
+     */
+    class TextFrame {
+    public:
+        TextFrame()
+        {
+            clear();
+            remote_cleared();
+        }
+
+        // largest text resolution, HD 60x22
+        static const uint8_t max_lines = 22;
+        static const uint8_t max_columns = 60;
+
+        // set the size of the frame for the current text resolution
+        void set_size(uint8_t lines, uint8_t columns);
+
+        // clear the frame being drawn
+        void clear(void);
+
+        // draw text into the frame
+        void write(uint8_t x, uint8_t y, const char *text);
+
+        // the remote screen has been cleared, so all text needs sending
+        void remote_cleared(void);
+
+        /*
+          find the next run of changed characters at or after x,y and
+          record it as sent. Unchanged gaps shorter than max_gap are
+          included in the run, which is at most max_len long. Returns
+          false when nothing else has changed
+         */
+        bool next_changed_run(uint8_t &x, uint8_t &y, uint8_t &len, uint8_t max_len, uint8_t max_gap);
+
+        // characters of a line of the frame
+        const uint8_t *get_line(uint8_t y) const
+        {
+            return frame[y];
+        }
+
+    private:
+        // frame being drawn
+        uint8_t frame[max_lines][max_columns];
+        // frame the remote has
+        uint8_t shadow_frame[max_lines][max_columns];
+
+        uint8_t video_lines = 16;
+        uint8_t video_columns = 30;
+    };
+
 protected:
     AP_OSD& _osd;
 
@@ -67,11 +67,27 @@ void AP_OSD_MSP_DisplayPort::clear(void)
     if (_osd.get_current_screen() < AP_OSD_NUM_DISPLAY_SCREENS) {
         const uint8_t txt_resolution = _osd.screen[_osd.get_current_screen()].get_txt_resolution();
         const uint8_t font_index = _osd.screen[_osd.get_current_screen()].get_font_index();
-        _displayport->msp_displayport_set_options(font_index, txt_resolution);
+        if (txt_resolution != last_txt_resolution || font_index != last_font_index) {
+            last_txt_resolution = txt_resolution;
+            last_font_index = font_index;
+            switch (txt_resolution) {
+            case 1:
+                text_frame.set_size(18, 50);
+                break;
+            case 2:
+                text_frame.set_size(22, 60);
+                break;
+            default:
+                text_frame.set_size(16, 30);
+                break;
+            }
+            // send the new options and redraw the remote with them
+            last_full_redraw_ms = 0;
+        }
     }
 
-    // clear remote MSP screen
-    _displayport->msp_displayport_clear_screen();
+    // the remote MSP screen is only cleared on a full redraw, see flush()
+    text_frame.clear();
 
     // toggle flashing @1Hz
     const uint32_t now = AP_HAL::millis();
@@ -83,7 +99,7 @@ void AP_OSD_MSP_DisplayPort::clear(void)
 
 void AP_OSD_MSP_DisplayPort::write(uint8_t x, uint8_t y, const char* text)
 {
-    _displayport->msp_displayport_write_string(x, y, 0, text);
+    text_frame.write(x, y, text);
 }
 
 uint8_t AP_OSD_MSP_DisplayPort::format_string_for_osd(char* buff, uint8_t size, bool decimal_packed, const char *fmt, va_list ap)
@@ -95,15 +111,53 @@ uint8_t AP_OSD_MSP_DisplayPort::format_string_for_osd(char* buff, uint8_t size,
 
 void AP_OSD_MSP_DisplayPort::flush(void)
 {
-    // grab the screen and force a redraw
+    // grab the screen
     _displayport->msp_displayport_grab();
-    _displayport->msp_displayport_draw_screen();
+
+    const uint32_t now = AP_HAL::millis();
+    const bool full_redraw = last_full_redraw_ms == 0 || now - last_full_redraw_ms >= MSP_DISPLAYPORT_FULL_REDRAW_MS;
+    if (full_redraw) {
+        last_full_redraw_ms = MAX(now, 1U);
+    }
+    transfer_frame(full_redraw);
 
     // ok done processing displayport data
     // let's process incoming MSP frames (and reply if needed)
     _displayport->process_incoming_data();
 }
 
+/*
+  send the characters that have changed since the last frame as
+  strings, and ask the remote to draw them. On a full redraw the
+  options are resent, in case the remote OSD restarted, the remote
+  screen is cleared and everything is sent
+ */
+void AP_OSD_MSP_DisplayPort::transfer_frame(bool full_redraw)
+{
+    if (full_redraw) {
+        if (last_txt_resolution >= 0) {
+            _displayport->msp_displayport_set_options(last_font_index, last_txt_resolution);
+        }
+        _displayport->msp_displayport_clear_screen();
+        text_frame.remote_cleared();
+    }
+
+    bool changed = full_redraw;
+    uint8_t x = 0, y = 0, len;
+    while (text_frame.next_changed_run(x, y, len, OSD_MSP_DISPLAYPORT_MAX_STRING_LENGTH, MSP_DISPLAYPORT_MAX_GAP)) {
+        char text[OSD_MSP_DISPLAYPORT_MAX_STRING_LENGTH+1];
+        memcpy(text, &text_frame.get_line(y)[x], len);
+        text[len] = 0;
+        _displayport->msp_displayport_write_string(x, y, 0, text);
+        changed = true;
+        x += len;
+    }
+
+    if (changed) {
+        _displayport->msp_displayport_draw_screen();
+    }
+}
+
 void AP_OSD_MSP_DisplayPort::init_symbol_set(uint8_t *lookup_table, const uint8_t size)
 {
     const AP_MSP *msp = AP::msp();
@@ -3,6 +3,12 @@
 
 #if HAL_WITH_MSP_DISPLAYPORT
 
+// the whole screen is redrawn this often, in case the remote OSD has lost what we sent
+#define MSP_DISPLAYPORT_FULL_REDRAW_MS 1000
+
+// unchanged characters shorter than this between changed ones are resent rather than starting a new string
+#define MSP_DISPLAYPORT_MAX_GAP 6
+
 class AP_OSD_MSP_DisplayPort : public AP_OSD_Backend
 {
     using AP_OSD_Backend::AP_OSD_Backend;
@@ -54,8 +60,20 @@ protected:
 private:
     void setup_defaults(void);
 
+    // send the characters that differ from what the remote OSD has
+    void transfer_frame(bool full_redraw);
+
     AP_MSP_Telem_Backend* _displayport;
 
+    // frame being drawn and what the remote OSD has, used to only send changed characters
+    TextFrame text_frame;
+
+    // options sent to the remote OSD, the remote is redrawn when they change
+    int16_t last_font_index = -1;
+    int16_t last_txt_resolution = -1;
+
+    uint32_t last_full_redraw_ms;
+
     // MSP DisplayPort symbols
     static const uint8_t SYM_M = 0x0C;
     static const uint8_t SYM_KM = 0x7D;
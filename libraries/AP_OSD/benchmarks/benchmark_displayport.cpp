@@ -0,0 +1,132 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_OSD/AP_OSD_MSP_DisplayPort.h>
+#include <AP_MSP/msp.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+#if HAL_WITH_MSP_DISPLAYPORT
+
+// OSD frames are drawn at 10Hz
+#define FRAMES_PER_FULL_REDRAW (MSP_DISPLAYPORT_FULL_REDRAW_MS / 100)
+
+/*
+  a typical screen of OSD items, each changing at its own rate from
+  frame to frame
+ */
+static const struct {
+    uint8_t x;
+    uint8_t y;
+    const char *fmt;
+    float value;
+    float change_per_frame;
+} items[] = {
+    {  1,  1, "%4.1fV",     16.8,  -0.001 },
+    {  1,  2, "%5.1fA",     12.3,   0.37 },
+    {  1,  3, "%5.0fmAh",    0.0,   0.5 },
+    { 24,  1, "%3.0f%%",    99.0,   0.0 },
+    { 12,  7, "%5.1fm",     50.0,   0.05 },
+    { 12,  8, "%5.1fm/s",   12.0,   0.1 },
+    {  1, 13, "SATS %2.0f", 17.0,   0.0 },
+    {  1, 14, "HDOP %3.1f",  0.8,   0.0 },
+    { 20, 13, "%5.0fm",    120.0,   0.8 },
+    { 25, 14, "%3.0f",      90.0,   1.3 },
+    {  1,  6, "%6.1f",       2.5,  -0.3 },
+    {  1,  8, "%6.1f",      -1.2,   0.2 },
+};
+
+// bytes sent for a MSP v1 DisplayPort packet with a payload of len bytes
+static uint32_t msp_packet_bytes(uint8_t len)
+{
+    // $M> header, size, command, payload, checksum
+    return 3 + 1 + 1 + len + 1;
+}
+
+static void format_item(uint8_t i, uint32_t frame, char *text, uint8_t size)
+{
+    hal.util->snprintf(text, size, items[i].fmt, items[i].value + items[i].change_per_frame * frame);
+}
+
+static void set_bytes_per_frame_label(benchmark::State& state, uint64_t bytes, uint32_t frames)
+{
+    char label[32];
+    hal.util->snprintf(label, sizeof(label), "%.1f bytes/frame", frames ? double(bytes) / frames : 0.0);
+    state.SetLabel(label);
+}
+
+/*
+  what the DisplayPort backend sent before it tracked changes: the
+  options, a clear, every item and a draw on every frame
+ */
+static void BM_DisplayPortResendAll(benchmark::State& state)
+{
+    uint64_t bytes = 0;
+    uint32_t frames = 0;
+    while (state.KeepRunning()) {
+        // heartbeat, set_options and clear_screen
+        bytes += msp_packet_bytes(1) + msp_packet_bytes(3) + msp_packet_bytes(1);
+        for (uint8_t i=0; i<ARRAY_SIZE(items); i++) {
+            char text[OSD_MSP_DISPLAYPORT_MAX_STRING_LENGTH+1];
+            format_item(i, frames, text, sizeof(text));
+            bytes += msp_packet_bytes(4 + strnlen(text, OSD_MSP_DISPLAYPORT_MAX_STRING_LENGTH));
+        }
+        // draw_screen
+        bytes += msp_packet_bytes(1);
+        frames++;
+        gbenchmark_escape(&bytes);
+    }
+    set_bytes_per_frame_label(state, bytes, frames);
+}
+
+/*
+  the DisplayPort backend's frame transfer: only runs of changed
+  characters are sent, with a full redraw once a second
+ */
+static void BM_DisplayPortChanged(benchmark::State& state)
+{
+    AP_OSD_Backend::TextFrame *text_frame = new AP_OSD_Backend::TextFrame();
+    text_frame->set_size(16, 30);
+
+    uint64_t bytes = 0;
+    uint32_t frames = 0;
+    while (state.KeepRunning()) {
+        text_frame->clear();
+        for (uint8_t i=0; i<ARRAY_SIZE(items); i++) {
+            char text[OSD_MSP_DISPLAYPORT_MAX_STRING_LENGTH+1];
+            format_item(i, frames, text, sizeof(text));
+            text_frame->write(items[i].x, items[i].y, text);
+        }
+
+        // heartbeat
+        bytes += msp_packet_bytes(1);
+        const bool full_redraw = (frames % FRAMES_PER_FULL_REDRAW) == 0;
+        if (full_redraw) {
+            // set_options and clear_screen
+            bytes += msp_packet_bytes(3) + msp_packet_bytes(1);
+            text_frame->remote_cleared();
+        }
+        bool changed = full_redraw;
+        uint8_t x = 0, y = 0, len;
+        while (text_frame->next_changed_run(x, y, len, OSD_MSP_DISPLAYPORT_MAX_STRING_LENGTH, MSP_DISPLAYPORT_MAX_GAP)) {
+            bytes += msp_packet_bytes(4 + len);
+            changed = true;
+            x += len;
+        }
+        if (changed) {
+            // draw_screen
+            bytes += msp_packet_bytes(1);
+        }
+        frames++;
+        gbenchmark_escape(&bytes);
+    }
+    set_bytes_per_frame_label(state, bytes, frames);
+
+    delete text_frame;
+}
+
+BENCHMARK(BM_DisplayPortResendAll);
+BENCHMARK(BM_DisplayPortChanged);
+
+#endif  // HAL_WITH_MSP_DISPLAYPORT
+
+BENCHMARK_MAIN();
@@ -79,6 +79,22 @@ const AP_Param::GroupInfo AP_Proximity::var_info[] = {
     // @User: Advanced
     AP_GROUPINFO_FRAME("_ALT_MIN", 25, AP_Proximity, _alt_min, 1.0f, AP_PARAM_FRAME_COPTER | AP_PARAM_FRAME_HELI | AP_PARAM_FRAME_TRICOPTER),
 
+    // @Param: _SECTORS
+    // @DisplayName: Proximity boundary sectors
+    // @Description: Number of horizontal sectors the proximity boundary is divided into. More sectors let avoidance pass through narrower gaps but use more memory. Values are limited to the maximum supported by the board
+    // @Range: 8 72
+    // @RebootRequired: True
+    // @User: Advanced
+    AP_GROUPINFO("_SECTORS", 30, AP_Proximity, _boundary_sectors, PROXIMITY_DEFAULT_SECTORS),
+
+    // @Param: _LAYERS
+    // @DisplayName: Proximity boundary layers
+    // @Description: Number of vertical layers the proximity boundary is divided into, spread over 150 degrees of pitch. Even values are increased by one so that a layer is centred on the horizontal. Values are limited to the maximum supported by the board
+    // @Range: 1 9
+    // @RebootRequired: True
+    // @User: Advanced
+    AP_GROUPINFO("_LAYERS", 31, AP_Proximity, _boundary_layers, PROXIMITY_DEFAULT_LAYERS),
+
     // @Group: 1
     // @Path: AP_Proximity_Params.cpp
     AP_SUBGROUPINFO(params[0], "1", 21, AP_Proximity, AP_Proximity_Params),
@@ -142,6 +158,9 @@ void AP_Proximity::init()
         return;
     }
 
+    // allocate the boundary before the backends, which size their temporary boundaries to match
+    boundary.init(_boundary_sectors, _boundary_layers);
+
     // instantiate backends
     uint8_t serial_instance = 0;
     (void)serial_instance;  // in case no serial backends are compiled in
@@ -390,24 +409,24 @@ float AP_Proximity::distance_min() const
 bool AP_Proximity::get_horizontal_distances(Proximity_Distance_Array &prx_dist_array) const
 {
     Proximity_Distance_Array prx_filt_dist_array; // unused
-    return boundary.get_layer_distances(PROXIMITY_MIDDLE_LAYER, distance_max(), prx_dist_array, prx_filt_dist_array);
+    return boundary.get_layer_distances(boundary.get_middle_layer(), distance_max(), prx_dist_array, prx_filt_dist_array);
 }
 
 // get total number of obstacles, used in GPS based Simple Avoidance
-uint8_t AP_Proximity::get_obstacle_count() const
+uint16_t AP_Proximity::get_obstacle_count() const
 {
     return boundary.get_obstacle_count();
 }
 
 // get vector to obstacle based on obstacle_num passed, used in GPS based Simple Avoidance
-bool AP_Proximity::get_obstacle(uint8_t obstacle_num, Vector3f& vec_to_obstacle) const
+bool AP_Proximity::get_obstacle(uint16_t obstacle_num, Vector3f& vec_to_obstacle) const
 {
     return boundary.get_obstacle(obstacle_num, vec_to_obstacle);
 }
 
 // returns shortest distance to "obstacle_num" obstacle, from a line segment formed between "seg_start" and "seg_end"
 // returns FLT_MAX if it's an invalid instance.
-bool AP_Proximity::closest_point_from_segment_to_obstacle(uint8_t obstacle_num, const Vector3f& seg_start, const Vector3f& seg_end, Vector3f& closest_point) const
+bool AP_Proximity::closest_point_from_segment_to_obstacle(uint16_t obstacle_num, const Vector3f& seg_start, const Vector3f& seg_end, Vector3f& closest_point) const
 {
     return boundary.closest_point_from_segment_to_obstacle(obstacle_num , seg_start, seg_end, closest_point);
 }
@@ -432,7 +451,7 @@ bool AP_Proximity::get_object_angle_and_distance(uint8_t object_number, float& a
 }
 
 // get obstacle pitch and angle for a particular obstacle num
-bool AP_Proximity::get_obstacle_info(uint8_t obstacle_num, float &angle_deg, float &pitch, float &distance) const
+bool AP_Proximity::get_obstacle_info(uint16_t obstacle_num, float &angle_deg, float &pitch, float &distance) const
 {
     return boundary.get_obstacle_info(obstacle_num, angle_deg, pitch, distance);
 }
@@ -17,28 +17,94 @@
 
 #define PROXIMITY_BOUNDARY_3D_TIMEOUT_MS 750 // we should check the 3D boundary faces after this many ms
 
-/*
-  Constructor. 
-  This incorporates initialisation as well.
-*/
-AP_Proximity_Boundary_3D::AP_Proximity_Boundary_3D() 
+// resolution of the boundary, zero until storage is allocated
+uint8_t AP_Proximity_Boundary_3D::_num_sectors;
+uint8_t AP_Proximity_Boundary_3D::_num_layers;
+
+// allocate the boundary with the given number of sectors and layers.  The number of
+// layers is made odd so that the middle layer is horizontal.  If there is not enough
+// memory the default resolution is used instead.  Returns false if no boundary could be allocated
+bool AP_Proximity_Boundary_3D::init(uint8_t num_sectors, uint8_t num_layers)
 {
-    // initialise sector edge vector used for building the boundary fence
-    init();
+    static_assert(AP_PROXIMITY_BOUNDARY_MAX_LAYERS % 2 == 1, "AP_PROXIMITY_BOUNDARY_MAX_LAYERS must be odd");
+    static_assert(AP_PROXIMITY_BOUNDARY_MAX_SECTORS <= UINT8_MAX, "AP_PROXIMITY_BOUNDARY_MAX_SECTORS too large");
+
+    num_sectors = constrain_int16(num_sectors, PROXIMITY_DEFAULT_SECTORS, AP_PROXIMITY_BOUNDARY_MAX_SECTORS);
+    num_layers = constrain_int16(num_layers | 1, 1, AP_PROXIMITY_BOUNDARY_MAX_LAYERS);
+    if (!allocate(num_sectors, num_layers) &&
+        !allocate(PROXIMITY_DEFAULT_SECTORS, PROXIMITY_DEFAULT_LAYERS)) {
+        return false;
+    }
+
+    // yaw of the edge between each sector and the next sector CW
+    const float sector_width = get_sector_width_deg();
+    for (uint8_t sector=0; sector < _num_sectors; sector++) {
+        const ftype yaw_rad = radians(sector * sector_width + (sector_width * 0.5f));
+        _edge_cos_yaw[sector] = cosF(yaw_rad);
+        _edge_sin_yaw[sector] = sinF(yaw_rad);
+    }
+
+    // pitch of the middle of each layer
+    const float layer_width = get_layer_width_deg();
+    for (uint8_t layer=0; layer < _num_layers; layer++) {
+        const ftype pitch_rad = radians(layer_width * (layer + 0.5f) - (PROXIMITY_PITCH_RANGE_DEG * 0.5f));
+        _layer_cos_pitch[layer] = cosF(pitch_rad);
+        _layer_sin_pitch[layer] = sinF(pitch_rad);
+    }
+
+    // initialise the boundary used for object avoidance
+    for (uint8_t layer=0; layer < _num_layers; layer++) {
+        for (uint8_t sector=0; sector < _num_sectors; sector++) {
+            const uint16_t idx = face_index(layer, sector);
+            _boundary_points[idx] = get_sector_edge_vector(layer, sector) * PROXIMITY_BOUNDARY_DIST_DEFAULT;
+            _distance_valid[idx] = false;
+        }
+    }
+    return true;
 }
 
-// initialise the boundary and sector_edge_vector array used for object avoidance
-//   should be called if the sector_middle_deg or _sector_width_deg arrays are changed
-void AP_Proximity_Boundary_3D::init()
+// allocate storage for the given resolution, returns false on failure
+bool AP_Proximity_Boundary_3D::allocate(uint8_t num_sectors, uint8_t num_layers)
 {
-    for (uint8_t layer=0; layer < PROXIMITY_NUM_LAYERS; layer++) {
-        const float pitch = ((float)_pitch_middle_deg[layer]);
-        for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
-            const float angle_rad = ((float)_sector_middle_deg[sector]+(PROXIMITY_SECTOR_WIDTH_DEG/2.0f));
-            _sector_edge_vector[layer][sector].offset_bearing(angle_rad, pitch, 100.0f);
-            _boundary_points[layer][sector] = _sector_edge_vector[layer][sector] * PROXIMITY_BOUNDARY_DIST_DEFAULT;
-        }
+    const uint16_t num_faces = num_sectors * num_layers;
+    Vector3f *boundary_points = new Vector3f[num_faces];
+    bool *distance_valid = new bool[num_faces];
+    FaceState *faces = new FaceState[num_faces];
+    ftype *trig = new ftype[2 * (num_sectors + num_layers)];
+    if (boundary_points == nullptr || distance_valid == nullptr || faces == nullptr || trig == nullptr) {
+        delete[] boundary_points;
+        delete[] distance_valid;
+        delete[] faces;
+        delete[] trig;
+        return false;
     }
+
+    delete[] _boundary_points;
+    delete[] _distance_valid;
+    delete[] _faces;
+    delete[] _edge_cos_yaw;
+
+    _boundary_points = boundary_points;
+    _distance_valid = distance_valid;
+    _faces = faces;
+    _edge_cos_yaw = trig;
+    _edge_sin_yaw = &trig[num_sectors];
+    _layer_cos_pitch = &trig[2 * num_sectors];
+    _layer_sin_pitch = &trig[2 * num_sectors + num_layers];
+    _num_sectors = num_sectors;
+    _num_layers = num_layers;
+    return true;
+}
+
+// body frame vector (in cm) with a length of one meter along the edge between the sector and the next sector CW
+Vector3f AP_Proximity_Boundary_3D::get_sector_edge_vector(uint8_t layer, uint8_t sector) const
+{
+    // same arithmetic as Vector3f::offset_bearing() of 100cm. The tables
+    // hold ftype, so this is evaluated in double precision where ftype
+    // is double (e.g. SITL) and in single precision otherwise
+    return Vector3f{float(_layer_cos_pitch[layer] * _edge_cos_yaw[sector] * 100.0f),
+                    float(_layer_cos_pitch[layer] * _edge_sin_yaw[sector] * 100.0f),
+                    float(_layer_sin_pitch[layer] * 100.0f)};
 }
 
 // returns face corresponding to the provided yaw and (optionally) pitch
@@ -46,12 +112,34 @@ void AP_Proximity_Boundary_3D::init()
 // yaw is the horizontal body-frame angle (in degrees) to the obstacle (0=directly ahead of the vehicle, 90 is to the right of the vehicle)
 AP_Proximity_Boundary_3D::Face AP_Proximity_Boundary_3D::get_face(float pitch, float yaw) const
 {
-    const uint8_t sector = wrap_360(yaw + (PROXIMITY_SECTOR_WIDTH_DEG * 0.5f)) / 45.0f;
-    const float pitch_limited = constrain_float(pitch, -75.0f, 74.9f);
-    const uint8_t layer = (pitch_limited + 75.0f)/PROXIMITY_PITCH_WIDTH_DEG;
+    if (_num_sectors == 0) {
+        // boundary has not been allocated
+        return Face{};
+    }
+    const float sector_width = get_sector_width_deg();
+    uint8_t sector = wrap_360(yaw + (sector_width * 0.5f)) / sector_width;
+    if (sector >= _num_sectors) {
+        // yaw rounded up to 360 degrees
+        sector = 0;
+    }
+    const float pitch_max = PROXIMITY_PITCH_RANGE_DEG * 0.5f;
+    const float pitch_limited = constrain_float(pitch, -pitch_max, pitch_max - 0.1f);
+    const uint8_t layer = MIN(uint8_t((pitch_limited + pitch_max) / get_layer_width_deg()), _num_layers - 1);
     return Face{layer, sector};
 }
 
+// returns true if any part of the sector lies within a reading width_deg wide centred on yaw.
+// Readings wider than a sector should be applied to every sector they cover
+bool AP_Proximity_Boundary_3D::sector_in_reading(uint8_t sector, float yaw, float width_deg) const
+{
+    if (sector >= _num_sectors) {
+        return false;
+    }
+    // sectors that only touch the edge of the reading are not covered
+    const float sector_width = get_sector_width_deg();
+    return fabsf(wrap_180(get_sector_yaw_deg(sector) - yaw)) < (width_deg + sector_width) * 0.5f - 0.01f;
+}
+
 // Set the actual body-frame angle(yaw), pitch, and distance of the detected object.
 // This method will also mark the sector and layer to be "valid",
 // This distance can then be used for Obstacle Avoidance
@@ -63,20 +151,23 @@ void AP_Proximity_Boundary_3D::set_face_attributes(const Face &face, float pitch
         return;
     }
 
+    const uint16_t idx = face_index(face);
+    FaceState &f = _faces[idx];
+
     // ignore update if another instance has provided a shorter distance within the last 0.2 seconds
-    if ((prx_instance != _prx_instance[face.layer][face.sector]) && _distance_valid[face.layer][face.sector] && (_filtered_distance[face.layer][face.sector].get() < distance)) {
+    if ((prx_instance != f.prx_instance) && _distance_valid[idx] && (f.filtered_distance.get() < distance)) {
         // check if recent
         const uint32_t now_ms = AP_HAL::millis();
-        if (now_ms - _last_update_ms[face.layer][face.sector] < PROXIMITY_FACE_RESET_MS) {
+        if (now_ms - f.last_update_ms < PROXIMITY_FACE_RESET_MS) {
             return;
         }
     }
 
-    _angle[face.layer][face.sector] = angle;
-    _pitch[face.layer][face.sector] = pitch;
-    _distance[face.layer][face.sector] = distance;
-    _distance_valid[face.layer][face.sector] = true;
-    _prx_instance[face.layer][face.sector] = prx_instance;
+    f.angle = angle;
+    f.pitch = pitch;
+    f.distance = distance;
+    _distance_valid[idx] = true;
+    f.prx_instance = prx_instance;
 
     // apply filter
     set_filtered_distance(face, distance);
@@ -88,10 +179,9 @@ void AP_Proximity_Boundary_3D::set_face_attributes(const Face &face, float pitch
 // apply a new cutoff_freq to low-pass filter
 void AP_Proximity_Boundary_3D::apply_filter_freq(float cutoff_freq)
 {
-    for (uint8_t layer=0; layer < PROXIMITY_NUM_LAYERS; layer++) {
-        for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
-            _filtered_distance[layer][sector].set_cutoff_frequency(cutoff_freq);
-        }
+    const uint16_t num_faces = get_obstacle_count();
+    for (uint16_t i=0; i < num_faces; i++) {
+        _faces[i].filtered_distance.set_cutoff_frequency(cutoff_freq);
     }
 }
 
@@ -101,20 +191,21 @@ void AP_Proximity_Boundary_3D::set_filtered_distance(const Face &face, float dis
     if (!face.valid()) {
         return;
     }
-    if (!is_equal(_filtered_distance[face.layer][face.sector].get_cutoff_freq(), _filter_freq)) {
+    FaceState &f = _faces[face_index(face)];
+    if (!is_equal(f.filtered_distance.get_cutoff_freq(), _filter_freq)) {
         // cutoff freq has changed
         apply_filter_freq(_filter_freq);
     }
 
     const uint32_t now_ms = AP_HAL::millis();
-    const uint32_t dt = now_ms - _last_update_ms[face.layer][face.sector];
+    const uint32_t dt = now_ms - f.last_update_ms;
     if (dt < PROXIMITY_FILT_RESET_TIME) {
-        _filtered_distance[face.layer][face.sector].apply(distance, dt* 0.001f);
+        f.filtered_distance.apply(distance, dt* 0.001f);
     } else {
         // reset filter since last distance was passed a long time back
-        _filtered_distance[face.layer][face.sector].reset(distance);
+        f.filtered_distance.reset(distance);
     }
-    _last_update_ms[face.layer][face.sector] = now_ms;
+    f.last_update_ms = now_ms;
 }
 
 // update boundary points used for object avoidance based on a single sector and pitch distance changing
@@ -130,54 +221,58 @@ void AP_Proximity_Boundary_3D::update_boundary(const Face &face)
     const uint8_t layer = face.layer;
     const uint8_t sector = face.sector;
 
+    // only this layer is changed, so the faces needed are all in this block
+    const bool *valid = &_distance_valid[face_index(layer, 0)];
+    const FaceState *faces = &_faces[face_index(layer, 0)];
+    Vector3f *boundary_points = &_boundary_points[face_index(layer, 0)];
+
     // find adjacent sector (clockwise)
     const uint8_t next_sector = get_next_sector(sector);
 
     // boundary point lies on the line between the two sectors at the shorter distance found in the two sectors
     float shortest_distance = PROXIMITY_BOUNDARY_DIST_DEFAULT;
-    if (_distance_valid[layer][sector] && _distance_valid[layer][next_sector]) {
-        shortest_distance = MIN(_filtered_distance[layer][sector].get(), _filtered_distance[layer][next_sector].get());
-    } else if (_distance_valid[layer][sector]) {
-        shortest_distance = _filtered_distance[layer][sector].get();
-    } else if (_distance_valid[layer][next_sector]) {
-        shortest_distance = _filtered_distance[layer][next_sector].get();
+    if (valid[sector] && valid[next_sector]) {
+        shortest_distance = MIN(faces[sector].filtered_distance.get(), faces[next_sector].filtered_distance.get());
+    } else if (valid[sector]) {
+        shortest_distance = faces[sector].filtered_distance.get();
+    } else if (valid[next_sector]) {
+        shortest_distance = faces[next_sector].filtered_distance.get();
     }
     if (shortest_distance < PROXIMITY_BOUNDARY_DIST_MIN) {
         shortest_distance = PROXIMITY_BOUNDARY_DIST_MIN;
     }
-    _boundary_points[layer][sector] = _sector_edge_vector[layer][sector] * shortest_distance;
+    boundary_points[sector] = get_sector_edge_vector(layer, sector) * shortest_distance;
 
     // if the next sector (clockwise) has an invalid distance, set boundary to create a cup like boundary
-    if (!_distance_valid[layer][next_sector]) {
-        _boundary_points[layer][next_sector] = _sector_edge_vector[layer][next_sector] * shortest_distance;
+    if (!valid[next_sector]) {
+        boundary_points[next_sector] = get_sector_edge_vector(layer, next_sector) * shortest_distance;
     }
 
     // repeat for edge between sector and previous sector
     const uint8_t prev_sector = get_prev_sector(sector);
     shortest_distance = PROXIMITY_BOUNDARY_DIST_DEFAULT;
-    if (_distance_valid[layer][prev_sector] && _distance_valid[layer][sector]) {
-        shortest_distance = MIN(_filtered_distance[layer][prev_sector].get(), _filtered_distance[layer][sector].get());
-    } else if (_distance_valid[layer][prev_sector]) {
-        shortest_distance = _filtered_distance[layer][prev_sector].get();
-    } else if (_distance_valid[layer][sector]) {
-        shortest_distance = _filtered_distance[layer][sector].get();
+    if (valid[prev_sector] && valid[sector]) {
+        shortest_distance = MIN(faces[prev_sector].filtered_distance.get(), faces[sector].filtered_distance.get());
+    } else if (valid[prev_sector]) {
+        shortest_distance = faces[prev_sector].filtered_distance.get();
+    } else if (valid[sector]) {
+        shortest_distance = faces[sector].filtered_distance.get();
     }
-    _boundary_points[layer][prev_sector] = _sector_edge_vector[layer][prev_sector] * shortest_distance;
+    boundary_points[prev_sector] = get_sector_edge_vector(layer, prev_sector) * shortest_distance;
 
     // if the sector counter-clockwise from the previous sector has an invalid distance, set boundary to create a cup-like boundary
     const uint8_t prev_sector_ccw = get_prev_sector(prev_sector);
-    if (!_distance_valid[layer][prev_sector_ccw]) {
-        _boundary_points[layer][prev_sector_ccw] = _sector_edge_vector[layer][prev_sector_ccw] * shortest_distance;
+    if (!valid[prev_sector_ccw]) {
+        boundary_points[prev_sector_ccw] = get_sector_edge_vector(layer, prev_sector_ccw) * shortest_distance;
     }
 }
 
 // reset boundary.  marks all distances as invalid
 void AP_Proximity_Boundary_3D::reset()
 {
-    for (uint8_t layer=0; layer < PROXIMITY_NUM_LAYERS; layer++) {
-        for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
-            _distance_valid[layer][sector] = false;
-        }
+    const uint16_t num_faces = get_obstacle_count();
+    for (uint16_t i=0; i < num_faces; i++) {
+        _distance_valid[i] = false;
     }
 }
 
@@ -191,19 +286,20 @@ void AP_Proximity_Boundary_3D::reset_face(const Face &face, uint8_t prx_instance
     }
 
     // return immediately if face already has no valid distance
-    if (!_distance_valid[face.layer][face.sector]) {
+    const uint16_t idx = face_index(face);
+    if (!_distance_valid[idx]) {
         return;
     }
 
     // ignore reset if another instance provided this face's distance within the last 0.2 seconds
-    if (prx_instance != _prx_instance[face.layer][face.sector]) {
+    if (prx_instance != _faces[idx].prx_instance) {
         const uint32_t now_ms = AP_HAL::millis();
-        if (now_ms - _last_update_ms[face.layer][face.sector] < 200) {
+        if (now_ms - _faces[idx].last_update_ms < 200) {
             return;
         }
     }
 
-    _distance_valid[face.layer][face.sector] = false;
+    _distance_valid[idx] = false;
 
     // update simple avoidance boundary
     update_boundary(face);
@@ -219,12 +315,13 @@ void AP_Proximity_Boundary_3D::check_face_timeout()
     }
     _last_check_face_timeout_ms = now_ms;
 
-    for (uint8_t layer=0; layer < PROXIMITY_NUM_LAYERS; layer++) {
-        for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
-            if (_distance_valid[layer][sector]) {
-                if ((now_ms - _last_update_ms[layer][sector]) > PROXIMITY_FACE_RESET_MS) {
+    for (uint8_t layer=0; layer < _num_layers; layer++) {
+        for (uint8_t sector=0; sector < _num_sectors; sector++) {
+            const uint16_t idx = face_index(layer, sector);
+            if (_distance_valid[idx]) {
+                if ((now_ms - _faces[idx].last_update_ms) > PROXIMITY_FACE_RESET_MS) {
                     // this face has a valid distance but wasn't updated for a long time, reset it
-                    _distance_valid[layer][sector] = false;
+                    _distance_valid[idx] = false;
                     update_boundary(AP_Proximity_Boundary_3D::Face{layer, sector});
                 }
             }
@@ -238,8 +335,9 @@ bool AP_Proximity_Boundary_3D::get_distance(const Face &face, float &distance) c
     if (!face.valid()) {
         return false;
     }
-    if (_distance_valid[face.layer][face.sector]) {
-        distance = _distance[face.layer][face.sector];
+    const uint16_t idx = face_index(face);
+    if (_distance_valid[idx]) {
+        distance = _faces[idx].distance;
         return true;
     }
 
@@ -247,9 +345,9 @@ bool AP_Proximity_Boundary_3D::get_distance(const Face &face, float &distance) c
 }
 
 // get the total number of obstacles 
-uint8_t AP_Proximity_Boundary_3D::get_obstacle_count() const
+uint16_t AP_Proximity_Boundary_3D::get_obstacle_count() const
 {
-    return PROXIMITY_NUM_LAYERS * PROXIMITY_NUM_SECTORS;
+    return _num_layers * _num_sectors;
 }
 
 // Converts obstacle_num passed from avoidance library into appropriate face of the boundary
@@ -257,18 +355,23 @@ uint8_t AP_Proximity_Boundary_3D::get_obstacle_count() const
 // "update_boundary" method manipulates two sectors ccw and one sector cw from any valid face.
 // Any boundary that does not fall into these manipulated faces are useless, and will be marked as false
 // The resultant is packed into a Boundary Location object and returned by reference as "face"
-bool AP_Proximity_Boundary_3D::convert_obstacle_num_to_face(uint8_t obstacle_num, Face& face) const
+bool AP_Proximity_Boundary_3D::convert_obstacle_num_to_face(uint16_t obstacle_num, Face& face) const
 {
+    if (obstacle_num >= get_obstacle_count()) {
+        return false;
+    }
+
     // obstacle num is just "flattened layers, and sectors"
-    const uint8_t layer = obstacle_num / PROXIMITY_NUM_SECTORS;
-    const uint8_t sector = obstacle_num % PROXIMITY_NUM_SECTORS;
+    const uint8_t layer = obstacle_num / _num_sectors;
+    const uint8_t sector = obstacle_num % _num_sectors;
     face.sector = sector;
     face.layer = layer;
 
+    const bool *valid = &_distance_valid[face_index(layer, 0)];
     uint8_t valid_sector = sector;
     // check for 3 adjacent sectors
     for (uint8_t i=0; i < 3; i++) {
-        if (_distance_valid[layer][valid_sector]) {
+        if (valid[valid_sector]) {
             // update boundary has manipulated this face
             return true;
         }
@@ -284,7 +387,7 @@ bool AP_Proximity_Boundary_3D::convert_obstacle_num_to_face(uint8_t obstacle_num
 // Then returns the closest point on this line from vehicle, in body-frame. 
 // Used by GPS based Simple Avoidance  
 // False is returned if the obstacle_num provided does not produce a valid obstacle 
-bool AP_Proximity_Boundary_3D::get_obstacle(uint8_t obstacle_num, Vector3f& vec_to_obstacle) const
+bool AP_Proximity_Boundary_3D::get_obstacle(uint16_t obstacle_num, Vector3f& vec_to_obstacle) const
 {
     Face face;
     if (!convert_obstacle_num_to_face(obstacle_num, face)) {
@@ -294,8 +397,8 @@ bool AP_Proximity_Boundary_3D::get_obstacle(uint8_t obstacle_num, Vector3f& vec_
     const uint8_t sector_end = face.sector;
     const uint8_t sector_start = get_next_sector(face.sector);
     
-    const Vector3f start = _boundary_points[face.layer][sector_start];
-    const Vector3f end = _boundary_points[face.layer][sector_end];
+    const Vector3f start = _boundary_points[face_index(face.layer, sector_start)];
+    const Vector3f end = _boundary_points[face_index(face.layer, sector_end)];
     vec_to_obstacle = Vector3f::point_on_line_closest_to_other_point(start, end, Vector3f{});
     return true;
 }
@@ -308,7 +411,7 @@ bool AP_Proximity_Boundary_3D::get_obstacle(uint8_t obstacle_num, Vector3f& vec_
 // This helps us know if the passed line segment was in the direction of the boundary, or going in a different direction.
 // Used by GPS based Simple Avoidance  - for "brake mode"
 // False is returned if the obstacle_num provided does not produce a valid obstacle
-bool AP_Proximity_Boundary_3D::closest_point_from_segment_to_obstacle(uint8_t obstacle_num, const Vector3f& seg_start, const Vector3f& seg_end, Vector3f& closest_point) const
+bool AP_Proximity_Boundary_3D::closest_point_from_segment_to_obstacle(uint16_t obstacle_num, const Vector3f& seg_start, const Vector3f& seg_end, Vector3f& closest_point) const
 {
     Face face;
     if (!convert_obstacle_num_to_face(obstacle_num, face)) {
@@ -318,8 +421,8 @@ bool AP_Proximity_Boundary_3D::closest_point_from_segment_to_obstacle(uint8_t ob
 
     const uint8_t sector_end = face.sector;
     const uint8_t sector_start = get_next_sector(face.sector);
-    const Vector3f start = _boundary_points[face.layer][sector_start];
-    const Vector3f end = _boundary_points[face.layer][sector_end];
+    const Vector3f start = _boundary_points[face_index(face.layer, sector_start)];
+    const Vector3f end = _boundary_points[face_index(face.layer, sector_end)];
 
     // closest point between passed line segment and boundary
     Vector3f::segment_to_segment_closest_point(seg_start, seg_end, start, end, closest_point);
@@ -336,27 +439,23 @@ bool AP_Proximity_Boundary_3D::closest_point_from_segment_to_obstacle(uint8_t ob
 bool AP_Proximity_Boundary_3D::get_closest_object(float& angle_deg, float &distance) const
 {
     bool closest_found = false;
-    uint8_t closest_sector = 0;
-    uint8_t closest_layer = 0;
+    uint16_t closest_idx = 0;
 
     // check boundary for shortest distance
     // only check for middle layers and higher
     // lower layers might contain ground, which will give false pre-arm failure
-    for (uint8_t layer=PROXIMITY_MIDDLE_LAYER; layer<PROXIMITY_NUM_LAYERS; layer++) {
-        for (uint8_t sector=0; sector<PROXIMITY_NUM_SECTORS; sector++) {
-            if (_distance_valid[layer][sector]) {
-                if (!closest_found || (_distance[layer][sector] < _distance[closest_layer][closest_sector])) {
-                    closest_layer = layer;
-                    closest_sector = sector;
-                    closest_found = true;
-                }
+    for (uint16_t idx=face_index(get_middle_layer(), 0); idx<get_obstacle_count(); idx++) {
+        if (_distance_valid[idx]) {
+            if (!closest_found || (_faces[idx].distance < _faces[closest_idx].distance)) {
+                closest_idx = idx;
+                closest_found = true;
             }
         }
     }
 
     if (closest_found) {
-        angle_deg = _angle[closest_layer][closest_sector];
-        distance = _distance[closest_layer][closest_sector];
+        angle_deg = _faces[closest_idx].angle;
+        distance = _faces[closest_idx].distance;
     }
     return closest_found;
 }
@@ -364,16 +463,20 @@ bool AP_Proximity_Boundary_3D::get_closest_object(float& angle_deg, float &dista
 // get number of objects, used for non-GPS avoidance
 uint8_t AP_Proximity_Boundary_3D::get_horizontal_object_count() const
 {
-    return PROXIMITY_NUM_SECTORS;
+    return _num_sectors;
 }
 
 // get an object's angle and distance, used for non-GPS avoidance
 // returns false if no angle or distance could be returned for some reason
 bool AP_Proximity_Boundary_3D::get_horizontal_object_angle_and_distance(uint8_t object_number, float &angle_deg, float &distance) const
 {
-    if ((object_number < PROXIMITY_NUM_SECTORS) && _distance_valid[PROXIMITY_MIDDLE_LAYER][object_number]) {
-        angle_deg = _angle[PROXIMITY_MIDDLE_LAYER][object_number];
-        distance = _filtered_distance[PROXIMITY_MIDDLE_LAYER][object_number].get();
+    if (object_number >= _num_sectors) {
+        return false;
+    }
+    const uint16_t idx = face_index(get_middle_layer(), object_number);
+    if (_distance_valid[idx]) {
+        angle_deg = _faces[idx].angle;
+        distance = _faces[idx].filtered_distance.get();
         return true;
     }
     return false;
@@ -381,15 +484,13 @@ bool AP_Proximity_Boundary_3D::get_horizontal_object_angle_and_distance(uint8_t
 
 // get an obstacle info for AP_Periph
 // returns false if no angle or distance could be returned for some reason
-bool AP_Proximity_Boundary_3D::get_obstacle_info(uint8_t obstacle_num, float &angle_deg, float &pitch_deg, float &distance) const
+bool AP_Proximity_Boundary_3D::get_obstacle_info(uint16_t obstacle_num, float &angle_deg, float &pitch_deg, float &distance) const
 {
     // obstacle num is just "flattened layers, and sectors"
-    const uint8_t layer = obstacle_num / PROXIMITY_NUM_SECTORS;
-    const uint8_t sector = obstacle_num % PROXIMITY_NUM_SECTORS;
-    if (_distance_valid[layer][sector]) {
-        angle_deg = _angle[layer][sector];
-        pitch_deg = _pitch[layer][sector];
-        distance = _filtered_distance[layer][sector].get();
+    if ((obstacle_num < get_obstacle_count()) && _distance_valid[obstacle_num]) {
+        angle_deg = _faces[obstacle_num].angle;
+        pitch_deg = _faces[obstacle_num].pitch;
+        distance = _faces[obstacle_num].filtered_distance.get();
         return true;
     }
 
@@ -403,16 +504,18 @@ bool AP_Proximity_Boundary_3D::get_filtered_distance(const Face &face, float &di
         return false;
     }
 
-    if (!_distance_valid[face.layer][face.sector]) {
+    const uint16_t idx = face_index(face);
+    if (!_distance_valid[idx]) {
         // invalid distace
         return false;
     }
 
-    distance = _filtered_distance[face.layer][face.sector].get();
+    distance = _faces[idx].filtered_distance.get();
     return true;
 }
 
 // Get raw and filtered distances in 8 directions per layer
+// if there are more than 8 sectors the shortest distance of the sectors in each direction is used
 bool AP_Proximity_Boundary_3D::get_layer_distances(uint8_t layer_number, float dist_max, Proximity_Distance_Array &prx_dist_array, Proximity_Distance_Array &prx_filt_dist_array) const
 {
     // cycle through all sectors filling in distances and orientations
@@ -422,18 +525,35 @@ bool AP_Proximity_Boundary_3D::get_layer_distances(uint8_t layer_number, float d
     prx_filt_dist_array.offset_valid = 0;
     for (uint8_t i=0; i<PROXIMITY_MAX_DIRECTION; i++) {
         prx_dist_array.orientation[i] = i;
-        const AP_Proximity_Boundary_3D::Face face(layer_number, i);
-        if (!face.valid()) {
-            return false;
+        prx_dist_array.distance[i] = dist_max;
+        prx_filt_dist_array.distance[i] = dist_max;
+    }
+    if (layer_number >= _num_layers) {
+        return false;
+    }
+
+    const float sector_width = get_sector_width_deg();
+    const float direction_width = 360.0f / PROXIMITY_MAX_DIRECTION;
+    for (uint8_t sector=0; sector<_num_sectors; sector++) {
+        const AP_Proximity_Boundary_3D::Face face(layer_number, sector);
+        float distance, filt_distance;
+        if (!get_distance(face, distance) || !get_filtered_distance(face, filt_distance)) {
+            continue;
+        }
+        // direction containing the middle of this sector
+        uint8_t i = wrap_360(sector * sector_width + (direction_width * 0.5f)) / direction_width;
+        if (i >= PROXIMITY_MAX_DIRECTION) {
+            i = 0;
         }
-        if (get_distance(face, prx_dist_array.distance[i]) && get_filtered_distance(face, prx_filt_dist_array.distance[i])) {
-            valid_distances = true;
-            prx_dist_array.offset_valid |= (1U << i);
-            prx_filt_dist_array.offset_valid |= (1U << i);
-        } else {
-            prx_dist_array.distance[i] = dist_max;
-            prx_filt_dist_array.distance[i] = dist_max;
+        if (!prx_dist_array.valid(i) || (distance < prx_dist_array.distance[i])) {
+            prx_dist_array.distance[i] = distance;
         }
+        if (!prx_filt_dist_array.valid(i) || (filt_distance < prx_filt_dist_array.distance[i])) {
+            prx_filt_dist_array.distance[i] = filt_distance;
+        }
+        valid_distances = true;
+        prx_dist_array.offset_valid |= (1U << i);
+        prx_filt_dist_array.offset_valid |= (1U << i);
     }
 
     return valid_distances;
@@ -442,10 +562,20 @@ bool AP_Proximity_Boundary_3D::get_layer_distances(uint8_t layer_number, float d
 // reset the temporary boundary. This fills in distances with FLT_MAX
 void AP_Proximity_Temp_Boundary::reset()
 {
-    for (uint8_t layer=0; layer < PROXIMITY_NUM_LAYERS; layer++) {
-        for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
-            _distances[layer][sector] = FLT_MAX;
+    if (_faces == nullptr) {
+        // allocate to match the resolution of the boundary
+        const uint16_t num_faces = AP_Proximity_Boundary_3D::get_num_sectors() * AP_Proximity_Boundary_3D::get_num_layers();
+        if (num_faces == 0) {
+            return;
+        }
+        _faces = new TempFace[num_faces];
+        if (_faces == nullptr) {
+            return;
         }
+        _num_faces = num_faces;
+    }
+    for (uint16_t i=0; i < _num_faces; i++) {
+        _faces[i].distance = FLT_MAX;
     }
 }
 
@@ -453,10 +583,14 @@ void AP_Proximity_Temp_Boundary::reset()
 // pitch and yaw are in degrees, distance is in meters
 void AP_Proximity_Temp_Boundary::add_distance(const AP_Proximity_Boundary_3D::Face &face, float pitch, float yaw, float distance)
 {
-    if (face.valid() && distance < _distances[face.layer][face.sector]) {
-        _distances[face.layer][face.sector] = distance;
-        _angle[face.layer][face.sector] = yaw;
-        _pitch[face.layer][face.sector] = pitch;
+    if (!face.valid()) {
+        return;
+    }
+    const uint16_t idx = face.layer * AP_Proximity_Boundary_3D::get_num_sectors() + face.sector;
+    if (idx < _num_faces && distance < _faces[idx].distance) {
+        _faces[idx].distance = distance;
+        _faces[idx].angle = yaw;
+        _faces[idx].pitch = pitch;
     }
 }
 
@@ -464,13 +598,13 @@ void AP_Proximity_Temp_Boundary::add_distance(const AP_Proximity_Boundary_3D::Fa
 // prx_instance should be set to the proximity sensor's backend instance number
 void AP_Proximity_Temp_Boundary::update_3D_boundary(uint8_t prx_instance, AP_Proximity_Boundary_3D &boundary)
 {
-    for (uint8_t layer=0; layer < PROXIMITY_NUM_LAYERS; layer++) {
-        for (uint8_t sector=0; sector < PROXIMITY_NUM_SECTORS; sector++) {
-            if (_distances[layer][sector] < FLT_MAX) {
+    uint16_t idx = 0;
+    for (uint8_t layer=0; layer < boundary.get_num_layers(); layer++) {
+        for (uint8_t sector=0; sector < boundary.get_num_sectors() && idx < _num_faces; sector++, idx++) {
+            if (_faces[idx].distance < FLT_MAX) {
                 AP_Proximity_Boundary_3D::Face face{layer, sector};
-                boundary.set_face_attributes(face, _pitch[layer][sector], _angle[layer][sector], _distances[layer][sector], prx_instance);
+                boundary.set_face_attributes(face, _faces[idx].pitch, _faces[idx].angle, _faces[idx].distance, prx_instance);
             }
         }
     }
 }
-
@@ -18,16 +18,16 @@
 #include <AP_Common/AP_Common.h>
 #include <AP_Math/AP_Math.h>
 #include <Filter/LowPassFilter.h>
+#include "AP_Proximity_config.h"
 
-#define PROXIMITY_NUM_SECTORS         8       // number of sectors
-#define PROXIMITY_NUM_LAYERS          5       // num of layers in a sector
-#define PROXIMITY_MIDDLE_LAYER        2       // middle layer
-#define PROXIMITY_PITCH_WIDTH_DEG     30      // width between each layer in degrees
-#define PROXIMITY_SECTOR_WIDTH_DEG    (360.0f/PROXIMITY_NUM_SECTORS)   // width of sectors in degrees
+#define PROXIMITY_DEFAULT_SECTORS     8       // default number of sectors
+#define PROXIMITY_DEFAULT_LAYERS      5       // default number of layers in a sector
+#define PROXIMITY_PITCH_RANGE_DEG     150     // layers are spread evenly over this range of pitch, centred on the horizontal
 #define PROXIMITY_BOUNDARY_DIST_MIN   0.6f    // minimum distance for a boundary point.  This ensures the object avoidance code doesn't think we are outside the boundary.
 #define PROXIMITY_BOUNDARY_DIST_DEFAULT 100   // if we have no data for a sector, boundary is placed 100m out
 #define PROXIMITY_FILT_RESET_TIME     1000    // reset filter if last distance was pushed more than this many ms away
 #define PROXIMITY_FACE_RESET_MS       1000    // face will be reset if not updated within this many ms
+#define PROXIMITY_ORIENTATION_WIDTH_DEG 45    // width of a reading from a sensor with one of the 8 horizontal orientations
 
 // structure holding distances in PROXIMITY_MAX_DIRECTION directions. used for sending distances to ground station
 #define PROXIMITY_MAX_DIRECTION 8
@@ -45,8 +45,15 @@ struct Proximity_Distance_Array {
 class AP_Proximity_Boundary_3D
 {
 public:
-    // constructor. This incorporates initialisation as well.
-	AP_Proximity_Boundary_3D();
+    // constructor. The boundary has no storage until init() is called
+	AP_Proximity_Boundary_3D() {}
+
+    CLASS_NO_COPY(AP_Proximity_Boundary_3D);
+
+    // allocate the boundary with the given number of sectors and layers.  The number of
+    // layers is made odd so that the middle layer is horizontal.  If there is not enough
+    // memory the default resolution is used instead.  Returns false if no boundary could be allocated
+    bool init(uint8_t num_sectors, uint8_t num_layers);
 
     // stores the layer and sector as a single object to access and modify the 3-D boundary
     // Objects of this class are used temporarily to modify the boundary, i,e they are not persistant or stored anywhere
@@ -59,14 +66,14 @@ public:
 	    Face(uint8_t _layer, uint8_t _sector) { layer = _layer; sector = _sector; }
 
 	    // return true if face has valid layer and sector values
-	    bool valid() const { return ((layer < PROXIMITY_NUM_LAYERS) && (sector < PROXIMITY_NUM_SECTORS)); }
+	    bool valid() const { return ((layer < _num_layers) && (sector < _num_sectors)); }
 
 	    // comparison operator
 	    bool operator ==(const Face &other) const { return ((layer == other.layer) && (sector == other.sector)); }
 	    bool operator !=(const Face &other) const { return ((layer != other.layer) || (sector != other.sector)); }
 
-        uint8_t layer;  // vertical "steps" on the 3D Boundary. 0th layer is the bottom most layer, 1st layer is 30 degrees above (in body frame) and so on
-        uint8_t sector; // horizontal "steps" on the 3D Boundary. 0th sector is directly in front of the vehicle. Each sector is 45 degrees wide.
+        uint8_t layer;  // vertical "steps" on the 3D Boundary. 0th layer is the bottom most layer, each layer above is get_layer_width_deg() higher (in body frame)
+        uint8_t sector; // horizontal "steps" on the 3D Boundary. 0th sector is directly in front of the vehicle. Each sector is get_sector_width_deg() wide.
     };
 
     // returns face corresponding to the provided yaw and (optionally) pitch
@@ -75,6 +82,13 @@ public:
     Face get_face(float pitch, float yaw) const;
     Face get_face(float yaw) const { return get_face(0, yaw); }
 
+    // returns true if any part of the sector lies within a reading width_deg wide centred on yaw.
+    // Readings wider than a sector should be applied to every sector they cover
+    bool sector_in_reading(uint8_t sector, float yaw, float width_deg) const;
+
+    // get the body-frame yaw (in degrees) of the middle of a sector
+    float get_sector_yaw_deg(uint8_t sector) const { return sector * get_sector_width_deg(); }
+
     // Set the actual body-frame angle(yaw), pitch, and distance of the detected object.
     // This method will also mark the sector and layer to be "valid",
     // This distance can then be used for Obstacle Avoidance
@@ -103,15 +117,15 @@ public:
     bool get_distance(const Face &face, float &distance) const;
 
     // Get the total number of obstacles
-    uint8_t get_obstacle_count() const;
+    uint16_t get_obstacle_count() const;
 
     // Returns a body frame vector (in cm) to an obstacle
     // False is returned if the obstacle_num provided does not produce a valid obstacle
-    bool get_obstacle(uint8_t obstacle_num, Vector3f& vec_to_boundary) const;
+    bool get_obstacle(uint16_t obstacle_num, Vector3f& vec_to_boundary) const;
 
     // Returns a body frame vector (in cm) nearest to obstacle, in betwen seg_start and seg_end
     // True is returned if the segment intersects a plane formed by considering the "closest point" as normal vector to the plane.
-    bool closest_point_from_segment_to_obstacle(uint8_t obstacle_num, const Vector3f& seg_start, const Vector3f& seg_end, Vector3f& closest_point) const;
+    bool closest_point_from_segment_to_obstacle(uint16_t obstacle_num, const Vector3f& seg_start, const Vector3f& seg_end, Vector3f& closest_point) const;
 
     // get distance and angle to closest object (used for pre-arm check)
     //   returns true on success, false if no valid readings
@@ -122,10 +136,16 @@ public:
     bool get_horizontal_object_angle_and_distance(uint8_t object_number, float& angle_deg, float &distance) const;
 
     // get obstacle info for AP_Periph
-    bool get_obstacle_info(uint8_t obstacle_num, float &angle_deg, float &pitch_deg, float &distance) const;
+    bool get_obstacle_info(uint16_t obstacle_num, float &angle_deg, float &pitch_deg, float &distance) const;
+
+    // get number of sectors and layers, and the width of each in degrees
+    static uint8_t get_num_sectors() { return _num_sectors; }
+    static uint8_t get_num_layers() { return _num_layers; }
+    float get_sector_width_deg() const { return 360.0f / _num_sectors; }
+    float get_layer_width_deg() const { return float(PROXIMITY_PITCH_RANGE_DEG) / _num_layers; }
 
-    // get number of layers
-    uint8_t get_num_layers() const { return PROXIMITY_NUM_LAYERS; }
+    // get the horizontal layer
+    uint8_t get_middle_layer() const { return _num_layers / 2; }
 
     // get raw and filtered distances in 8 directions per layer.
     bool get_layer_distances(uint8_t layer_number, float dist_max, Proximity_Distance_Array &prx_dist_array, Proximity_Distance_Array &prx_filt_dist_array) const;
@@ -133,30 +153,40 @@ public:
     // pass down filter cut-off freq from params
     void set_filter_freq(float filt_freq) { _filter_freq = filt_freq; }
 
-    // sectors
-    static_assert(PROXIMITY_NUM_SECTORS == 8, "PROXIMITY_NUM_SECTOR must be 8");
-    const uint16_t _sector_middle_deg[PROXIMITY_NUM_SECTORS] {0, 45, 90, 135, 180, 225, 270, 315};    // middle angle of each sector
-    // layers
-    static_assert(PROXIMITY_NUM_LAYERS == 5, "PROXIMITY_NUM_LAYERS must be 5");
-    const int16_t _pitch_middle_deg[PROXIMITY_NUM_LAYERS] {-60, -30, 0, 30, 60};
-
 private:
 
-    // initialise the boundary and sector_edge_vector array used for object avoidance
-    void init();
+    // state of a single face that is not needed by avoidance
+    struct FaceState {
+        LowPassFilterFloat filtered_distance;   // low pass filter
+        float angle;            // yaw angle in degrees to closest object within the face
+        float pitch;            // pitch angle in degrees to the closest object within the face
+        float distance;         // distance to closest object within the face
+        uint32_t last_update_ms;    // time when distance was last updated
+        uint8_t prx_instance;   // proximity sensor backend instance that provided the distance
+    };
+
+    // allocate storage for the given resolution, returns false on failure
+    bool allocate(uint8_t num_sectors, uint8_t num_layers);
+
+    // index of a face in the arrays below. Faces of a layer are held together
+    uint16_t face_index(uint8_t layer, uint8_t sector) const { return layer * _num_sectors + sector; }
+    uint16_t face_index(const Face &face) const { return face_index(face.layer, face.sector); }
 
     // get the next sector which is CW to the passed sector
-    uint8_t get_next_sector(uint8_t sector) const {return ((sector >= PROXIMITY_NUM_SECTORS-1) ? 0 : sector+1); }
+    uint8_t get_next_sector(uint8_t sector) const {return ((sector >= _num_sectors-1) ? 0 : sector+1); }
 
     // get the prev sector which is CCW to the passed sector
-    uint8_t get_prev_sector(uint8_t sector) const {return ((sector <= 0) ? PROXIMITY_NUM_SECTORS-1 : sector-1); }
+    uint8_t get_prev_sector(uint8_t sector) const {return ((sector <= 0) ? _num_sectors-1 : sector-1); }
+
+    // body frame vector (in cm) with a length of one meter along the edge between the sector and the next sector CW
+    Vector3f get_sector_edge_vector(uint8_t layer, uint8_t sector) const;
 
     // Converts obstacle_num passed from avoidance library into appropriate face of the boundary
     // Returns false if the face is invalid
     // "update_boundary" method manipulates two sectors ccw and one sector cw from any valid face.
     // Any boundary that does not fall into these manipulated faces are useless, and will be marked as false
     // The resultant is packed into a Boundary Location object and returned by reference as "face"
-    bool convert_obstacle_num_to_face(uint8_t obstacle_num, Face& face) const WARN_IF_UNUSED;
+    bool convert_obstacle_num_to_face(uint16_t obstacle_num, Face& face) const WARN_IF_UNUSED;
 
     // Apply a new cutoff_freq to low-pass filter
     void apply_filter_freq(float cutoff_freq);
@@ -167,16 +197,22 @@ private:
     // Return filtered distance for the passed in face
     bool get_filtered_distance(const Face &face, float &distance) const;
 
-    Vector3f _sector_edge_vector[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];
-    Vector3f _boundary_points[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];
+    // resolution of the boundary, shared with AP_Proximity_Temp_Boundary
+    static uint8_t _num_sectors;
+    static uint8_t _num_layers;
+
+    // the boundary points and valid flags are read for every face by avoidance each loop, so
+    // are held apart from the rest of the face state
+    Vector3f *_boundary_points = nullptr;           // boundary point on the edge between each sector and the next sector CW
+    bool *_distance_valid = nullptr;                // true if a valid distance received for each face
+    FaceState *_faces = nullptr;                    // remaining state of each face
+
+    // sector edge vectors are built from these, so they do not need to be stored for every face
+    ftype *_edge_cos_yaw = nullptr;                 // cosine and sine of the yaw of each sector's CW edge
+    ftype *_edge_sin_yaw = nullptr;
+    ftype *_layer_cos_pitch = nullptr;              // cosine and sine of the pitch of the middle of each layer
+    ftype *_layer_sin_pitch = nullptr;
 
-    float _angle[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];          // yaw angle in degrees to closest object within each sector and layer
-    float _pitch[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];          // pitch angle in degrees to the closest object within each sector and layer
-    float _distance[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];       // distance to closest object within each sector and layer
-    bool _distance_valid[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];  // true if a valid distance received for each sector and layer
-    uint32_t _last_update_ms[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS]; // time when distance was last updated
-    uint8_t _prx_instance[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS]; // proximity sensor backend instance that provided the distance
-    LowPassFilterFloat _filtered_distance[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS]; // low pass filter
     float _filter_freq;                                                 // cutoff freq of low pass filter
     uint32_t _last_check_face_timeout_ms;                               // system time to throttle check_face_timeout method
 };
@@ -184,11 +220,15 @@ private:
 // This class gives an easy way of making a temporary boundary, used for "sorting" distances.
 // When unknown number of distances at various orientations are sent we store the least distance in the temporary boundary.
 // After all the messages are received, we copy the contents of the temporary boundary and put it in the main 3-D boundary.
+// It must be created after AP_Proximity_Boundary_3D::init() so it has the same resolution
 class AP_Proximity_Temp_Boundary
 {
 public:
     // constructor. This incorporates initialisation as well.
 	AP_Proximity_Temp_Boundary() { reset(); }
+    ~AP_Proximity_Temp_Boundary() { delete[] _faces; }
+
+    CLASS_NO_COPY(AP_Proximity_Temp_Boundary);
 
     // reset the temporary boundary. This fills in distances with FLT_MAX
     void reset();
@@ -204,7 +244,12 @@ public:
 
 private:
 
-    float _distances[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];      // distance to closest object within each sector and layer. Will start with FLT_MAX, and then be changed to a valid distance if needed
-    float _angle[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];          // yaw angle in degrees to closest object within each sector and layer
-    float _pitch[PROXIMITY_NUM_LAYERS][PROXIMITY_NUM_SECTORS];          // pitch angle in degrees to the closest object within each sector and layer
+    struct TempFace {
+        float distance;     // distance to closest object within the face. Will start with FLT_MAX, and then be changed to a valid distance if needed
+        float angle;        // yaw angle in degrees to closest object within the face
+        float pitch;        // pitch angle in degrees to the closest object within the face
+    };
+
+    TempFace *_faces = nullptr; // one for each face of the boundary, indexed by layer then sector
+    uint16_t _num_faces = 0;    // number of faces allocated
 };
@@ -94,15 +94,19 @@ void AP_Proximity_MAV::handle_distance_sensor_msg(const mavlink_message_t &msg)
         }
         // store in meters
         const float distance = packet.current_distance * 0.01f;
-        const uint8_t sector = packet.orientation;
-        // get the face for this sector
-        const float yaw_angle_deg = sector * 45;
-        const AP_Proximity_Boundary_3D::Face face = frontend.boundary.get_face(yaw_angle_deg);
+        const float yaw_angle_deg = packet.orientation * PROXIMITY_ORIENTATION_WIDTH_DEG;
         _distance_min = packet.min_distance * 0.01f;
         _distance_max = packet.max_distance * 0.01f;
         const bool in_range = distance <= _distance_max && distance >= _distance_min;
         if (in_range && !ignore_reading(yaw_angle_deg, distance, false)) {
-            temp_boundary.add_distance(face, yaw_angle_deg, distance);
+            // the reading covers every face within its width, not just the face it points at
+            const AP_Proximity_Boundary_3D::Face face = frontend.boundary.get_face(yaw_angle_deg);
+            for (uint8_t sector=0; sector < frontend.boundary.get_num_sectors(); sector++) {
+                if (frontend.boundary.sector_in_reading(sector, yaw_angle_deg, PROXIMITY_ORIENTATION_WIDTH_DEG)) {
+                    const AP_Proximity_Boundary_3D::Face covered{face.layer, sector};
+                    temp_boundary.add_distance(covered, (covered == face) ? yaw_angle_deg : frontend.boundary.get_sector_yaw_deg(sector), distance);
+                }
+            }
             // update OA database
             database_push(yaw_angle_deg, distance);
         }
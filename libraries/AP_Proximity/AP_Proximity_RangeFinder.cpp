@@ -46,19 +46,28 @@ void AP_Proximity_RangeFinder::update(void)
         if (sensor->has_data()) {
             // check for horizontal range finders
             if (sensor->orientation() <= ROTATION_YAW_315) {
-                const uint8_t sector = (uint8_t)sensor->orientation();
-                const float angle = sector * 45;
+                const float angle = uint8_t(sensor->orientation()) * PROXIMITY_ORIENTATION_WIDTH_DEG;
                 const AP_Proximity_Boundary_3D::Face face = frontend.boundary.get_face(angle);
                 // distance in meters
                 const float distance = sensor->distance();
                 _distance_min = sensor->min_distance_cm() * 0.01f;
                 _distance_max = sensor->max_distance_cm() * 0.01f;
-                if ((distance <= _distance_max) && (distance >= _distance_min) && !ignore_reading(angle, distance, false)) {
-                    frontend.boundary.set_face_attributes(face, angle, distance, state.instance);
+                const bool valid = (distance <= _distance_max) && (distance >= _distance_min) && !ignore_reading(angle, distance, false);
+                // the reading covers every face within its width, not just the face it points at
+                for (uint8_t sector=0; sector < frontend.boundary.get_num_sectors(); sector++) {
+                    if (!frontend.boundary.sector_in_reading(sector, angle, PROXIMITY_ORIENTATION_WIDTH_DEG)) {
+                        continue;
+                    }
+                    const AP_Proximity_Boundary_3D::Face covered{face.layer, sector};
+                    if (valid) {
+                        frontend.boundary.set_face_attributes(covered, (covered == face) ? angle : frontend.boundary.get_sector_yaw_deg(sector), distance, state.instance);
+                    } else {
+                        frontend.boundary.reset_face(covered, state.instance);
+                    }
+                }
+                if (valid) {
                     // update OA database
                     database_push(angle, distance);
-                } else {
-                    frontend.boundary.reset_face(face, state.instance);
                 }
                 _last_update_ms = now;
             }
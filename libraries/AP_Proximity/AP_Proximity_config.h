@@ -73,3 +73,20 @@
 #ifndef AP_PROXIMITY_LD06_ENABLED
 #define AP_PROXIMITY_LD06_ENABLED AP_PROXIMITY_BACKEND_DEFAULT_ENABLED
 #endif
+
+// largest 3D boundary that can be selected with PRX_SECTORS and PRX_LAYERS
+#ifndef AP_PROXIMITY_BOUNDARY_MAX_SECTORS
+#if HAL_MEM_CLASS >= HAL_MEM_CLASS_500
+#define AP_PROXIMITY_BOUNDARY_MAX_SECTORS 72
+#else
+#define AP_PROXIMITY_BOUNDARY_MAX_SECTORS 8
+#endif
+#endif
+
+#ifndef AP_PROXIMITY_BOUNDARY_MAX_LAYERS
+#if HAL_MEM_CLASS >= HAL_MEM_CLASS_500
+#define AP_PROXIMITY_BOUNDARY_MAX_LAYERS 9
+#else
+#define AP_PROXIMITY_BOUNDARY_MAX_LAYERS 5
+#endif
+#endif
@@ -115,6 +115,7 @@ bool AP_Rally::set_rally_point_with_index(uint8_t i, const RallyLocation &rallyL
     _storage.write_block(i * sizeof(RallyLocation), &rallyLoc, sizeof(RallyLocation));
 
     _last_change_time_ms = AP_HAL::millis();
+    _index_valid = false;
 
 #if HAL_LOGGING_ENABLED
     AP::logger().Write_RallyPoint(_rally_point_total_count, i, rallyLoc);
@@ -137,22 +138,64 @@ Location AP_Rally::rally_location_to_location(const RallyLocation &rally_loc) co
     return ret;
 }
 
+// rebuild the spatial index if the rally points have changed
+bool AP_Rally::update_index() const
+{
+    const uint8_t total = get_rally_total();
+    if (_index_valid && _index_total == total) {
+        return true;
+    }
+    if (!_index.reset(total)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < total; i++) {
+        RallyLocation rally;
+        if (get_rally_point_with_index(i, rally)) {
+            _index.add(rally_location_to_location(rally), i);
+        }
+    }
+    _index.build();
+    _index_total = total;
+    _index_valid = true;
+    return true;
+}
+
 // returns true if a valid rally point is found, otherwise returns false to indicate home position should be used
 bool AP_Rally::find_nearest_rally_point(const Location &current_loc, RallyLocation &return_loc) const
 {
     float min_dis = -1;
 
-    for (uint8_t i = 0; i < (uint8_t) _rally_point_total_count; i++) {
-        RallyLocation next_rally;
-        if (!get_rally_point_with_index(i, next_rally)) {
-            continue;
-        }
-        Location rally_loc = rally_location_to_location(next_rally);
-        float dis = current_loc.get_distance(rally_loc);
-
-        if (is_valid(rally_loc) && (dis < min_dis || min_dis < 0)) {
+    if (update_index()) {
+        auto distance_fn = [&](uint16_t i) -> float {
+            RallyLocation next_rally;
+            if (!get_rally_point_with_index(i, next_rally)) {
+                return -1;
+            }
+            const Location rally_loc = rally_location_to_location(next_rally);
+            if (!is_valid(rally_loc)) {
+                return -1;
+            }
+            return current_loc.get_distance(rally_loc);
+        };
+        uint16_t index;
+        float dis;
+        if (_index.find_nearest(current_loc, distance_fn, index, dis) &&
+            get_rally_point_with_index(index, return_loc)) {
             min_dis = dis;
-            return_loc = next_rally;
+        }
+    } else {
+        for (uint8_t i = 0; i < (uint8_t) _rally_point_total_count; i++) {
+            RallyLocation next_rally;
+            if (!get_rally_point_with_index(i, next_rally)) {
+                continue;
+            }
+            Location rally_loc = rally_location_to_location(next_rally);
+            float dis = current_loc.get_distance(rally_loc);
+
+            if (is_valid(rally_loc) && (dis < min_dis || min_dis < 0)) {
+                min_dis = dis;
+                return_loc = next_rally;
+            }
         }
     }
 
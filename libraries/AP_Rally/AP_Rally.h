@@ -22,6 +22,7 @@
 
 #include <AP_Common/AP_Common.h>
 #include <AP_Common/Location.h>
+#include <AP_Common/LocationIndex.h>
 #include <AP_Param/AP_Param.h>
 
 struct PACKED RallyLocation {
@@ -100,6 +101,12 @@ private:
     AP_Int8  _rally_incl_home;
 
     uint32_t _last_change_time_ms = 0xFFFFFFFF;
+
+    // spatial index of the rally points, rebuilt when they change
+    mutable LocationIndex _index;
+    mutable uint8_t _index_total;
+    mutable bool _index_valid;
+    bool update_index() const;
 };
 
 namespace AP {
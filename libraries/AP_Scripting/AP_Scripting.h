@@ -39,6 +39,8 @@
 class SocketAPM;
 #endif
 
+class ExpandingString;
+
 class AP_Scripting
 {
 public:
@@ -75,6 +77,9 @@ public:
     
     void restart_all(void);
 
+    // fill in the per-script stats for @SYS/scripts.txt
+    void scripts_info(ExpandingString &str);
+
    // User parameters for inputs into scripts 
    AP_Float _user[6];
 
@@ -1,14 +1,20 @@
 #pragma once
 
 #include <AP_HAL/AP_HAL_Boards.h>
+#include <AP_Filesystem/AP_Filesystem_config.h>
 
 #ifndef AP_SCRIPTING_ENABLED
 #define AP_SCRIPTING_ENABLED (BOARD_FLASH_SIZE > 1024)
 #endif
 
 #if AP_SCRIPTING_ENABLED
-    #include <AP_Filesystem/AP_Filesystem_config.h>
     #if !AP_FILESYSTEM_FILE_READING_ENABLED
         #error "Scripting requires a filesystem"
     #endif
 #endif
+
+// cache compiled bytecode of loaded scripts on the filesystem so
+// they don't need to be parsed again on the next boot
+#ifndef AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+#define AP_SCRIPTING_BYTECODE_CACHE_ENABLED AP_FILESYSTEM_FILE_WRITING_ENABLED
+#endif
@@ -702,8 +702,9 @@ local Vector2f_ud = {}
 function Vector2f() end
 
 -- copy
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud
-function Vector2f_ud:copy() end
+function Vector2f_ud:copy(out) end
 
 -- get field
 ---@return number
@@ -756,8 +757,9 @@ local Vector3f_ud = {}
 function Vector3f() end
 
 -- copy
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function Vector3f_ud:copy() end
+function Vector3f_ud:copy(out) end
 
 -- get field
 ---@return number
@@ -785,13 +787,15 @@ function Vector3f_ud:x(value) end
 
 -- desc
 ---@param scale_factor number
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function Vector3f_ud:scale(scale_factor) end
+function Vector3f_ud:scale(scale_factor, out) end
 
 -- desc
 ---@param vector Vector3f_ud
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function Vector3f_ud:cross(vector) end
+function Vector3f_ud:cross(vector, out) end
 
 -- desc
 ---@param vector Vector3f_ud
@@ -827,8 +831,9 @@ function Vector3f_ud:angle(v2) end
 function Vector3f_ud:rotate_xy(param1) end
 
 -- desc
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud
-function Vector3f_ud:xy() end
+function Vector3f_ud:xy(out) end
 
 -- desc
 ---@class Quaternion_ud
@@ -874,8 +879,9 @@ function Quaternion_ud:q1(value) end
 function Quaternion_ud:earth_to_body(vec) end
 
 -- Returns inverse of quaternion
+---@param out? Quaternion_ud -- optional object to write the result into
 ---@return Quaternion_ud
-function Quaternion_ud:inverse() end
+function Quaternion_ud:inverse(out) end
 
 -- Integrates angular velocity over small time delta
 ---@param angular_velocity Vector3f_ud
@@ -924,8 +930,9 @@ local Location_ud = {}
 function Location() end
 
 -- copy
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud
-function Location_ud:copy() end
+function Location_ud:copy(out) end
 
 -- get field
 ---@return boolean
@@ -1002,13 +1009,15 @@ function Location_ud:change_alt_frame(desired_frame) end
 
 -- desc
 ---@param loc Location_ud
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud
-function Location_ud:get_distance_NE(loc) end
+function Location_ud:get_distance_NE(loc, out) end
 
 -- desc
 ---@param loc Location_ud
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function Location_ud:get_distance_NED(loc) end
+function Location_ud:get_distance_NED(loc, out) end
 
 -- desc
 ---@param loc Location_ud
@@ -1016,8 +1025,9 @@ function Location_ud:get_distance_NED(loc) end
 function Location_ud:get_bearing(loc) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud|nil
-function Location_ud:get_vector_from_origin_NEU() end
+function Location_ud:get_vector_from_origin_NEU(out) end
 
 -- desc
 ---@param bearing_deg number
@@ -1301,8 +1311,9 @@ function mount:set_attitude_euler(instance, roll_deg, pitch_deg, yaw_deg) end
 
 -- desc
 ---@param instance integer
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud|nil
-function mount:get_location_target(instance) end
+function mount:get_location_target(instance, out) end
 
 -- desc
 ---@param instance integer
@@ -1521,13 +1532,15 @@ function ins:calibrating() end
 
 -- Get the value of a specific gyroscope
 ---@param instance integer -- the 0-based index of the gyroscope instance to return.
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ins:get_gyro(instance) end
+function ins:get_gyro(instance, out) end
 
 -- Get the value of a specific accelerometer
 ---@param instance integer -- the 0-based index of the accelerometer instance to return.
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ins:get_accel(instance) end
+function ins:get_accel(instance, out) end
 
 -- desc
 ---@class Motors_dynamic
@@ -2287,8 +2300,9 @@ function vehicle:set_target_pos_NED(target_pos, use_yaw, yaw_deg, use_yaw_rate,
 function vehicle:update_target_location(current_target, new_target) end
 
 -- desc
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud|nil
-function vehicle:get_target_location() end
+function vehicle:get_target_location(out) end
 
 -- desc
 ---@param target_loc Location_ud
@@ -2390,12 +2404,14 @@ function vehicle:is_landing() end
 onvif = {}
 
 -- desc
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud
-function onvif:get_pan_tilt_limit_max() end
+function onvif:get_pan_tilt_limit_max(out) end
 
 -- desc
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud
-function onvif:get_pan_tilt_limit_min() end
+function onvif:get_pan_tilt_limit_min(out) end
 
 -- desc
 ---@param pan number
@@ -2667,8 +2683,9 @@ function rangefinder:get_backend(rangefinder_instance) end
 
 -- desc
 ---@param orientation integer
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function rangefinder:get_pos_offset_orient(orientation) end
+function rangefinder:get_pos_offset_orient(orientation, out) end
 
 -- desc
 ---@param orientation integer
@@ -2827,8 +2844,9 @@ function gps:first_unconfigured_gps() end
 
 -- desc
 ---@param instance integer
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function gps:get_antenna_offset(instance) end
+function gps:get_antenna_offset(instance, out) end
 
 -- desc
 ---@param instance integer
@@ -2882,8 +2900,9 @@ function gps:ground_speed(instance) end
 
 -- desc
 ---@param instance integer
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function gps:velocity(instance) end
+function gps:velocity(instance, out) end
 
 -- desc
 ---@param instance integer
@@ -2902,8 +2921,9 @@ function gps:speed_accuracy(instance) end
 
 -- desc
 ---@param instance integer
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud
-function gps:location(instance) end
+function gps:location(instance, out) end
 
 -- desc
 ---@param instance integer
@@ -3091,8 +3111,9 @@ function arming:disarm() end
 ahrs = {}
 
 -- desc
+---@param out? Quaternion_ud -- optional object to write the result into
 ---@return Quaternion_ud|nil
-function ahrs:get_quaternion() end
+function ahrs:get_quaternion(out) end
 
 -- desc
 ---@return integer
@@ -3108,8 +3129,9 @@ function ahrs:initialised() end
 function ahrs:set_origin(loc) end
 
 -- desc
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud|nil
-function ahrs:get_origin() end
+function ahrs:get_origin(out) end
 
 -- desc
 ---@param loc Location_ud
@@ -3118,21 +3140,24 @@ function ahrs:set_home(loc) end
 
 -- desc
 ---@param source integer
+---@param out1? Vector3f_ud -- optional object to write the result into
+---@param out2? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud|nil
 ---@return Vector3f_ud|nil
-function ahrs:get_vel_innovations_and_variances_for_source(source) end
+function ahrs:get_vel_innovations_and_variances_for_source(source, out1, out2) end
 
 -- desc
 ---@param source_set_idx integer
 function ahrs:set_posvelyaw_source_set(source_set_idx) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return number|nil
 ---@return number|nil
 ---@return number|nil
 ---@return Vector3f_ud|nil
 ---@return number|nil
-function ahrs:get_variances() end
+function ahrs:get_variances(out) end
 
 -- desc
 ---@return number
@@ -3140,17 +3165,20 @@ function ahrs:get_EAS2TAS() end
 
 -- desc
 ---@param vector Vector3f_ud
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ahrs:body_to_earth(vector) end
+function ahrs:body_to_earth(vector, out) end
 
 -- desc
 ---@param vector Vector3f_ud
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ahrs:earth_to_body(vector) end
+function ahrs:earth_to_body(vector, out) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ahrs:get_vibration() end
+function ahrs:get_vibration(out) end
 
 -- desc
 ---@return number|nil
@@ -3169,24 +3197,29 @@ function ahrs:home_is_set() end
 function ahrs:get_relative_position_D_home() end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud|nil
-function ahrs:get_relative_position_NED_origin() end
+function ahrs:get_relative_position_NED_origin(out) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud|nil
-function ahrs:get_relative_position_NED_home() end
+function ahrs:get_relative_position_NED_home(out) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud|nil
-function ahrs:get_velocity_NED() end
+function ahrs:get_velocity_NED(out) end
 
 -- desc
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud
-function ahrs:groundspeed_vector() end
+function ahrs:groundspeed_vector(out) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ahrs:wind_estimate() end
+function ahrs:wind_estimate(out) end
 
 -- Determine how aligned heading_deg is with the wind. Return result
 -- is 1.0 when perfectly aligned heading into wind, -1 when perfectly
@@ -3205,24 +3238,29 @@ function ahrs:head_wind() end
 function ahrs:get_hagl() end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ahrs:get_accel() end
+function ahrs:get_accel(out) end
 
 -- desc
+---@param out? Vector3f_ud -- optional object to write the result into
 ---@return Vector3f_ud
-function ahrs:get_gyro() end
+function ahrs:get_gyro(out) end
 
 -- desc
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud
-function ahrs:get_home() end
+function ahrs:get_home(out) end
 
 -- desc
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud|nil
-function ahrs:get_location() end
+function ahrs:get_location(out) end
 
 -- same as `get_location` will be removed
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud|nil
-function ahrs:get_position() end
+function ahrs:get_position(out) end
 
 -- desc
 ---@return number
@@ -3268,12 +3306,14 @@ function AR_PosControl:get_srate() end
 precland = {}
 
 -- get Location of target or nil if target not acquired
+---@param out? Location_ud -- optional object to write the result into
 ---@return Location_ud|nil
-function precland:get_target_location() end
+function precland:get_target_location(out) end
 
 -- get NE velocity of target or nil if not available
+---@param out? Vector2f_ud -- optional object to write the result into
 ---@return Vector2f_ud|nil
-function precland:get_target_velocity() end
+function precland:get_target_velocity(out) end
 
 -- get the time of the last valid target
 ---@return uint32_t_ud
@@ -3296,14 +3336,18 @@ follow = {}
 function follow:get_target_heading_deg() end
 
 -- desc
+---@param out1? Location_ud -- optional object to write the result into
+---@param out2? Vector3f_ud -- optional object to write the result into
 ---@return Location_ud|nil
 ---@return Vector3f_ud|nil
-function follow:get_target_location_and_velocity_ofs() end
+function follow:get_target_location_and_velocity_ofs(out1, out2) end
 
 -- desc
+---@param out1? Location_ud -- optional object to write the result into
+---@param out2? Vector3f_ud -- optional object to write the result into
 ---@return Location_ud|nil
 ---@return Vector3f_ud|nil
-function follow:get_target_location_and_velocity() end
+function follow:get_target_location_and_velocity(out1, out2) end
 
 -- desc
 ---@return uint32_t_ud
@@ -31,6 +31,7 @@ char keyword_manual[]              = "manual";
 char keyword_global[]              = "global";
 char keyword_creation[]            = "creation";
 char keyword_manual_operator[]     = "manual_operator";
+char keyword_reuse[]               = "reuse";
 
 // attributes (should include the leading ' )
 char keyword_attr_enum[]    = "'enum";
@@ -387,6 +388,7 @@ enum userdata_flags {
   UD_FLAG_LITERAL = (1U << 2),
   UD_FLAG_SEMAPHORE_POINTER = (1U << 3),
   UD_FLAG_REFERENCE = (1U << 4),
+  UD_FLAG_REUSE = (1U << 5), // results may be written into a userdata passed by the caller
 };
 
 struct userdata_enum {
@@ -1025,6 +1027,9 @@ void handle_userdata(void) {
     handle_manual(node, ALIAS_TYPE_MANUAL_OPERATOR);
     node->operations |= OP_MANUAL;
 
+  } else if (strcmp(type, keyword_reuse) == 0) {
+    node->flags |= UD_FLAG_REUSE;
+
   } else {
     error(ERROR_USERDATA, "Unknown or unsupported type for userdata: %s", type);
   }
@@ -1791,8 +1796,40 @@ void emit_singleton_fields() {
   }
 }
 
+// returns true if results of this userdata type can be written into a userdata passed by the caller
+int is_reusable_userdata(const struct type *t) {
+  if (t->type != TYPE_USERDATA) {
+    return FALSE;
+  }
+  const struct userdata *node = parsed_userdata;
+  while (node != NULL) {
+    if (strcmp(node->name, t->data.ud.name) == 0) {
+      return (node->flags & UD_FLAG_REUSE) != 0;
+    }
+    node = node->next;
+  }
+  return FALSE;
+}
+
+// emit pushing a userdata result, either into the caller supplied out argument or a new container
+void emit_userdata_result(const struct type *t, const char *value, int out_slot, const char *tab) {
+  if ((out_slot >= 0) && is_reusable_userdata(t)) {
+    fprintf(source, "%sif (out_%d != nullptr) {\n", tab, out_slot);
+    fprintf(source, "%s    *out_%d = %s;\n", tab, out_slot, value);
+    fprintf(source, "%s    lua_pushvalue(L, out_arg_%d);\n", tab, out_slot);
+    fprintf(source, "%s} else {\n", tab);
+    fprintf(source, "%s    new_%s(L);\n", tab, t->data.ud.sanatized_name);
+    fprintf(source, "%s    *check_%s(L, -1) = %s;\n", tab, t->data.ud.sanatized_name, value);
+    fprintf(source, "%s}\n", tab);
+  } else {
+    fprintf(source, "%snew_%s(L);\n", tab, t->data.ud.sanatized_name);
+    fprintf(source, "%s*check_%s(L, -1) = %s;\n", tab, t->data.ud.sanatized_name, value);
+  }
+}
+
 // emit refences functions for a call, return the number of arduments added
-int emit_references(const struct argument *arg, const char * tab) {
+// out_slot is the first out argument slot available to reusable userdata, or -1 if there are none
+int emit_references(const struct argument *arg, const char * tab, int out_slot) {
   int arg_index = NULLABLE_ARG_COUNT_BASE + 2;
   int return_count = 0;
   while (arg != NULL) {
@@ -1820,11 +1857,16 @@ int emit_references(const struct argument *arg, const char * tab) {
         case TYPE_STRING:
           fprintf(source, "%slua_pushstring(L, data_%d);\n", tab, arg_index);
           break;
-        case TYPE_USERDATA:
-          // userdatas must allocate a new container to return
-          fprintf(source, "%snew_%s(L);\n", tab, arg->type.data.ud.sanatized_name);
-          fprintf(source, "%s*check_%s(L, -1) = data_%d;\n", tab, arg->type.data.ud.sanatized_name, arg_index);
+        case TYPE_USERDATA: {
+          // userdatas must be written into the callers container or allocate a new one to return
+          char value[32];
+          snprintf(value, sizeof(value), "data_%d", arg_index);
+          emit_userdata_result(&arg->type, value, out_slot, tab);
+          if ((out_slot >= 0) && is_reusable_userdata(&arg->type)) {
+            out_slot++;
+          }
           break;
+        }
         case TYPE_NONE:
           error(ERROR_INTERNAL, "Attempted to emit a nullable or reference  argument of type none");
           break;
@@ -1870,13 +1912,23 @@ void emit_userdata_method(const struct userdata *data, const struct method *meth
 
   // sanity check number of args called with
   arg_count = 1;
+  int out_count = is_reusable_userdata(&method->return_type) ? 1 : 0;
   while (arg != NULL) {
     if (!(arg->type.flags & (TYPE_FLAGS_NULLABLE | TYPE_FLAGS_REFERNCE)) && !(arg->type.type == TYPE_LITERAL)) {
       arg_count++;
+    } else if ((arg->type.flags & (TYPE_FLAGS_NULLABLE | TYPE_FLAGS_REFERNCE)) && is_reusable_userdata(&arg->type)) {
+      out_count++;
     }
     arg = arg->next;
   }
-  fprintf(source, "    binding_argcheck(L, %d);\n", arg_count);
+  const int in_arg_count = arg_count;
+  if (out_count > 0) {
+    // reusable userdata results may optionally be passed in after the normal arguments
+    fprintf(source, "    const int out_args = MIN(MAX(lua_gettop(L) - %d, 0), %d);\n", arg_count, out_count);
+    fprintf(source, "    binding_argcheck(L, %d + out_args);\n", arg_count);
+  } else {
+    fprintf(source, "    binding_argcheck(L, %d);\n", arg_count);
+  }
 
   switch (data->ud_type) {
     case UD_USERDATA:
@@ -1910,6 +1962,25 @@ void emit_userdata_method(const struct userdata *data, const struct method *meth
     arg = arg->next;
   }
 
+  // check the out arguments before making the call
+  if (out_count > 0) {
+    int out_slot = 0;
+    if (is_reusable_userdata(&method->return_type)) {
+      fprintf(source, "    const int out_arg_%d = %d;\n", out_slot, in_arg_count + out_slot + 1);
+      fprintf(source, "    %s *out_%d = (out_args > %d) ? check_%s(L, out_arg_%d) : nullptr;\n", method->return_type.data.ud.name, out_slot, out_slot, method->return_type.data.ud.sanatized_name, out_slot);
+      out_slot++;
+    }
+    arg = method->arguments;
+    while (arg != NULL) {
+      if ((arg->type.flags & (TYPE_FLAGS_NULLABLE | TYPE_FLAGS_REFERNCE)) && is_reusable_userdata(&arg->type)) {
+        fprintf(source, "    const int out_arg_%d = %d;\n", out_slot, in_arg_count + out_slot + 1);
+        fprintf(source, "    %s *out_%d = (out_args > %d) ? check_%s(L, out_arg_%d) : nullptr;\n", arg->type.data.ud.name, out_slot, out_slot, arg->type.data.ud.sanatized_name, out_slot);
+        out_slot++;
+      }
+      arg = arg->next;
+    }
+  }
+
   const char *ud_name = (data->flags & UD_FLAG_LITERAL)?data->name:"ud";
   const char *ud_access = (data->flags & UD_FLAG_REFERENCE)?".":"->";
 
@@ -2062,7 +2133,7 @@ void emit_userdata_method(const struct userdata *data, const struct method *meth
   if (method->flags & TYPE_FLAGS_REFERNCE) {
     arg = method->arguments;
     // number of arguments to return
-    return_count += emit_references(arg,"    ");
+    return_count += emit_references(arg, "    ", (out_count > 0) ? (is_reusable_userdata(&method->return_type) ? 1 : 0) : -1);
   }
 
   switch (method->return_type.type) {
@@ -2071,7 +2142,7 @@ void emit_userdata_method(const struct userdata *data, const struct method *meth
         fprintf(source, "    if (data) {\n");
         // we need to emit out nullable arguments, iterate the args again, creating and copying objects, while keeping a new count
         arg = method->arguments;
-        return_count = emit_references(arg,"        ");
+        return_count = emit_references(arg, "        ", (out_count > 0) ? 0 : -1);
         fprintf(source, "        return %d;\n", return_count);
         fprintf(source, "    }\n");
         fprintf(source, "    return 0;\n");
@@ -2098,9 +2169,8 @@ void emit_userdata_method(const struct userdata *data, const struct method *meth
       fprintf(source, "    lua_pushstring(L, data);\n");
       break;
     case TYPE_USERDATA:
-      // userdatas must allocate a new container to return
-      fprintf(source, "    new_%s(L);\n", method->return_type.data.ud.sanatized_name);
-      fprintf(source, "    *check_%s(L, -1) = data;\n", method->return_type.data.ud.sanatized_name);
+      // userdatas must be written into the callers container or allocate a new one to return
+      emit_userdata_result(&method->return_type, "data", (out_count > 0) ? 0 : -1, "    ");
       break;
     case TYPE_AP_OBJECT:
       fprintf(source, "    if (data == NULL) {\n");
@@ -2608,6 +2678,14 @@ void emit_docs_type(struct type type, const char *prefix, const char *suffix) {
   }
 }
 
+// emit the optional out argument for a reusable userdata result
+void emit_docs_out_arg(const struct type *type, int index) {
+  char *param_name = (char *)allocate(40);
+  sprintf(param_name, "---@param param%i?", index);
+  emit_docs_type(*type, param_name, " -- optional object to write the result into\n");
+  free(param_name);
+}
+
 void emit_docs_method(const char *name, const char *method_name, struct method *method) {
 
   fprintf(docs, "-- desc\n");
@@ -2630,6 +2708,20 @@ void emit_docs_method(const char *name, const char *method_name, struct method *
     arg = arg->next;
   }
 
+  // optional out arguments, matching the order used by emit_userdata_method
+  if (is_reusable_userdata(&method->return_type)) {
+    emit_docs_out_arg(&method->return_type, count);
+    count++;
+  }
+  arg = method->arguments;
+  while (arg != NULL) {
+    if ((arg->type.flags & (TYPE_FLAGS_NULLABLE | TYPE_FLAGS_REFERNCE)) && is_reusable_userdata(&arg->type)) {
+      emit_docs_out_arg(&arg->type, count);
+      count++;
+    }
+    arg = arg->next;
+  }
+
   // return type
   if ((method->flags & TYPE_FLAGS_NULLABLE) == 0) {
     emit_docs_type(method->return_type, "---@return", "\n");
@@ -18,6 +18,10 @@
   #endif //HAL_OS_FATFS_IO
 #endif // SCRIPTING_DIRECTORY
 
+#ifndef SCRIPTING_CACHE_DIRECTORY
+  #define SCRIPTING_CACHE_DIRECTORY SCRIPTING_DIRECTORY "/cache"
+#endif // SCRIPTING_CACHE_DIRECTORY
+
 #ifndef REPL_IN
   #define REPL_IN REPL_DIRECTORY "/in"
 #endif // REPL_IN
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <AP_Math/AP_Math.h>
+
+// a script overdue by more than this, or by more than its own period, is run before any weighting
+#ifndef SCRIPTING_MAX_LATE_MS
+#define SCRIPTING_MAX_LATE_MS 100
+#endif
+
+/*
+  select the next script to run from a list sorted by next_run_ms,
+  soonest first. Scripts need next_run_ms, period_ms and next members.
+
+  The first script overdue by more than its own period, or by more
+  than SCRIPTING_MAX_LATE_MS, is run, so no script can be starved.
+  Otherwise the script furthest behind relative to its own period is
+  chosen, so a slow script can't hold back a script that asked to run
+  at a high rate. Returns nullptr if no script is due
+ */
+template <typename T>
+T *lua_select_next_script(T *scripts, uint64_t now_ms)
+{
+    T *selected = nullptr;
+    uint64_t selected_weight = 0;
+    for (T *script = scripts; script != nullptr && script->next_run_ms <= now_ms; script = script->next) {
+        const uint64_t late_ms = now_ms - script->next_run_ms;
+        if (late_ms > MIN(uint64_t(script->period_ms), uint64_t(SCRIPTING_MAX_LATE_MS))) {
+            return script;
+        }
+        // lateness in units of the script's period, scaled to keep resolution
+        const uint64_t weight = (late_ms + 1) * 1000U / MAX(script->period_ms, 1U);
+        if (selected == nullptr || weight > selected_weight) {
+            selected = script;
+            selected_weight = weight;
+        }
+    }
+    return selected;
+}
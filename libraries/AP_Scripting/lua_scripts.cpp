@@ -18,9 +18,13 @@
 #if AP_SCRIPTING_ENABLED
 
 #include "lua_scripts.h"
+#include "lua_scheduler.h"
 #include <AP_HAL/AP_HAL.h>
 #include "AP_Scripting.h"
 #include <AP_Logger/AP_Logger.h>
+#include <AP_Math/crc.h>
+#include <AP_Common/AP_FWVersion.h>
+#include <AP_CheckFirmware/monocypher.h>
 
 #include <AP_Scripting/lua_generated_bindings.h>
 
@@ -36,6 +40,10 @@ HAL_Semaphore lua_scripts::error_msg_buf_sem;
 uint8_t lua_scripts::print_error_count;
 uint32_t lua_scripts::last_print_ms;
 
+ExpandingString lua_scripts::stats_text;
+HAL_Semaphore lua_scripts::stats_text_sem;
+uint32_t lua_scripts::alloc_bytes;
+
 uint32_t lua_scripts::loaded_checksum;
 uint32_t lua_scripts::running_checksum;
 HAL_Semaphore lua_scripts::crc_sem;
@@ -157,8 +165,265 @@ void lua_scripts::update_stats(const char *name, uint32_t run_time, int total_me
 #endif // HAL_LOGGING_ENABLED
 }
 
+#if AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+/*
+  the bytecode cache holds one file per script, named by the crc32 of
+  the script source, containing this header followed by the output of
+  lua_dump(). An entry is only used by the firmware build that wrote
+  it and only if the full hash of the script source still matches
+ */
+#define BYTECODE_CACHE_MAGIC 0x4C424332 // LBC2
+
+struct PACKED bytecode_cache_header {
+    uint32_t magic;
+    uint32_t fw_hash;       // git hash of the firmware that wrote the entry
+    uint8_t source_hash[BYTECODE_CACHE_HASH_LEN]; // blake2b of the script source
+    uint32_t length;        // length of the bytecode following the header
+    uint32_t crc;           // crc32 of the bytecode
+};
+
+struct bytecode_cache_writer {
+    int fd;
+    bytecode_cache_header *header;
+};
+
+struct bytecode_cache_reader {
+    int fd;
+    uint32_t remaining;
+    char buf[128];
+};
+
+bool lua_scripts::bytecode_cache_enabled(void) const
+{
+    return (_debug_options.get() & uint8_t(DebugLevel::ENABLE_BYTECODE_CACHE)) != 0;
+}
+
+bool lua_scripts::bytecode_cache_filename(char *path, size_t len, uint32_t crc, const char *ext)
+{
+    const int ret = hal.util->snprintf(path, len, SCRIPTING_CACHE_DIRECTORY "/%08X.%s", (unsigned)crc, ext);
+    return ret > 0 && size_t(ret) < len;
+}
+
+/*
+  hash the full source of a script, the crc32 used to name cache
+  entries is too weak to tie an entry to the source it was built from
+ */
+bool lua_scripts::hash_script_source(const char *filename, uint8_t hash[BYTECODE_CACHE_HASH_LEN])
+{
+    const int fd = AP::FS().open(filename, O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    crypto_blake2b_ctx ctx;
+    crypto_blake2b_general_init(&ctx, BYTECODE_CACHE_HASH_LEN, nullptr, 0);
+    uint8_t buf[128];
+    int32_t n;
+    while ((n = AP::FS().read(fd, buf, sizeof(buf))) > 0) {
+        crypto_blake2b_update(&ctx, buf, n);
+    }
+    AP::FS().close(fd);
+    crypto_blake2b_final(&ctx, hash);
+    return n == 0;
+}
+
+int lua_scripts::bytecode_writer(lua_State *L, const void *p, size_t sz, void *ud)
+{
+    bytecode_cache_writer *writer = (bytecode_cache_writer *)ud;
+    if (AP::FS().write(writer->fd, p, sz) != int32_t(sz)) {
+        return 1;
+    }
+    writer->header->length += sz;
+    writer->header->crc = crc_crc32(writer->header->crc, (const uint8_t *)p, sz);
+    return 0;
+}
+
+const char *lua_scripts::bytecode_reader(lua_State *L, void *ud, size_t *sz)
+{
+    bytecode_cache_reader *reader = (bytecode_cache_reader *)ud;
+    const int32_t n = AP::FS().read(reader->fd, reader->buf, MIN(reader->remaining, sizeof(reader->buf)));
+    if (n <= 0) {
+        *sz = 0;
+        return nullptr;
+    }
+    reader->remaining -= n;
+    *sz = n;
+    return reader->buf;
+}
+
+/*
+  try and load the cached bytecode for a script, returns true with the
+  function on the top of the stack on success
+ */
+bool lua_scripts::load_cached_bytecode(lua_State *L, const char *filename, uint32_t crc, const uint8_t source_hash[BYTECODE_CACHE_HASH_LEN])
+{
+    char path[64];
+    if (!bytecode_cache_filename(path, sizeof(path), crc, "luac")) {
+        return false;
+    }
+    bytecode_cache_reader reader;
+    reader.fd = AP::FS().open(path, O_RDONLY);
+    if (reader.fd == -1) {
+        return false;
+    }
+
+    bytecode_cache_header header;
+    bool ok = AP::FS().read(reader.fd, &header, sizeof(header)) == sizeof(header) &&
+              header.magic == BYTECODE_CACHE_MAGIC &&
+              header.fw_hash == AP::fwversion().fw_hash &&
+              memcmp(header.source_hash, source_hash, BYTECODE_CACHE_HASH_LEN) == 0;
+
+    if (ok) {
+        // the VM does not validate bytecode, so check its integrity first
+        uint32_t length = 0;
+        uint32_t bytecode_crc = 0;
+        int32_t n;
+        while ((n = AP::FS().read(reader.fd, reader.buf, sizeof(reader.buf))) > 0) {
+            bytecode_crc = crc_crc32(bytecode_crc, (const uint8_t *)reader.buf, n);
+            length += n;
+        }
+        ok = n == 0 && length == header.length && bytecode_crc == header.crc &&
+             AP::FS().lseek(reader.fd, sizeof(header), SEEK_SET) == sizeof(header);
+    }
+
+    if (ok) {
+        reader.remaining = header.length;
+        ok = lua_load(L, bytecode_reader, &reader, filename, "b") == LUA_OK;
+        if (!ok) {
+            // bytecode from an incompatible firmware, pop the error
+            lua_pop(L, 1);
+        }
+    }
+    AP::FS().close(reader.fd);
+
+    if (!ok) {
+        // remove the invalid entry, it will be replaced when the script is compiled
+        AP::FS().unlink(path);
+    }
+    return ok;
+}
+
+/*
+  save the bytecode of the function on the top of the stack to the cache
+ */
+void lua_scripts::save_cached_bytecode(lua_State *L, uint32_t crc, const uint8_t source_hash[BYTECODE_CACHE_HASH_LEN])
+{
+    char path[64];
+    char tmp_path[64];
+    if (!bytecode_cache_filename(path, sizeof(path), crc, "luac") ||
+        !bytecode_cache_filename(tmp_path, sizeof(tmp_path), crc, "tmp")) {
+        return;
+    }
+    const int fd = AP::FS().open(tmp_path, O_WRONLY|O_CREAT|O_TRUNC);
+    if (fd == -1) {
+        return;
+    }
+
+    bytecode_cache_header header {};
+    header.magic = BYTECODE_CACHE_MAGIC;
+    header.fw_hash = AP::fwversion().fw_hash;
+    memcpy(header.source_hash, source_hash, BYTECODE_CACHE_HASH_LEN);
+    bytecode_cache_writer writer { fd, &header };
+
+    // keep debug information so errors still report script line numbers
+    bool ok = AP::FS().write(fd, &header, sizeof(header)) == sizeof(header) &&
+              lua_dump(L, bytecode_writer, &writer, 0) == 0 &&
+              AP::FS().lseek(fd, 0, SEEK_SET) == 0 &&
+              AP::FS().write(fd, &header, sizeof(header)) == sizeof(header);
+    ok = (AP::FS().fsync(fd) == 0) && ok;
+    AP::FS().close(fd);
+
+    // only make the entry visible once it is complete
+    if (!ok || AP::FS().rename(tmp_path, path) != 0) {
+        AP::FS().unlink(tmp_path);
+    }
+}
+
+/*
+  remove cache entries which no loaded script uses. Names are
+  collected in batches and only removed once the directory is closed,
+  as not all filesystems allow unlinking while iterating
+ */
+void lua_scripts::prune_bytecode_cache(void)
+{
+    const uint8_t batch_max = 8;
+    struct {
+        uint32_t crc;
+        bool tmp;
+    } stale[batch_max];
+
+    while (true) {
+        auto *d = AP::FS().opendir(SCRIPTING_CACHE_DIRECTORY);
+        if (d == nullptr) {
+            return;
+        }
+        uint8_t count = 0;
+        for (struct dirent *de=AP::FS().readdir(d); de && count < batch_max; de=AP::FS().readdir(d)) {
+            // entries are named with 8 hex digits
+            char *end = nullptr;
+            const uint32_t crc = strtoul(de->d_name, &end, 16);
+            if (end != &de->d_name[8]) {
+                continue;
+            }
+            const bool tmp = strcmp(end, ".tmp") == 0;
+            if (!tmp && strcmp(end, ".luac") != 0) {
+                continue;
+            }
+            bool in_use = false;
+            if (!tmp) {
+                for (const script_info *script = scripts; script != nullptr; script = script->next) {
+                    if (script->crc == crc) {
+                        in_use = true;
+                        break;
+                    }
+                }
+            }
+            if (!in_use) {
+                stale[count].crc = crc;
+                stale[count].tmp = tmp;
+                count++;
+            }
+        }
+        AP::FS().closedir(d);
+
+        for (uint8_t i=0; i<count; i++) {
+            char path[64];
+            if (!bytecode_cache_filename(path, sizeof(path), stale[i].crc, stale[i].tmp ? "tmp" : "luac") ||
+                AP::FS().unlink(path) != 0) {
+                // don't rescan forever for an entry we can't remove
+                return;
+            }
+        }
+        if (count < batch_max) {
+            return;
+        }
+    }
+}
+#endif // AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+
+int lua_scripts::load_chunk(lua_State *L, const char *filename, uint32_t crc, bool have_crc)
+{
+#if AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+    uint8_t source_hash[BYTECODE_CACHE_HASH_LEN];
+    const bool use_cache = have_crc && bytecode_cache_enabled() && hash_script_source(filename, source_hash);
+    if (use_cache && load_cached_bytecode(L, filename, crc, source_hash)) {
+        return LUA_OK;
+    }
+    const int error = luaL_loadfile(L, filename);
+    if ((error == LUA_OK) && use_cache) {
+        save_cached_bytecode(L, crc, source_hash);
+    }
+    return error;
+#else
+    return luaL_loadfile(L, filename);
+#endif
+}
+
 lua_scripts::script_info *lua_scripts::load_script(lua_State *L, char *filename) {
-    if (int error = luaL_loadfile(L, filename)) {
+    // Get checksum of file, this is also the key for the bytecode cache
+    uint32_t crc = 0;
+    const bool have_crc = AP::FS().crc32(filename, crc);
+
+    if (int error = load_chunk(L, filename, crc, have_crc)) {
         switch (error) {
             case LUA_ERRSYNTAX:
                 set_and_print_new_error_message(MAV_SEVERITY_CRITICAL, "Error: %s", lua_tostring(L, -1));
@@ -203,9 +468,7 @@ lua_scripts::script_info *lua_scripts::load_script(lua_State *L, char *filename)
     new_script->lua_ref = luaL_ref(L, LUA_REGISTRYINDEX);   // cache the reference
     new_script->next_run_ms = AP_HAL::millis64() - 1; // force the script to be stale
 
-    // Get checksum of file
-    uint32_t crc = 0;
-    if (AP::FS().crc32(filename, crc)) {
+    if (have_crc) {
         // Record crc of this script
         new_script->crc = crc;
         {
@@ -306,18 +569,34 @@ void lua_scripts::reset_loop_overtime(lua_State *L) {
     lua_sethook(L, hook, LUA_MASKCOUNT, vm_steps);
 }
 
-void lua_scripts::run_next_script(lua_State *L) {
+/*
+  run the next script. Returns the script that was run, or nullptr if
+  there were none. finished is set if the script is no longer
+  scheduled, in which case the caller must remove it with
+  remove_script() once it is done with it
+ */
+lua_scripts::script_info *lua_scripts::run_next_script(lua_State *L, bool &finished) {
+    finished = false;
     if (scripts == nullptr) {
 #if defined(AP_SCRIPTING_CHECKS) && AP_SCRIPTING_CHECKS >= 1
         AP_HAL::panic("Lua: Attempted to run a script without any scripts queued");
 #endif // defined(AP_SCRIPTING_CHECKS) && AP_SCRIPTING_CHECKS >= 1
-        return;
+        return nullptr;
     }
 
     uint64_t start_time_ms = AP_HAL::millis64();
     // strip the selected script out of the list
-    script_info *script = scripts;
-    scripts = script->next;
+    script_info *script = select_next_script(start_time_ms);
+    if (script == nullptr) {
+        // woken slightly early, run the soonest script
+        script = scripts;
+    }
+    unlink_script(script);
+    const uint64_t due_ms = script->next_run_ms;
+
+    if ((_debug_options.get() & uint8_t(DebugLevel::RUNTIME_MSG)) != 0) {
+        GCS_SEND_TEXT(MAV_SEVERITY_DEBUG, "Lua: Running %s", script->name);
+    }
 
     // reset the hook to clear the counter
     reset_loop_overtime(L);
@@ -329,22 +608,38 @@ void lua_scripts::run_next_script(lua_State *L) {
     lua_rawgeti(L, LUA_REGISTRYINDEX, script->lua_ref);
     AP::scripting()->set_current_ref(script->lua_ref);
 
-    if(lua_pcall(L, 0, LUA_MULTRET, 0)) {
+    const uint32_t start_alloc_bytes = alloc_bytes;
+    const uint32_t start_us = AP_HAL::micros();
+
+    const int status = lua_pcall(L, 0, LUA_MULTRET, 0);
+
+    // account the CPU time and memory used by this run
+    const uint32_t run_time_us = AP_HAL::micros() - start_us;
+    const uint32_t run_alloc_bytes = alloc_bytes - start_alloc_bytes;
+    script->stats.run_count++;
+    script->stats.run_time_us += run_time_us;
+    script->stats.max_run_time_us = MAX(script->stats.max_run_time_us, run_time_us);
+    script->stats.alloc_bytes += run_alloc_bytes;
+    if (start_time_ms > due_ms) {
+        script->stats.max_late_ms = MAX(script->stats.max_late_ms, uint32_t(start_time_ms - due_ms));
+    }
+
+    if (status) {
         if (overtime) {
             // script has consumed an excessive amount of CPU time
             set_and_print_new_error_message(MAV_SEVERITY_CRITICAL, "%s exceeded time limit", script->name);
         } else {
             set_and_print_new_error_message(MAV_SEVERITY_CRITICAL, "%s", lua_tostring(L, -1));
         }
-        remove_script(L, script);
+        finished = true;
         lua_pop(L, 1);
-        return;
+        return script;
     } else {
         int returned = lua_gettop(L) - stack_top;
         switch (returned) {
             case 0:
                 // no time to reschedule so bail out
-                remove_script(L, script);
+                finished = true;
                 break;
             case 2:
                 {
@@ -352,18 +647,25 @@ void lua_scripts::run_next_script(lua_State *L) {
                     if (lua_type(L, -1) != LUA_TNUMBER) {
                         set_and_print_new_error_message(MAV_SEVERITY_CRITICAL, "%s did not return a delay (0x%d)", script->name, lua_type(L, -1));
                         lua_pop(L, 2);
-                        remove_script(L, script);
-                        return;
+                        finished = true;
+                        return script;
                     }
                     if (lua_type(L, -2) != LUA_TFUNCTION) {
                         set_and_print_new_error_message(MAV_SEVERITY_CRITICAL, "%s did not return a function (0x%d)", script->name, lua_type(L, -2));
                         lua_pop(L, 2);
-                        remove_script(L, script);
-                        return;
+                        finished = true;
+                        return script;
                     }
 
                     // types match the expectations, go ahead and reschedule
-                    script->next_run_ms = start_time_ms + (uint64_t)luaL_checknumber(L, -1);
+                    const uint64_t delay_ms = (uint64_t)luaL_checknumber(L, -1);
+                    script->period_ms = MIN(delay_ms, UINT32_MAX);
+                    // keep to the requested period even if we ran late, but
+                    // don't try and catch up on runs missed entirely
+                    script->next_run_ms = due_ms + delay_ms;
+                    if (script->next_run_ms < start_time_ms) {
+                        script->next_run_ms = start_time_ms + delay_ms;
+                    }
                     lua_pop(L, 1);
                     int old_ref = script->lua_ref;
                     script->lua_ref = luaL_ref(L, LUA_REGISTRYINDEX);
@@ -374,13 +676,14 @@ void lua_scripts::run_next_script(lua_State *L) {
             default:
                 {
                     set_and_print_new_error_message(MAV_SEVERITY_CRITICAL, "%s returned bad result count (%d)", script->name, returned);
-                    remove_script(L, script);
+                    finished = true;
                     // pop all the results we got that we didn't expect
                     lua_pop(L, returned);
                     break;
                  }
          }
      }
+    return script;
 }
 
 void lua_scripts::remove_script(lua_State *L, script_info *script) {
@@ -389,18 +692,7 @@ void lua_scripts::remove_script(lua_State *L, script_info *script) {
     }
 
     // ensure that the script isn't in the loaded list for any reason
-    if (scripts == nullptr) {
-        // nothing to do, already not in the list
-    } else if (scripts == script) {
-        scripts = script->next;
-    } else {
-        for(script_info * current = scripts; current->next != nullptr; current = current->next) {
-            if (current->next == script) {
-                current->next = script->next;
-                break;
-            }
-        }
-    }
+    unlink_script(script);
 
     {
         // Remove from running checksum
@@ -416,6 +708,26 @@ void lua_scripts::remove_script(lua_State *L, script_info *script) {
     _heap.deallocate(script);
 }
 
+void lua_scripts::unlink_script(script_info *script) {
+    if (scripts == nullptr) {
+        // nothing to do, already not in the list
+    } else if (scripts == script) {
+        scripts = script->next;
+    } else {
+        for(script_info * current = scripts; current->next != nullptr; current = current->next) {
+            if (current->next == script) {
+                current->next = script->next;
+                break;
+            }
+        }
+    }
+}
+
+// select the next script to run, see lua_select_next_script()
+lua_scripts::script_info *lua_scripts::select_next_script(uint64_t now_ms) const {
+    return lua_select_next_script(scripts, now_ms);
+}
+
 void lua_scripts::reschedule_script(script_info *script) {
     if (script == nullptr) {
 #if defined(AP_SCRIPTING_CHECKS) && AP_SCRIPTING_CHECKS >= 1
@@ -455,7 +767,67 @@ MultiHeap lua_scripts::_heap;
 
 void *lua_scripts::alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
     (void)ud; /* not used */
-    return _heap.change_size(ptr, osize, nsize);
+    // osize is the object type, not a size, for new allocations
+    const size_t old_size = (ptr == nullptr) ? 0 : osize;
+    void *ret = _heap.change_size(ptr, osize, nsize);
+    if (ret != nullptr && nsize > old_size) {
+        alloc_bytes += nsize - old_size;
+    }
+    return ret;
+}
+
+void lua_scripts::report_stats(void) {
+    const uint32_t now_ms = AP_HAL::millis();
+    const uint32_t interval_ms = MAX(now_ms - last_stats_report_ms, 1U);
+    last_stats_report_ms = now_ms;
+
+#if HAL_LOGGING_ENABLED
+    const bool log_stats = (_debug_options.get() & uint8_t(DebugLevel::LOG_RUNTIME)) != 0;
+#endif
+
+    // the text is rebuilt in place, reusing the buffer from the last report
+    WITH_SEMAPHORE(stats_text_sem);
+    stats_text.reset();
+    stats_text.printf("%-16s %5s %8s %8s %6s %8s %6s %5s\n",
+                      "Name", "Runs", "Time_us", "Max_us", "Per_ms", "Alloc", "Late", "CPU%");
+
+    for (script_info *script = scripts; script != nullptr; script = script->next) {
+        const char *name = strrchr(script->name, '/');
+        name = (name != nullptr) ? name+1 : script->name;
+#if HAL_LOGGING_ENABLED
+        if (log_stats) {
+            struct log_Scripting_Stats pkt {
+                LOG_PACKET_HEADER_INIT(LOG_SCRIPTING_STATS_MSG),
+                time_us      : AP_HAL::micros64(),
+                name         : {},
+                run_count    : script->stats.run_count,
+                run_time     : script->stats.run_time_us,
+                max_run_time : script->stats.max_run_time_us,
+                period       : script->period_ms,
+                alloc        : script->stats.alloc_bytes,
+                max_late     : script->stats.max_late_ms,
+            };
+            strncpy_noterm(pkt.name, name, sizeof(pkt.name));
+            AP::logger().WriteBlock(&pkt, sizeof(pkt));
+        }
+#endif
+        stats_text.printf("%-16.16s %5u %8u %8u %6u %8u %6u %5.1f\n",
+                          name,
+                          unsigned(script->stats.run_count),
+                          unsigned(script->stats.run_time_us),
+                          unsigned(script->stats.max_run_time_us),
+                          unsigned(script->period_ms),
+                          unsigned(script->stats.alloc_bytes),
+                          unsigned(script->stats.max_late_ms),
+                          script->stats.run_time_us * 0.1 / interval_ms);
+        memset(&script->stats, 0, sizeof(script->stats));
+    }
+}
+
+// append the last per-script stats report to str
+void lua_scripts::stats_info(ExpandingString &str) {
+    WITH_SEMAPHORE(stats_text_sem);
+    str.append(stats_text.get_string(), stats_text.get_length());
 }
 
 void lua_scripts::repl_cleanup (void) {
@@ -516,24 +888,43 @@ void lua_scripts::run(void) {
     DEV_PRINTF("Lua: State memory usage: %i + %i\n", inital_mem, loaded_mem - inital_mem);
 #endif
 
+#if AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+    if (bytecode_cache_enabled()) {
+        AP::FS().mkdir(SCRIPTING_CACHE_DIRECTORY);
+    }
+#endif
+
     // Scan the filesystem in an appropriate manner and autostart scripts
     // Skip those directores disabled with SCR_DIR_DISABLE param
     uint16_t dir_disable = AP_Scripting::get_singleton()->get_disabled_dir();
     bool loaded = false;
+    bool skipped = false;
     if ((dir_disable & uint16_t(AP_Scripting::SCR_DIR::SCRIPTS)) == 0) {
         load_all_scripts_in_dir(L, SCRIPTING_DIRECTORY);
         loaded = true;
+    } else {
+        skipped = true;
     }
 #ifdef HAL_HAVE_AP_ROMFS_EMBEDDED_LUA
     if ((dir_disable & uint16_t(AP_Scripting::SCR_DIR::ROMFS)) == 0) {
         load_all_scripts_in_dir(L, "@ROMFS/scripts");
         loaded = true;
+    } else {
+        skipped = true;
     }
 #endif
     if (!loaded) {
         GCS_SEND_TEXT(MAV_SEVERITY_CRITICAL, "Lua: All directory's disabled see SCR_DIR_DISABLE");
     }
 
+#if AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+    // entries for scripts in a disabled directory look unused, keep
+    // them so re-enabling the directory doesn't mean compiling again
+    if (bytecode_cache_enabled() && !skipped) {
+        prune_bytecode_cache();
+    }
+#endif
+
 #ifndef __clang_analyzer__
     succeeded_initial_load = true;
 #endif // __clang_analyzer__
@@ -569,12 +960,6 @@ void lua_scripts::run(void) {
                 hal.scheduler->delay(scripts->next_run_ms - now_ms);
             }
 
-            if ((_debug_options.get() & uint8_t(DebugLevel::RUNTIME_MSG)) != 0) {
-                GCS_SEND_TEXT(MAV_SEVERITY_DEBUG, "Lua: Running %s", scripts->name);
-            }
-            // copy name for logging, cant do it after as script reschedule moves the pointers
-            const char * script_name = scripts->name;
-
 #if DISABLE_INTERRUPTS_FOR_SCRIPT_RUN
             void *istate = hal.scheduler->disable_interrupts_save();
 #endif
@@ -582,7 +967,8 @@ void lua_scripts::run(void) {
             const int startMem = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
             const uint32_t loadEnd = AP_HAL::micros();
 
-            run_next_script(L);
+            bool finished;
+            script_info *script = run_next_script(L, finished);
 
             const uint32_t runEnd = AP_HAL::micros();
             const int endMem = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
@@ -591,7 +977,12 @@ void lua_scripts::run(void) {
             hal.scheduler->restore_interrupts(istate);
 #endif
 
-            update_stats(script_name, runEnd - loadEnd, endMem, endMem - startMem);
+            if (script != nullptr) {
+                update_stats(script->name, runEnd - loadEnd, endMem, endMem - startMem);
+                if (finished) {
+                    remove_script(L, script);
+                }
+            }
 
 
             // garbage collect after each script, this shouldn't matter, but seems to resolve a memory leak
@@ -604,6 +995,10 @@ void lua_scripts::run(void) {
             hal.scheduler->delay(1000);
         }
 
+        if (AP_HAL::millis() - last_stats_report_ms >= 1000) {
+            report_stats();
+        }
+
         // re-print the latest error message every 10 seconds 10 times
         const uint8_t error_prints = 10;
         if ((print_error_count < error_prints) && (AP_HAL::millis() - last_print_ms > 10000)) {
@@ -27,10 +27,16 @@
 #include <GCS_MAVLink/GCS_MAVLink.h>
 #include <AP_HAL/Semaphores.h>
 #include <AP_Common/MultiHeap.h>
+#include <AP_Common/ExpandingString.h>
 #include "lua_common_defs.h"
 
 #include "lua/src/lua.hpp"
 
+#if AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+// length of the script source hash held in each bytecode cache entry
+#define BYTECODE_CACHE_HASH_LEN 32
+#endif
+
 class lua_scripts
 {
 public:
@@ -55,6 +61,7 @@ public:
         LOG_RUNTIME = 1U << 3,
         DISABLE_PRE_ARM = 1U << 4,
         SAVE_CHECKSUM = 1U << 5,
+        ENABLE_BYTECODE_CACHE = 1U << 6,
     };
 
 private:
@@ -67,16 +74,51 @@ private:
        uint64_t next_run_ms; // time (in milliseconds) the script should next be run at
        uint32_t crc;         // crc32 checksum
        char *name;           // filename for the script // FIXME: This information should be available from Lua
+       uint32_t period_ms;   // delay last requested by the script
+       struct {
+           uint16_t run_count;       // number of runs
+           uint32_t run_time_us;     // total CPU time used
+           uint32_t max_run_time_us; // longest single run
+           uint32_t alloc_bytes;     // bytes allocated from the heap
+           uint32_t max_late_ms;     // worst delay past the requested run time
+       } stats;                      // accumulated since the last stats report
        script_info *next;
     } script_info;
 
     script_info *load_script(lua_State *L, char *filename);
 
+    // load a script as a function on the top of the stack, returns a lua error code
+    int load_chunk(lua_State *L, const char *filename, uint32_t crc, bool have_crc);
+
+#if AP_SCRIPTING_BYTECODE_CACHE_ENABLED
+    // compiled bytecode cache, keyed by the crc32 of the script source
+    bool bytecode_cache_enabled(void) const;
+    static bool bytecode_cache_filename(char *path, size_t len, uint32_t crc, const char *ext);
+    static bool hash_script_source(const char *filename, uint8_t hash[BYTECODE_CACHE_HASH_LEN]);
+    bool load_cached_bytecode(lua_State *L, const char *filename, uint32_t crc, const uint8_t source_hash[BYTECODE_CACHE_HASH_LEN]);
+    void save_cached_bytecode(lua_State *L, uint32_t crc, const uint8_t source_hash[BYTECODE_CACHE_HASH_LEN]);
+    // remove cache files which don't match any loaded script
+    void prune_bytecode_cache(void);
+    static int bytecode_writer(lua_State *L, const void *p, size_t sz, void *ud);
+    static const char *bytecode_reader(lua_State *L, void *ud, size_t *sz);
+#endif
+
     void reset_loop_overtime(lua_State *L);
 
     void load_all_scripts_in_dir(lua_State *L, const char *dirname);
 
-    void run_next_script(lua_State *L);
+    // run the next script, returning it. finished is set if it must be removed
+    script_info *run_next_script(lua_State *L, bool &finished);
+
+    // pick the script that is furthest behind its requested period, returns nullptr if none are due
+    script_info *select_next_script(uint64_t now_ms) const;
+
+    // remove a script from the list without freeing it
+    void unlink_script(script_info *script);
+
+    // log per-script stats and update the stats text, then reset the stats
+    void report_stats(void);
+    uint32_t last_stats_report_ms;
 
     void remove_script(lua_State *L, script_info *script);
 
@@ -99,6 +141,10 @@ private:
 
     script_info *scripts; // linked list of scripts to be run, sorted by next run time (soonest first)
 
+    // text of the last stats report, for @SYS/scripts.txt
+    static ExpandingString stats_text;
+    static HAL_Semaphore stats_text_sem;
+
     // hook will be run when CPU time for a script is exceeded
     // it must be static to be passed to the C API
     static void hook(lua_State *L, lua_Debug *ar);
@@ -116,6 +162,9 @@ private:
 
     static MultiHeap _heap;
 
+    // running total of bytes allocated from the heap, used for per-script accounting
+    static uint32_t alloc_bytes;
+
     // helper for print and log of runtime stats
     void update_stats(const char *name, uint32_t run_time, int total_mem, int run_mem);
 
@@ -146,6 +195,9 @@ public:
     static uint32_t get_loaded_checksum();
     static uint32_t get_running_checksum();
 
+    // append the last per-script stats report to str
+    static void stats_info(ExpandingString &str);
+
 };
 
 #endif  // AP_SCRIPTING_ENABLED
@@ -0,0 +1,77 @@
+-- micro benchmark of the Lua heap used by calls into the bindings, with and without a
+-- caller supplied object to write the result into. It is intended to be run with autotest,
+-- results are reported as bytes allocated per call. The script runs once and then exits
+
+local calls = 1000 -- number of calls to measure for each case
+
+-- return the bytes allocated per call by fn, with the garbage collector stopped so nothing is freed
+local function bytes_per_call(fn)
+  collectgarbage("collect")
+  collectgarbage("stop")
+  local start_kb = collectgarbage("count")
+  for _ = 1, calls do
+    fn()
+  end
+  local used_kb = collectgarbage("count") - start_kb
+  collectgarbage("restart")
+  return used_kb * 1024 / calls
+end
+
+local loc = Location()
+local target = Location()
+target:offset(500, 200)
+local vec = Vector3f()
+vec:x(1)
+vec:y(2)
+vec:z(3)
+local quat = Quaternion()
+quat:from_euler(0.1, 0.2, 0.3)
+
+local out_loc = Location()
+local out_vec2 = Vector2f()
+local out_vec3 = Vector3f()
+local out_quat = Quaternion()
+
+local cases = {
+  { "Location:get_distance_NE",
+    function() return loc:get_distance_NE(target) end,
+    function() return loc:get_distance_NE(target, out_vec2) end },
+  { "Location:get_distance_NED",
+    function() return loc:get_distance_NED(target) end,
+    function() return loc:get_distance_NED(target, out_vec3) end },
+  { "Location:copy",
+    function() return loc:copy() end,
+    function() return loc:copy(out_loc) end },
+  { "Vector3f:scale",
+    function() return vec:scale(2) end,
+    function() return vec:scale(2, out_vec3) end },
+  { "Quaternion:inverse",
+    function() return quat:inverse() end,
+    function() return quat:inverse(out_quat) end },
+  { "ahrs:get_gyro",
+    function() return ahrs:get_gyro() end,
+    function() return ahrs:get_gyro(out_vec3) end },
+  { "ahrs:get_position",
+    function() return ahrs:get_position() end,
+    function() return ahrs:get_position(out_loc) end },
+}
+
+function update()
+  local passed = true
+  for _, case in ipairs(cases) do
+    local alloc = bytes_per_call(case[2])
+    local reuse = bytes_per_call(case[3])
+    gcs:send_text(6, string.format("%s: %.1f bytes/call, %.1f bytes/call reused", case[1], alloc, reuse))
+    -- a reused result must never cost more than a newly allocated one
+    if reuse > 0.1 or reuse > alloc then
+      gcs:send_text(0, string.format("%s allocated %.1f bytes/call with a reused result", case[1], reuse))
+      passed = false
+    end
+  end
+
+  if passed then
+    gcs:send_text(3, "Allocation benchmark passed")
+  end
+end
+
+return update()
@@ -35,6 +35,45 @@ function test_offset(ofs_e, ofs_n)
   return true
 end
 
+function test_reuse(ofs_e, ofs_n)
+  local manipulated_pos = Location()
+  manipulated_pos:offset(ofs_e, ofs_n)
+  -- results written into a userdata passed by the caller must match a freshly allocated result
+  local out_NE = Vector2f()
+  local from_origin_NE = Location():get_distance_NE(manipulated_pos, out_NE)
+  if not rawequal(from_origin_NE, out_NE) then
+    gcs:send_text(0, "Location:get_distance_NE() did not return the supplied Vector2f")
+    return false
+  end
+  local expected_NE = Location():get_distance_NE(manipulated_pos)
+  if (not is_equal(expected_NE:x(), out_NE:x())) or (not is_equal(expected_NE:y(), out_NE:y())) then
+    gcs:send_text(0, string.format("Reused NE %.1f, %.1f != %.1f %.1f", out_NE:x(), out_NE:y(), expected_NE:x(), expected_NE:y()))
+    return false
+  end
+  -- reusing the container in a loop should not allocate
+  local out_NED = Vector3f()
+  collectgarbage("stop")
+  local start_kb = collectgarbage("count")
+  for _ = 1, 100 do
+    manipulated_pos:get_distance_NED(manipulated_pos, out_NED)
+  end
+  local used_kb = collectgarbage("count") - start_kb
+  collectgarbage("restart")
+  if used_kb > 0.1 then
+    gcs:send_text(0, string.format("Location:get_distance_NED() with a reused Vector3f allocated %.2fkB", used_kb))
+    return false
+  end
+  local q = Quaternion()
+  q:from_euler(0.1, 0.2, 0.3)
+  local out_q = Quaternion()
+  local expected_q = q:inverse()
+  if (not rawequal(q:inverse(out_q), out_q)) or (not is_equal(expected_q:q1(), out_q:q1())) or (not is_equal(expected_q:q4(), out_q:q4())) then
+    gcs:send_text(0, "Quaternion:inverse() did not write into the supplied Quaternion")
+    return false
+  end
+  return true
+end
+
 function update()
   local all_tests_passed = true
   local require_test_local = require('test/nested')
@@ -53,6 +92,7 @@ function update()
   end
   -- each test should run then and it's result with the previous ones
   all_tests_passed = test_offset(500, 200) and all_tests_passed
+  all_tests_passed = test_reuse(500, 200) and all_tests_passed
 
   if all_tests_passed then
     gcs:send_text(3, "Internal tests passed")
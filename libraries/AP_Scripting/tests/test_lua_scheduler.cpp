@@ -0,0 +1,117 @@
+#include <AP_gtest.h>
+
+#include <AP_Scripting/lua_scheduler.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+struct test_script {
+    uint64_t next_run_ms;
+    uint32_t period_ms;
+    test_script *next;
+
+    uint32_t run_count;
+    uint64_t max_late_ms;
+};
+
+// insert a script into a list sorted by next_run_ms, as lua_scripts::reschedule_script() does
+static void insert(test_script *&list, test_script *script)
+{
+    test_script **p = &list;
+    while (*p != nullptr && (*p)->next_run_ms <= script->next_run_ms) {
+        p = &(*p)->next;
+    }
+    script->next = *p;
+    *p = script;
+}
+
+static void unlink(test_script *&list, test_script *script)
+{
+    for (test_script **p = &list; *p != nullptr; p = &(*p)->next) {
+        if (*p == script) {
+            *p = script->next;
+            return;
+        }
+    }
+}
+
+/*
+  run scripts which each take run_ms of CPU time for duration_ms,
+  rescheduling them as lua_scripts::run_next_script() does
+ */
+static void simulate(test_script *scripts, uint8_t count, uint32_t run_ms, uint64_t duration_ms)
+{
+    test_script *list = nullptr;
+    for (uint8_t i=0; i<count; i++) {
+        insert(list, &scripts[i]);
+    }
+    uint64_t now_ms = 0;
+    while (now_ms < duration_ms) {
+        now_ms = MAX(now_ms, list->next_run_ms);
+        test_script *script = lua_select_next_script(list, now_ms);
+        ASSERT_NE(script, nullptr);
+        unlink(list, script);
+        const uint64_t due_ms = script->next_run_ms;
+        script->max_late_ms = MAX(script->max_late_ms, now_ms - due_ms);
+        script->run_count++;
+        const uint64_t start_ms = now_ms;
+        now_ms += run_ms;
+        script->next_run_ms = due_ms + script->period_ms;
+        if (script->next_run_ms < start_ms) {
+            script->next_run_ms = start_ms + script->period_ms;
+        }
+        insert(list, script);
+    }
+}
+
+TEST(LuaScheduler, NothingDue)
+{
+    test_script a {};
+    a.next_run_ms = 100;
+    a.period_ms = 100;
+    EXPECT_EQ(lua_select_next_script(&a, 99), nullptr);
+    EXPECT_EQ(lua_select_next_script(&a, 100), &a);
+}
+
+// of two scripts that are both a little late, the one furthest behind its own period runs
+TEST(LuaScheduler, ShortPeriodPreferred)
+{
+    test_script slow {}, fast {};
+    slow.next_run_ms = 990;
+    slow.period_ms = 1000;
+    slow.next = &fast;
+    fast.next_run_ms = 995;
+    fast.period_ms = 10;
+    EXPECT_EQ(lua_select_next_script(&slow, 1000), &fast);
+}
+
+// a script late by more than its own period runs ahead of more heavily weighted scripts
+TEST(LuaScheduler, OverdueRunsFirst)
+{
+    test_script a {}, b {};
+    a.next_run_ms = 975;
+    a.period_ms = 20;
+    a.next = &b;
+    b.next_run_ms = 999;
+    b.period_ms = 1;
+    EXPECT_EQ(lua_select_next_script(&a, 1000), &a);
+}
+
+// with the CPU saturated by a 1ms script, slower scripts still run, and are never later than the bound
+TEST(LuaScheduler, NoStarvation)
+{
+    test_script scripts[3] {};
+    scripts[0].period_ms = 1;
+    scripts[1].period_ms = 50;
+    scripts[2].period_ms = 1000;
+
+    simulate(scripts, ARRAY_SIZE(scripts), 1, 10000);
+
+    EXPECT_GT(scripts[0].run_count, 5000U);
+    EXPECT_GT(scripts[1].run_count, 90U);
+    EXPECT_GT(scripts[2].run_count, 8U);
+    for (const auto &script : scripts) {
+        EXPECT_LE(script.max_late_ms, uint64_t(SCRIPTING_MAX_LATE_MS + ARRAY_SIZE(scripts)));
+    }
+}
+
+AP_GTEST_MAIN()
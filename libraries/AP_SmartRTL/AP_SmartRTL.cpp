@@ -30,8 +30,8 @@ const AP_Param::GroupInfo AP_SmartRTL::var_info[] = {
 
     // @Param: POINTS
     // @DisplayName: SmartRTL maximum number of points on path
-    // @Description: SmartRTL maximum number of points on path. Set to 0 to disable SmartRTL.  100 points consumes about 3k of memory.
-    // @Range: 0 500
+    // @Description: SmartRTL maximum number of points on path. Set to 0 to disable SmartRTL.  100 points consumes about 2k of memory. Boards with less than 500k of RAM are limited to 500 points.
+    // @Range: 0 5000
     // @User: Advanced
     // @RebootRequired: True
     AP_GROUPINFO("POINTS", 1, AP_SmartRTL, _points_max, SMARTRTL_POINTS_DEFAULT),
@@ -64,8 +64,15 @@ const AP_Param::GroupInfo AP_SmartRTL::var_info[] = {
 *    (p2,p3) will get very close (they touch), but there would be nothing to
 *    trim between them.
 *
+*    To avoid comparing every pair of segments, the segments are grouped into
+*    blocks of consecutive segments, and the blocks into groups, and the
+*    bounding box of each block and group is kept.  Any block or group whose
+*    box is too far from a segment is skipped over.  The index is extended as
+*    points are added and rebuilt when points are removed.
+*
 *    2. Simplification uses the Ramer-Douglas-Peucker algorithm. See Wikipedia
-*    for a more complete description.
+*    for a more complete description.  Only the points added since the last
+*    simplification are checked.
 *
 *    The simplification and pruning algorithms run in the background and do not
 *    alter the path in memory.  Two definitions, SMARTRTL_SIMPLIFY_TIME_US and
@@ -112,16 +119,19 @@ void AP_SmartRTL::init()
     _prune.loops_max = _points_max * SMARTRTL_PRUNING_LOOP_BUFFER_LEN_MULT;
     _prune.loops = (prune_loop_t*)calloc(_prune.loops_max, sizeof(prune_loop_t));
 
-    _simplify.stack_max = _points_max * SMARTRTL_SIMPLIFY_STACK_LEN_MULT;
-    _simplify.stack = (simplify_start_finish_t*)calloc(_simplify.stack_max, sizeof(simplify_start_finish_t));
+    // blocks and groups of the pruning index are held in one array
+    const uint16_t num_blocks = (_points_max + SMARTRTL_PRUNING_INDEX_BLOCK - 1) / SMARTRTL_PRUNING_INDEX_BLOCK;
+    const uint16_t num_groups = (num_blocks + SMARTRTL_PRUNING_INDEX_BLOCK - 1) / SMARTRTL_PRUNING_INDEX_BLOCK;
+    _prune.blocks = (prune_bbox_t*)calloc(num_blocks + num_groups, sizeof(prune_bbox_t));
+    _prune.groups = (_prune.blocks != nullptr) ? &_prune.blocks[num_blocks] : nullptr;
 
     // check if memory allocation failed
-    if (_path == nullptr || _prune.loops == nullptr || _simplify.stack == nullptr) {
+    if (_path == nullptr || _prune.loops == nullptr || _prune.blocks == nullptr) {
         log_action(SRTL_DEACTIVATED_INIT_FAILED);
         GCS_SEND_TEXT(MAV_SEVERITY_WARNING, "SmartRTL deactivated: init failed");
         free(_path);
         free(_prune.loops);
-        free(_simplify.stack);
+        free(_prune.blocks);
         return;
     }
 
@@ -500,27 +510,31 @@ void AP_SmartRTL::detect_simplifications()
     }
 
     // if not complete but also nothing to do, we must be restarting
-    if (_simplify.stack_count == 0) {
-        // reset to beginning state. add a single element in the array with:
+    if (_simplify.finish == 0) {
+        // reset to beginning state. the to-do list is a single section from:
         //   start = first path point OR the index of the last already-simplified point
         //   finish = final path point
-        _simplify.stack[0].start = (_simplify.path_points_completed > 0) ? _simplify.path_points_completed - 1 : 0;
-        _simplify.stack[0].finish = _simplify.path_points_count-1;
-        _simplify.stack_count++;
+        _simplify.first = (_simplify.path_points_completed > 0) ? _simplify.path_points_completed - 1 : 0;
+        _simplify.finish = _simplify.path_points_count-1;
+        _simplify.ends.clearall();
+        _simplify.ends.set(_simplify.first);
+        _simplify.ends.set(_simplify.finish);
     }
 
     const uint32_t start_time_us = AP_HAL::micros();
-    while (_simplify.stack_count > 0) { // while there is something to do
+    while (_simplify.finish > _simplify.first) { // while there is something to do
 
         // if this method has run for long enough, exit
         if (AP_HAL::micros() - start_time_us > SMARTRTL_SIMPLIFY_TIME_US) {
             return;
         }
 
-        // pop last item off the simplify stack
-        const simplify_start_finish_t tmp = _simplify.stack[--_simplify.stack_count];
-        const uint16_t start_index = tmp.start;
-        const uint16_t end_index = tmp.finish;
+        // take the last section off the to-do list. it starts at the previous marked point
+        const uint16_t end_index = _simplify.finish;
+        uint16_t start_index = end_index - 1;
+        while (!_simplify.ends.get(start_index)) {
+            start_index--;
+        }
 
         // find the point between start and end points that is farthest from the start-end line segment
         float max_dist = 0.0f;
@@ -536,22 +550,18 @@ void AP_SmartRTL::detect_simplifications()
             }
         }
 
-        // if the farthest point is more than ACCURACY * 0.5 add two new elements to the _simplification_stack
-        // so that on the next iteration we will check between start-to-farthestpoint and farthestpoint-to-end
+        // if the farthest point is more than ACCURACY * 0.5 split the section at the farthest point
+        // so that on the next iterations we will check between farthestpoint-to-end and start-to-farthestpoint
         if (max_dist > SMARTRTL_SIMPLIFY_EPSILON) {
-            // if the to-do list is full, give up on simplifying. This should never happen.
-            if (_simplify.stack_count >= _simplify.stack_max) {
-                _simplify.complete = true;
-                return;
-            }
-            _simplify.stack[_simplify.stack_count++] = simplify_start_finish_t {start_index, farthest_point_index};
-            _simplify.stack[_simplify.stack_count++] = simplify_start_finish_t {farthest_point_index, end_index};
+            _simplify.ends.set(farthest_point_index);
         } else {
             // if the farthest point was closer than ACCURACY * 0.5 we can simplify all points between start and end
             for (uint16_t i = start_index + 1; i < end_index; i++) {
                 _simplify.bitmask.clear(i);
                 _simplify.removal_required = true;
             }
+            _simplify.ends.clear(end_index);
+            _simplify.finish = start_index;
         }
     }
     _simplify.path_points_completed = _simplify.path_points_count;
@@ -576,14 +586,19 @@ void AP_SmartRTL::detect_loops()
     // capture start time
     const uint32_t start_time_us = AP_HAL::micros();
 
+    // make sure all segments are in the index before using it
+    if (!update_prune_index(start_time_us)) {
+        return;
+    }
+
     // run for defined amount of time
     while (AP_HAL::micros() - start_time_us < SMARTRTL_PRUNING_LOOP_TIME_US) {
 
-        // advance inner loop
-        _prune.j++;
+        // advance inner loop, skipping segments that are too far away
+        _prune.j = next_prune_candidate(_prune.i, _prune.j + 1);
         if (_prune.j > _prune.i - 2) {
             // set inner loop back to first point
-            _prune.j = 1;
+            _prune.j = 0;
             // reduce outer loop
             _prune.i--;
             // complete when outer loop has run out of new points to check
@@ -592,6 +607,7 @@ void AP_SmartRTL::detect_loops()
                 _prune.path_points_completed = _prune.path_points_count;
                 return;
             }
+            continue;
         }
 
         // find the closest distance between two line segments and the mid-point
@@ -608,6 +624,83 @@ void AP_SmartRTL::detect_loops()
     }
 }
 
+// extend the pruning index so that it covers all the points being checked for loops
+// returns false if it ran out of time before completing
+bool AP_SmartRTL::update_prune_index(uint32_t start_time_us)
+{
+    while (_prune.index_count < _prune.path_points_count) {
+        if (AP_HAL::micros() - start_time_us > SMARTRTL_PRUNING_LOOP_TIME_US) {
+            return false;
+        }
+
+        // the block holds the segments ending at its points, so also includes the point before it
+        const uint16_t block = _prune.index_count / SMARTRTL_PRUNING_INDEX_BLOCK;
+        const uint16_t first = block * SMARTRTL_PRUNING_INDEX_BLOCK;
+        const uint16_t last = MIN(first + SMARTRTL_PRUNING_INDEX_BLOCK, _prune.path_points_count) - 1;
+        prune_bbox_t &box = _prune.blocks[block];
+        box.min = box.max = _path[(first > 0) ? first - 1 : 0];
+        for (uint16_t i = first; i <= last; i++) {
+            const Vector3f &p = _path[i];
+            box.min.x = MIN(box.min.x, p.x);
+            box.min.y = MIN(box.min.y, p.y);
+            box.min.z = MIN(box.min.z, p.z);
+            box.max.x = MAX(box.max.x, p.x);
+            box.max.y = MAX(box.max.y, p.y);
+            box.max.z = MAX(box.max.z, p.z);
+        }
+
+        // add the block to its group
+        prune_bbox_t &group = _prune.groups[block / SMARTRTL_PRUNING_INDEX_BLOCK];
+        if (block % SMARTRTL_PRUNING_INDEX_BLOCK == 0) {
+            group = box;
+        } else {
+            group.min.x = MIN(group.min.x, box.min.x);
+            group.min.y = MIN(group.min.y, box.min.y);
+            group.min.z = MIN(group.min.z, box.min.z);
+            group.max.x = MAX(group.max.x, box.max.x);
+            group.max.y = MAX(group.max.y, box.max.y);
+            group.max.z = MAX(group.max.z, box.max.z);
+        }
+
+        _prune.index_count = last + 1;
+    }
+    return true;
+}
+
+// returns the first segment, from j onwards, that might be close enough to segment i to form a loop
+// segments are identified by the index of the point they end at
+uint16_t AP_SmartRTL::next_prune_candidate(uint16_t i, uint16_t j) const
+{
+    // box around segment i, grown by the accuracy which is slightly more than the pruning distance
+    // so that rounding errors in segment_segment_dist cannot hide a loop
+    const Vector3f &p1 = _path[i];
+    const Vector3f &p2 = _path[i-1];
+    const float margin = _accuracy;
+    const Vector3f lo {MIN(p1.x, p2.x) - margin, MIN(p1.y, p2.y) - margin, MIN(p1.z, p2.z) - margin};
+    const Vector3f hi {MAX(p1.x, p2.x) + margin, MAX(p1.y, p2.y) + margin, MAX(p1.z, p2.z) + margin};
+    auto outside = [&lo, &hi](const prune_bbox_t &box) {
+        return box.min.x > hi.x || box.max.x < lo.x ||
+               box.min.y > hi.y || box.max.y < lo.y ||
+               box.min.z > hi.z || box.max.z < lo.z;
+    };
+
+    const uint16_t group_size = SMARTRTL_PRUNING_INDEX_BLOCK * SMARTRTL_PRUNING_INDEX_BLOCK;
+    while (j + 2 <= i && j < _prune.index_count) {
+        const uint16_t group = j / group_size;
+        if (outside(_prune.groups[group])) {
+            j = (group + 1) * group_size;
+            continue;
+        }
+        const uint16_t block = j / SMARTRTL_PRUNING_INDEX_BLOCK;
+        if (outside(_prune.blocks[block])) {
+            j = (block + 1) * SMARTRTL_PRUNING_INDEX_BLOCK;
+            continue;
+        }
+        break;
+    }
+    return j;
+}
+
 // restart simplify if new points have been added to path
 // path_points_count is _path_points_count but passed in to avoid having to take the semaphore
 void AP_SmartRTL::restart_simplify_if_new_points(uint16_t path_points_count)
@@ -633,7 +726,7 @@ void AP_SmartRTL::restart_simplification(uint16_t path_points_count)
     _simplify.complete = false;
     _simplify.removal_required = false;
     _simplify.bitmask.setall();
-    _simplify.stack_count = 0;
+    _simplify.finish = 0;
     _simplify.path_points_count = path_points_count;
 }
 
@@ -651,6 +744,11 @@ void AP_SmartRTL::restart_pruning(uint16_t path_points_count)
     _prune.i = (path_points_count > 0) ? path_points_count - 1 : 0;
     _prune.j = 0;
     _prune.path_points_count = path_points_count;
+
+    // points are only added to the end of the path, so only the last block
+    // of the pruning index needs to be rebuilt
+    const uint16_t index_count = MIN(_prune.index_count, path_points_count);
+    _prune.index_count = index_count - (index_count % SMARTRTL_PRUNING_INDEX_BLOCK);
 }
 
 // reset pruning algorithm so that it will re-check all points in the path
@@ -680,6 +778,11 @@ void AP_SmartRTL::remove_points_by_simplify_bitmask()
         }
     }
 
+    // the pruning index no longer matches the path
+    if (removed > 0) {
+        _prune.index_count = 0;
+    }
+
     // reduce count of the number of points simplified
     if (_path_points_count > removed && _simplify.path_points_count > removed) {
         _path_points_count -= removed;
@@ -731,6 +834,8 @@ bool AP_SmartRTL::remove_points_by_loops(uint16_t num_points_to_remove)
         if (_path_points_count > loop_num_points_to_remove) {
             _path_points_count -= loop_num_points_to_remove;
             removed_points += loop_num_points_to_remove;
+            // the pruning index no longer matches the path
+            _prune.index_count = 0;
         } else {
             // this is an error that should never happen so deactivate
             deactivate(SRTL_DEACTIVATED_PROGRAM_ERROR, "program error");
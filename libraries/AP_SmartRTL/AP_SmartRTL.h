@@ -8,19 +8,23 @@
 // definitions and macros
 #define SMARTRTL_ACCURACY_DEFAULT        2.0f   // default _ACCURACY parameter value.  Points will be no closer than this distance (in meters) together.
 #define SMARTRTL_POINTS_DEFAULT          300    // default _POINTS parameter value.  High numbers improve path pruning but use more memory and CPU for cleanup. Memory used will be 20bytes * this number.
-#define SMARTRTL_POINTS_MAX              500    // the absolute maximum number of points this library can support.
+#ifndef SMARTRTL_POINTS_MAX
+#if HAL_MEM_CLASS >= HAL_MEM_CLASS_500
+#define SMARTRTL_POINTS_MAX              5000   // the absolute maximum number of points this library can support.
+#else
+#define SMARTRTL_POINTS_MAX              500
+#endif
+#endif
 #define SMARTRTL_TIMEOUT                 15000  // the time in milliseconds with no points saved to the path (for whatever reason), before SmartRTL is disabled for the flight
 #define SMARTRTL_CLEANUP_POINT_TRIGGER   50     // simplification will trigger when this many points are added to the path
 #define SMARTRTL_CLEANUP_START_MARGIN    10     // routine cleanup algorithms begin when the path array has only this many empty slots remaining
 #define SMARTRTL_CLEANUP_POINT_MIN       10     // cleanup algorithms will remove points if they remove at least this many points
 #define SMARTRTL_SIMPLIFY_EPSILON (_accuracy * 0.5f)
-#define SMARTRTL_SIMPLIFY_STACK_LEN_MULT (2.0f/3.0f)+1  // simplify buffer size as compared to maximum number of points.
-                                                // The minimum is int((s/2-1)+min(s/2, SMARTRTL_POINTS_MAX-s)), where s = pow(2, floor(log(SMARTRTL_POINTS_MAX)/log(2)))
-                                                // To avoid this annoying math, a good-enough overestimate is ceil(SMARTRTL_POINTS_MAX*2.0f/3.0f)
 #define SMARTRTL_SIMPLIFY_TIME_US        200    // maximum time (in microseconds) the simplification algorithm will run before returning
 #define SMARTRTL_PRUNING_DELTA (_accuracy * 0.99)   // How many meters apart must two points be, such that we can assume that there is no obstacle between them.  must be smaller than _ACCURACY parameter
 #define SMARTRTL_PRUNING_LOOP_BUFFER_LEN_MULT 0.25f // pruning loop buffer size as compared to maximum number of points
 #define SMARTRTL_PRUNING_LOOP_TIME_US    200    // maximum time (in microseconds) that the loop finding algorithm will run before returning
+#define SMARTRTL_PRUNING_INDEX_BLOCK     16     // number of path segments in each bounding box of the pruning index, and number of boxes in each group
 
 class AP_SmartRTL {
 
@@ -131,6 +135,14 @@ private:
     // restart pruning if new points have been simplified
     void restart_pruning_if_new_points();
 
+    // extend the pruning index so that it covers all the points being checked for loops
+    // returns false if it ran out of time before completing
+    bool update_prune_index(uint32_t start_time_us);
+
+    // returns the first segment, from j onwards, that might be close enough to segment i to form a loop
+    // segments are identified by the index of the point they end at
+    uint16_t next_prune_candidate(uint16_t i, uint16_t j) const;
+
     // restart simplify algorithm so that detect_simplify will check all new points that have been added
     // to the path since it last completed.
     // path_points_count is _path_points_count but passed in to avoid having to take the semaphore
@@ -204,19 +216,16 @@ private:
     HAL_Semaphore _path_sem;   // semaphore for updating path
 
     // Simplify
-    // structure and buffer to hold the "to-do list" for the simplify algorithm.
-    typedef struct {
-        uint16_t start;
-        uint16_t finish;
-    } simplify_start_finish_t;
+    // the "to-do list" for the simplify algorithm is a run of adjacent sections of the path. The points
+    // that separate the sections are marked in a bitmask, so no stack is needed however deep the algorithm goes
     struct {
         bool complete;          // true after simplify_detection has completed
         bool removal_required;  // true if some simplify-able points have been found on the path, set true by detect_simplifications, set false by remove_points_by_simplify_bitmask
         uint16_t path_points_count; // copy of _path_points_count taken when the simply algorithm started
         uint16_t path_points_completed = SMARTRTL_POINTS_MAX; // number of points in that path that have already been simplified and should be ignored
-        simplify_start_finish_t* stack;
-        uint16_t stack_max;     // maximum number of elements in the _simplify_stack array
-        uint16_t stack_count;   // number of elements in _simplify_stack array
+        uint16_t first;         // first point of the first section on the to-do list
+        uint16_t finish;        // last point of the last section on the to-do list, zero if the to-do list has not been started
+        Bitmask<SMARTRTL_POINTS_MAX> ends;     // points that start or finish a section on the to-do list
         Bitmask<SMARTRTL_POINTS_MAX> bitmask;  // simplify algorithm clears bits for each point that can be removed
     } _simplify;
 
@@ -227,6 +236,10 @@ private:
         Vector3f midpoint;      // midpoint which should replace the first point when the loop is removed
         float length_squared;   // length squared (in meters) of the loop (used so we can remove the longest loops)
     } prune_loop_t;
+    typedef struct {
+        Vector3f min;           // corners of a box holding a run of path segments
+        Vector3f max;
+    } prune_bbox_t;
     struct {
         bool complete;
         uint16_t path_points_count;  // copy of _path_points_count taken when the prune algorithm started
@@ -236,6 +249,9 @@ private:
         prune_loop_t* loops;// the result of the pruning algorithm
         uint16_t loops_max; // maximum number of elements in the _prunable_loops array
         uint16_t loops_count;   // number of elements in the _prunable_loops array
+        prune_bbox_t* blocks;   // bounding box of each block of SMARTRTL_PRUNING_INDEX_BLOCK segments, used to skip segments too far away to form a loop
+        prune_bbox_t* groups;   // bounding box of each group of SMARTRTL_PRUNING_INDEX_BLOCK blocks
+        uint16_t index_count;   // number of path points whose segments are covered by the blocks and groups
     } _prune;
 
     // returns true if the two loops overlap (used within add_loop to determine which loops to keep or throw away)
@@ -818,21 +818,25 @@ void AP_Vehicle::update_dynamic_notch(AP_InertialSensor::HarmonicNotch &notch)
         }
 #endif  // AP_RPM_ENABLED
 #if HAL_WITH_ESC_TELEM
-        case HarmonicNotchDynamicMode::UpdateBLHeli: // BLHeli based tracking
+        case HarmonicNotchDynamicMode::UpdateBLHeli: { // BLHeli based tracking
+            // take all of the ESC rpms in one go so they are consistent
+            AP_ESC_Telem::RpmSnapshot esc_rpm;
+            AP::esc_telem().get_rpm_snapshot(esc_rpm);
             // set the harmonic notch filter frequency scaled on measured frequency
             if (notch.params.hasOption(HarmonicNotchFilterParams::Options::DynamicHarmonic)) {
                 float notches[INS_MAX_NOTCHES];
                 // ESC telemetry will return 0 for missing data, but only after 1s
-                const uint8_t num_notches = AP::esc_telem().get_motor_frequencies_hz(INS_MAX_NOTCHES, notches);
+                const uint8_t num_notches = esc_rpm.get_motor_frequencies_hz(INS_MAX_NOTCHES, notches);
                 if (num_notches > 0) {
                     notch.update_frequencies_hz(num_notches, notches);
                 } else {    // throttle fallback
                     update_throttle_notch(notch);
                 }
             } else {
-                notch.update_freq_hz(AP::esc_telem().get_average_motor_frequency_hz() * ref);
+                notch.update_freq_hz(esc_rpm.get_average_motor_rpm(0xFFFFFFFF) * (1.0f / 60.0f) * ref);
             }
             break;
+        }
 #endif
 #if HAL_GYROFFT_ENABLED
         case HarmonicNotchDynamicMode::UpdateGyroFFT: // FFT based tracking
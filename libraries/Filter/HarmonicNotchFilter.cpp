@@ -251,7 +251,7 @@ void HarmonicNotchFilter<T>::expand_filter_count(uint16_t total_notches)
   frequency for this harmonic
  */
 template <class T>
-void HarmonicNotchFilter<T>::set_center_frequency(uint16_t idx, float notch_center, float spread_mul, uint8_t harmonic_mul)
+void HarmonicNotchFilter<T>::set_center_frequency(uint16_t idx, float notch_center, float spread_mul, uint8_t harmonic_mul, const HarmonicNotchFilter<T> *share)
 {
     const float nyquist_limit = _sample_freq_hz * HARMONIC_NYQUIST_CUTOFF;
     auto &notch = _filters[idx];
@@ -319,7 +319,11 @@ void HarmonicNotchFilter<T>::set_center_frequency(uint16_t idx, float notch_cent
     */
     notch_center *= spread_mul;
 
-    notch.init_with_A_and_Q(_sample_freq_hz, notch_center, A, _Q);
+    const NotchFilter<T> *share_notch = nullptr;
+    if (share != nullptr && idx < share->_num_filters) {
+        share_notch = &share->_filters[idx];
+    }
+    notch.init_with_A_and_Q(_sample_freq_hz, notch_center, A, _Q, share_notch);
 }
 
 /*
@@ -327,9 +331,9 @@ void HarmonicNotchFilter<T>::set_center_frequency(uint16_t idx, float notch_cent
   this function is cheaper than init() because A & Q do not need to be recalculated
  */
 template <class T>
-void HarmonicNotchFilter<T>::update(float center_freq_hz)
+void HarmonicNotchFilter<T>::update(float center_freq_hz, const HarmonicNotchFilter<T> *share)
 {
-    update(1, &center_freq_hz);
+    update(1, &center_freq_hz, share);
 }
 
 /*
@@ -337,12 +341,17 @@ void HarmonicNotchFilter<T>::update(float center_freq_hz)
   this function is cheaper than init() because A & Q do not need to be recalculated
  */
 template <class T>
-void HarmonicNotchFilter<T>::update(uint8_t num_centers, const float center_freq_hz[])
+void HarmonicNotchFilter<T>::update(uint8_t num_centers, const float center_freq_hz[], const HarmonicNotchFilter<T> *share)
 {
     if (!_initialised) {
         return;
     }
 
+    // coefficients can only be shared with a filter that has the same quality factor
+    if (share == this || share == nullptr || !share->_initialised || !is_equal(share->_Q, _Q)) {
+        share = nullptr;
+    }
+
     // adjust the frequencies to be in the allowable range
     const float nyquist_limit = _sample_freq_hz * HARMONIC_NYQUIST_CUTOFF;
 
@@ -367,11 +376,11 @@ void HarmonicNotchFilter<T>::update(uint8_t num_centers, const float center_freq
         const float notch_center = constrain_float(center_freq_hz[center_n], 0.0f, nyquist_limit);
         const uint8_t harmonic_mul = (harmonic_n+1);
         if (_composite_notches != 2) {
-            set_center_frequency(_num_enabled_filters++, notch_center, 1.0, harmonic_mul);
+            set_center_frequency(_num_enabled_filters++, notch_center, 1.0, harmonic_mul, share);
         }
         if (_composite_notches > 1) {
-            set_center_frequency(_num_enabled_filters++, notch_center, 1.0 - _notch_spread, harmonic_mul);
-            set_center_frequency(_num_enabled_filters++, notch_center, 1.0 + _notch_spread, harmonic_mul);
+            set_center_frequency(_num_enabled_filters++, notch_center, 1.0 - _notch_spread, harmonic_mul, share);
+            set_center_frequency(_num_enabled_filters++, notch_center, 1.0 + _notch_spread, harmonic_mul, share);
         }
     }
 }
@@ -38,16 +38,18 @@ public:
     // initialize the underlying filters using the provided filter parameters
     void init(float sample_freq_hz, HarmonicNotchFilterParams &params);
     // update the underlying filters' center frequencies using center_freq_hz as the fundamental
-    void update(float center_freq_hz);
+    // share is an optional filter with the same setup that notches with the same design take their coefficients from
+    void update(float center_freq_hz, const HarmonicNotchFilter<T> *share = nullptr);
     // update all of the underlying center frequencies individually
-    void update(uint8_t num_centers, const float center_freq_hz[]);
+    void update(uint8_t num_centers, const float center_freq_hz[], const HarmonicNotchFilter<T> *share = nullptr);
 
     /*
       set center frequency of one notch.
       spread_mul is a scale factor for spreading of double or triple notch
       harmonic_mul is the multiplier for harmonics, 1 is for the fundamental
+      share is an optional filter to take coefficients from if its notch idx has the same design
     */
-    void set_center_frequency(uint16_t idx, float center_freq_hz, float spread_mul, uint8_t harmonic_mul);
+    void set_center_frequency(uint16_t idx, float center_freq_hz, float spread_mul, uint8_t harmonic_mul, const HarmonicNotchFilter<T> *share = nullptr);
 
     // apply a sample to each of the underlying filters in turn
     T apply(const T &sample);
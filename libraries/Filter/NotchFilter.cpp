@@ -24,6 +24,9 @@ const static float NOTCH_MAX_SLEW       = 0.05f;
 const static float NOTCH_MAX_SLEW_LOWER = 1.0f - NOTCH_MAX_SLEW;
 const static float NOTCH_MAX_SLEW_UPPER = 1.0f / NOTCH_MAX_SLEW_LOWER;
 
+// changes of center frequency smaller than this fraction don't recalculate the coefficients
+const static float NOTCH_MIN_FREQ_CHANGE = 0.001f;
+
 /*
    calculate the attenuation and quality factors of the filter
  */
@@ -56,11 +59,13 @@ void NotchFilter<T>::init(float sample_freq_hz, float center_freq_hz, float band
 }
 
 template <class T>
-void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_hz, float A, float Q)
+void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_hz, float A, float Q, const NotchFilter<T> *share)
 {
-    // don't update if no updates required
+    // don't update if no updates required. Dynamic notches are
+    // updated every loop, so small changes in frequency are ignored
+    // rather than recalculating the coefficients each time
     if (initialised &&
-        is_equal(center_freq_hz, _center_freq_hz) &&
+        fabsf(center_freq_hz - _center_freq_hz) <= _center_freq_hz * NOTCH_MIN_FREQ_CHANGE &&
         is_equal(sample_freq_hz, _sample_freq_hz) &&
         is_equal(A, _A)) {
         return;
@@ -74,7 +79,23 @@ void NotchFilter<T>::init_with_A_and_Q(float sample_freq_hz, float center_freq_h
                                           _center_freq_hz * NOTCH_MAX_SLEW_UPPER);
     }
 
-    if (is_positive(new_center_freq) && (new_center_freq < 0.5 * sample_freq_hz) && (Q > 0.0)) {
+    if (is_positive(new_center_freq) && (new_center_freq < 0.5 * sample_freq_hz) && (Q > 0.0) &&
+        share != nullptr && share->initialised &&
+        is_equal(new_center_freq, share->_center_freq_hz) &&
+        is_equal(sample_freq_hz, share->_sample_freq_hz) &&
+        is_equal(A, share->_A)) {
+        // the same design as a filter that has already been calculated
+        b0 = share->b0;
+        b1 = share->b1;
+        b2 = share->b2;
+        a1 = share->a1;
+        a2 = share->a2;
+
+        _center_freq_hz = new_center_freq;
+        _sample_freq_hz = sample_freq_hz;
+        _A = A;
+        initialised = true;
+    } else if (is_positive(new_center_freq) && (new_center_freq < 0.5 * sample_freq_hz) && (Q > 0.0)) {
         float omega = 2.0 * M_PI * new_center_freq / sample_freq_hz;
         float alpha = sinf(omega) / (2 * Q);
         b0 =  1.0 + alpha*sq(A);
@@ -35,7 +35,8 @@ public:
     friend class HarmonicNotchFilter<T>;
     // set parameters
     void init(float sample_freq_hz, float center_freq_hz, float bandwidth_hz, float attenuation_dB);
-    void init_with_A_and_Q(float sample_freq_hz, float center_freq_hz, float A, float Q);
+    // share is an optional filter with the same Q whose coefficients are copied if it has the same design
+    void init_with_A_and_Q(float sample_freq_hz, float center_freq_hz, float A, float Q, const NotchFilter<T> *share = nullptr);
     T apply(const T &sample);
     void reset();
     float center_freq_hz() const { return _center_freq_hz; }
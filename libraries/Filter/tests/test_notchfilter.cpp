@@ -325,4 +325,46 @@ TEST(NotchFilterTest, HarmonicNotchTest4)
     fclose(f);
 }
 
+/*
+  check that a filter sharing coefficients with another gives the
+  same output as one that calculates them itself
+ */
+TEST(NotchFilterTest, HarmonicNotchShareTest)
+{
+    const uint16_t rate_hz = 2000;
+    const uint32_t samples = 5000;
+    const uint8_t num_motors = 4;
+
+    HarmonicNotchFilterParams notch_params {};
+    notch_params.set_options(uint16_t(HarmonicNotchFilterParams::Options::TripleNotch));
+    notch_params.set_attenuation(30);
+    notch_params.set_bandwidth_hz(25);
+    notch_params.set_center_freq_hz(50);
+    notch_params.set_freq_min_ratio(1.0);
+
+    HarmonicNotchFilter<float> filters[3] {};
+    for (auto &f : filters) {
+        f.allocate_filters(num_motors, 7, notch_params.num_composite_notches());
+        f.init(rate_hz, notch_params);
+    }
+
+    for (uint32_t s=0; s<samples; s++) {
+        // motor frequencies moving at different rates
+        float freqs[num_motors];
+        for (uint8_t m=0; m<num_motors; m++) {
+            freqs[m] = 80 + 30 * sinf(s * (m+1) * 0.001);
+        }
+        filters[0].update(num_motors, freqs);
+        filters[1].update(num_motors, freqs, &filters[0]);
+        filters[2].update(num_motors, freqs);
+
+        const float sample = sinf(s * 0.3) + 0.5 * sinf(s * 0.17);
+        const float v0 = filters[0].apply(sample);
+        const float v1 = filters[1].apply(sample);
+        const float v2 = filters[2].apply(sample);
+        EXPECT_EQ(v0, v2);
+        EXPECT_EQ(v1, v2);
+    }
+}
+
 AP_GTEST_MAIN()
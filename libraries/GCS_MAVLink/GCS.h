@@ -1010,6 +1010,12 @@ private:
         int16_t current_session;
         uint32_t last_send_ms;
         uint8_t need_banner_send_mask;
+#if AP_MAVLINK_FTP_READ_AHEAD_SIZE > 0
+        // file data read ahead for burst reads
+        uint8_t *read_ahead;
+        uint32_t read_ahead_offset; // file offset of the start of read_ahead
+        uint16_t read_ahead_len;    // number of bytes in read_ahead, 0 when it is not valid
+#endif
     };
     static struct ftp_state ftp;
 
@@ -1022,6 +1028,7 @@ private:
     bool send_ftp_reply(const pending_ftp &reply);
     void ftp_worker(void);
     void ftp_push_replies(pending_ftp &reply);
+    static ssize_t ftp_burst_read(uint32_t offset, uint8_t *data, uint16_t len);
 #endif  // AP_MAVLINK_FTP_ENABLED
 
     void send_distance_sensor(const class AP_RangeFinder_Backend *sensor, const uint8_t instance) const;
@@ -167,6 +167,42 @@ void GCS_MAVLINK::ftp_push_replies(pending_ftp &reply)
     }
 }
 
+/*
+  read file data for a burst read at offset. Where there is memory for it the
+  file is read in large blocks, which is much faster than a read for
+  each packet, and packets are copied from the block
+ */
+ssize_t GCS_MAVLINK::ftp_burst_read(uint32_t offset, uint8_t *data, uint16_t len)
+{
+#if AP_MAVLINK_FTP_READ_AHEAD_SIZE > 0
+    if (ftp.read_ahead == nullptr) {
+        ftp.read_ahead = new uint8_t[AP_MAVLINK_FTP_READ_AHEAD_SIZE];
+    }
+    if (ftp.read_ahead != nullptr) {
+        if (ftp.read_ahead_len == 0 ||
+            offset < ftp.read_ahead_offset ||
+            offset + len > ftp.read_ahead_offset + ftp.read_ahead_len) {
+            // refill starting at the offset wanted
+            ftp.read_ahead_len = 0;
+            if (AP::FS().lseek(ftp.fd, offset, SEEK_SET) == -1) {
+                return -1;
+            }
+            const ssize_t read_bytes = AP::FS().read(ftp.fd, ftp.read_ahead, AP_MAVLINK_FTP_READ_AHEAD_SIZE);
+            if (read_bytes == -1) {
+                return -1;
+            }
+            ftp.read_ahead_offset = offset;
+            ftp.read_ahead_len = read_bytes;
+        }
+        const uint16_t n = MIN(uint32_t(len), ftp.read_ahead_offset + ftp.read_ahead_len - offset);
+        memcpy(data, &ftp.read_ahead[offset - ftp.read_ahead_offset], n);
+        return n;
+    }
+#endif
+    // the caller has seeked to the start of the burst, and reads are sequential from there
+    return AP::FS().read(ftp.fd, data, len);
+}
+
 void GCS_MAVLINK::ftp_worker(void) {
     pending_ftp request;
     pending_ftp reply = {};
@@ -205,6 +241,14 @@ void GCS_MAVLINK::ftp_worker(void) {
 
         uint32_t now = AP_HAL::millis();
 
+#if AP_MAVLINK_FTP_READ_AHEAD_SIZE > 0
+        // any other operation may change the file, so only keep data
+        // read ahead between burst reads
+        if (request.opcode != FTP_OP::BurstReadFile) {
+            ftp.read_ahead_len = 0;
+        }
+#endif
+
         // check for session termination
         if (request.session != ftp.current_session &&
             (request.opcode == FTP_OP::TerminateSession || request.opcode == FTP_OP::ResetSessions)) {
@@ -493,21 +537,31 @@ void GCS_MAVLINK::ftp_worker(void) {
                           lost packets a lot, which results in overall
                           faster transfers
                          */
-                        uint32_t burst_delay_ms = 0;
+                        uint32_t burst_delay_us = 0;
                         if (valid_channel(request.chan)) {
                             auto *port = mavlink_comm_port[request.chan];
                             if (port != nullptr && port->get_flow_control() != AP_HAL::UARTDriver::FLOW_CONTROL_ENABLE) {
                                 const uint32_t bw = port->bw_in_bytes_per_second();
                                 const uint16_t pkt_size = PAYLOAD_SIZE(request.chan, FILE_TRANSFER_PROTOCOL) - (sizeof(reply.data) - max_read);
-                                burst_delay_ms = 3000 * pkt_size / bw;
+                                burst_delay_us = 3000000ULL * pkt_size / bw;
                             }
                         }
 
+                        /*
+                          pace the packets against the time the burst
+                          started rather than sleeping a whole number
+                          of milliseconds after each one, so time
+                          spent reading and sending counts towards the
+                          delay and fast links aren't held back by
+                          rounding
+                         */
+                        uint32_t next_send_us = AP_HAL::micros();
+
                         // this transfer size is enough for a full parameter file with max parameters
                         const uint32_t transfer_size = 500;
                         for (uint32_t i = 0; (i < transfer_size); i++) {
                             // fill the buffer
-                            const ssize_t read_bytes = AP::FS().read(ftp.fd, reply.data, MIN(sizeof(reply.data), max_read));
+                            const ssize_t read_bytes = ftp_burst_read(request.offset + i * max_read, reply.data, MIN(sizeof(reply.data), max_read));
                             if (read_bytes == -1) {
                                 ftp_error(reply, FTP_ERROR::FailErrno);
                                 break;
@@ -538,7 +592,15 @@ void GCS_MAVLINK::ftp_worker(void) {
                             // prep the reply to be used again
                             reply.seq_number++;
 
-                            hal.scheduler->delay(burst_delay_ms);
+                            next_send_us += burst_delay_us;
+                            const int32_t wait_us = int32_t(next_send_us - AP_HAL::micros());
+                            if (wait_us > 0) {
+                                hal.scheduler->delay(wait_us / 1000);
+                                hal.scheduler->delay_microseconds(wait_us % 1000);
+                            } else if (burst_delay_us != 0) {
+                                // don't build up a backlog to send flat out later
+                                next_send_us -= wait_us;
+                            }
                         }
 
                         if (reply.opcode != FTP_OP::Nack) {
@@ -88,6 +88,15 @@
 #define AP_MAVLINK_FTP_ENABLED HAL_GCS_ENABLED
 #endif
 
+// size of the buffer files are read into for FTP burst reads, 0 reads one packet at a time
+#ifndef AP_MAVLINK_FTP_READ_AHEAD_SIZE
+#if HAL_MEM_CLASS >= HAL_MEM_CLASS_1000
+#define AP_MAVLINK_FTP_READ_AHEAD_SIZE 8192
+#else
+#define AP_MAVLINK_FTP_READ_AHEAD_SIZE 0
+#endif
+#endif
+
 // GCS should be using MISSION_REQUEST_INT instead; this is a waste of
 // flash.  MISSION_REQUEST was deprecated in June 2020.  We started
 // sending warnings to the GCS in Sep 2022 if this command was used.
@@ -620,8 +620,11 @@ void Aircraft::update_model(const struct sitl_input &input)
 void Aircraft::update_dynamics(const Vector3f &rot_accel)
 {
     const float delta_time = frame_time_us * 1.0e-6f;
+    const bool trapezoidal = sitl != nullptr &&
+        sitl->integration_type == SIM::IntegrationType::TRAPEZOIDAL;
 
     // update rotational rates in body frame
+    const Vector3f gyro_prev = gyro;
     gyro += rot_accel * delta_time;
 
     gyro.x = constrain_float(gyro.x, -radians(2000.0f), radians(2000.0f));
@@ -629,7 +632,11 @@ void Aircraft::update_dynamics(const Vector3f &rot_accel)
     gyro.z = constrain_float(gyro.z, -radians(2000.0f), radians(2000.0f));
 
     // update attitude
-    dcm.rotate(gyro * delta_time);
+    if (trapezoidal) {
+        dcm.rotate((gyro_prev + gyro) * (0.5f * delta_time));
+    } else {
+        dcm.rotate(gyro * delta_time);
+    }
     dcm.normalize();
 
     Vector3f accel_earth = dcm * accel_body;
@@ -646,11 +653,16 @@ void Aircraft::update_dynamics(const Vector3f &rot_accel)
     accel_body = dcm.transposed() * (accel_earth + Vector3f(0.0f, 0.0f, -GRAVITY_MSS));
 
     // new velocity vector
+    const Vector3f velocity_prev = velocity_ef;
     velocity_ef += accel_earth * delta_time;
 
     const bool was_on_ground = on_ground();
     // new position vector
-    position += (velocity_ef * delta_time).todouble();
+    if (trapezoidal) {
+        position += ((velocity_prev + velocity_ef) * (0.5f * delta_time)).todouble();
+    } else {
+        position += (velocity_ef * delta_time).todouble();
+    }
 
     // velocity relative to air mass, in earth frame
     velocity_air_ef = velocity_ef - wind_ef;
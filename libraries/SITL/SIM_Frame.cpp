@@ -557,15 +557,21 @@ void Frame::calculate_forces(const Aircraft &aircraft,
 
     Vector3f vel_air_bf = aircraft.get_dcm().transposed() * aircraft.get_velocity_air_ef();
 
-    const auto *_sitl = AP::sitl();
+    // values shared by all motors for this step
+    const float sqrt_air_density = sqrtf(air_density);
+    const float voltage = battery->get_voltage();
+    const uint64_t now_us = AP_HAL::micros64();
+    const float vibe_motor = AP::sitl()->vibe_motor;
+
     for (uint8_t i=0; i<num_motors; i++) {
         Vector3f mtorque, mthrust;
-        motors[i].calculate_forces(input, motor_offset, mtorque, mthrust, vel_air_bf, gyro, air_density, battery->get_voltage(), use_drag);
+        motors[i].calculate_forces(input, motor_offset, mtorque, mthrust, vel_air_bf, gyro,
+                                   air_density, sqrt_air_density, voltage, use_drag, now_us);
         torque += mtorque;
         thrust += mthrust;
         // simulate motor rpm
-        if (!is_zero(_sitl->vibe_motor)) {
-            rpm[motor_offset+i] = motors[i].get_command() * AP::sitl()->vibe_motor * 60.0f;
+        if (!is_zero(vibe_motor)) {
+            rpm[motor_offset+i] = motors[i].get_command() * vibe_motor * 60.0f;
         }
     }
 
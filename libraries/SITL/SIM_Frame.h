@@ -29,6 +29,8 @@ namespace SITL {
  */
 class Frame {
 public:
+    friend class MotorBench;
+
     const char *name;
     uint8_t num_motors;
     Motor *motors;
@@ -32,10 +32,27 @@ void Motor::calculate_forces(const struct sitl_input &input,
                              float voltage,
                              bool use_drag)
 {
+    calculate_forces(input, motor_offset, torque, thrust, velocity_air_bf, gyro,
+                     air_density, sqrtf(air_density), voltage, use_drag, AP_HAL::micros64());
+}
+
+// calculate rotational accel and thrust for a motor using per-step values from the caller
+void Motor::calculate_forces(const struct sitl_input &input,
+                             uint8_t motor_offset,
+                             Vector3f &torque,
+                             Vector3f &thrust,
+                             const Vector3f &velocity_air_bf,
+                             const Vector3f &gyro,
+                             float air_density,
+                             float sqrt_air_density,
+                             float voltage,
+                             bool use_drag,
+                             uint64_t now_us)
+{
 
     const float pwm = input.servos[motor_offset+servo];
     float command = pwm_to_command(pwm);
-    float voltage_scale = voltage / voltage_max;
+    float voltage_scale = voltage * voltage_max_inv;
 
     if (voltage_scale < 0.1) {
         // battery is dead
@@ -46,7 +63,6 @@ void Motor::calculate_forces(const struct sitl_input &input,
     }
 
     // apply slew limiter to command
-    uint64_t now_us = AP_HAL::micros64();
     if (last_calc_us != 0 && slew_max > 0) {
         float dt = (now_us - last_calc_us)*1.0e-6;
         float slew_max_change = slew_max * dt;
@@ -68,55 +84,58 @@ void Motor::calculate_forces(const struct sitl_input &input,
     float motor_thrust = calc_thrust(command, air_density, velocity_in, voltage_scale);
 
     // the yaw torque of the motor
-    const float yaw_scale = 0.05 * diagonal_size * motor_thrust;
+    const float yaw_scale = yaw_scale_factor * motor_thrust;
     Vector3f rotor_torque = thrust_vector * yaw_factor * command * yaw_scale * -1.0;
 
     // thrust in bodyframe NED
     thrust = thrust_vector * motor_thrust;
 
-    // work out roll and pitch of motor relative to it pointing straight up
-    float roll = 0, pitch = 0;
-
-    uint64_t now = AP_HAL::micros64();
-    
-    // possibly roll and/or pitch the motor
-    if (roll_servo >= 0) {
-        uint16_t servoval = update_servo(input.servos[roll_servo+motor_offset], now, last_roll_value);
-        if (roll_min < roll_max) {
-            roll = constrain_float(roll_min + (servoval-1000)*0.001*(roll_max-roll_min), roll_min, roll_max);
-        } else {
-            roll = constrain_float(roll_max + (2000-servoval)*0.001*(roll_min-roll_max), roll_max, roll_min);
+    if (is_tiltable()) {
+        // work out roll and pitch of motor relative to it pointing straight up
+        float roll = 0, pitch = 0;
+
+        // possibly roll and/or pitch the motor
+        if (roll_servo >= 0) {
+            uint16_t servoval = update_servo(input.servos[roll_servo+motor_offset], now_us, last_roll_value);
+            if (roll_min < roll_max) {
+                roll = constrain_float(roll_min + (servoval-1000)*0.001*(roll_max-roll_min), roll_min, roll_max);
+            } else {
+                roll = constrain_float(roll_max + (2000-servoval)*0.001*(roll_min-roll_max), roll_max, roll_min);
+            }
         }
-    }
-    if (pitch_servo >= 0) {
-        uint16_t servoval = update_servo(input.servos[pitch_servo+motor_offset], now, last_pitch_value);
-        if (pitch_min < pitch_max) {
-            pitch = constrain_float(pitch_min + (servoval-1000)*0.001*(pitch_max-pitch_min), pitch_min, pitch_max);
-        } else {
-            pitch = constrain_float(pitch_max + (2000-servoval)*0.001*(pitch_min-pitch_max), pitch_max, pitch_min);
+        if (pitch_servo >= 0) {
+            uint16_t servoval = update_servo(input.servos[pitch_servo+motor_offset], now_us, last_pitch_value);
+            if (pitch_min < pitch_max) {
+                pitch = constrain_float(pitch_min + (servoval-1000)*0.001*(pitch_max-pitch_min), pitch_min, pitch_max);
+            } else {
+                pitch = constrain_float(pitch_max + (2000-servoval)*0.001*(pitch_min-pitch_max), pitch_max, pitch_min);
+            }
+        }
+
+        // possibly rotate the thrust vector and the rotor torque
+        if (!is_zero(roll) || !is_zero(pitch)) {
+            Matrix3f rotation;
+            rotation.from_euler(radians(roll), radians(pitch), 0);
+            thrust = rotation * thrust;
+            rotor_torque = rotation * rotor_torque;
         }
     }
-    last_change_usec = now;
-
-    // possibly rotate the thrust vector and the rotor torque
-    if (!is_zero(roll) || !is_zero(pitch)) {
-        Matrix3f rotation;
-        rotation.from_euler(radians(roll), radians(pitch), 0);
-        thrust = rotation * thrust;
-        rotor_torque = rotation * rotor_torque;
-    }
+    last_change_usec = now_us;
 
     if (use_drag) {
         // calculate momentum drag per motor
-        const float momentum_drag_factor = momentum_drag_coefficient * sqrtf(air_density * true_prop_area);
+        const float momentum_drag_factor = momentum_drag_area * sqrt_air_density;
+        const float sqrt_thrust_x = sqrtf(fabsf(thrust.x));
+        const float sqrt_thrust_y = sqrtf(fabsf(thrust.y));
+        const float sqrt_thrust_z = sqrtf(fabsf(thrust.z));
         Vector3f momentum_drag;
-        momentum_drag.x = momentum_drag_factor * motor_vel.x * (sqrtf(fabsf(thrust.y)) + sqrtf(fabsf(thrust.z)));
-        momentum_drag.y = momentum_drag_factor * motor_vel.y * (sqrtf(fabsf(thrust.x)) + sqrtf(fabsf(thrust.z)));
+        momentum_drag.x = momentum_drag_factor * motor_vel.x * (sqrt_thrust_y + sqrt_thrust_z);
+        momentum_drag.y = momentum_drag_factor * motor_vel.y * (sqrt_thrust_x + sqrt_thrust_z);
         // The application of momentum drag to the Z axis is a 'hack' to compensate for incorrect modelling
         // of the variation of thust with inflow velocity. If not applied, the vehicle will
         // climb at an unrealistic rate during operation in STABILIZE. TODO replace prop and motor model in
         // with one based on DC motor, momentum disc and blade element theory.
-        momentum_drag.z = momentum_drag_factor * motor_vel.z * (sqrtf(fabsf(thrust.x)) + sqrtf(fabsf(thrust.y)) + sqrtf(fabsf(thrust.z)));
+        momentum_drag.z = momentum_drag_factor * motor_vel.z * (sqrt_thrust_x + sqrt_thrust_y + sqrt_thrust_z);
 
         thrust -= momentum_drag;
     }
@@ -182,6 +201,14 @@ void Motor::setup_params(uint16_t _pwm_min, uint16_t _pwm_max, float _spin_min,
     momentum_drag_coefficient = _momentum_drag_coefficient;
     diagonal_size = _diagonal_size;
 
+    // precompute values which are constant between calls to calculate_forces()
+    pwm_thrust_min = mot_pwm_min + mot_spin_min * (mot_pwm_max - mot_pwm_min);
+    const float pwm_thrust_max = mot_pwm_min + mot_spin_max * (mot_pwm_max - mot_pwm_min);
+    pwm_thrust_range_inv = 1.0 / (pwm_thrust_max - pwm_thrust_min);
+    voltage_max_inv = 1.0 / voltage_max;
+    momentum_drag_area = momentum_drag_coefficient * sqrtf(true_prop_area);
+    yaw_scale_factor = 0.05 * diagonal_size;
+
     if (!_position.is_zero()) {
         position = _position;
     } else {
@@ -203,10 +230,7 @@ void Motor::setup_params(uint16_t _pwm_min, uint16_t _pwm_max, float _spin_min,
 */
 float Motor::pwm_to_command(float pwm) const
 {
-    const float pwm_thrust_max = mot_pwm_min + mot_spin_max * (mot_pwm_max - mot_pwm_min);
-    const float pwm_thrust_min = mot_pwm_min + mot_spin_min * (mot_pwm_max - mot_pwm_min);
-    const float pwm_thrust_range = pwm_thrust_max - pwm_thrust_min;
-    return constrain_float((pwm-pwm_thrust_min)/pwm_thrust_range, 0, 1);
+    return constrain_float((pwm-pwm_thrust_min)*pwm_thrust_range_inv, 0, 1);
 }
 
 /*
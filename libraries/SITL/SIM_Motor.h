@@ -28,6 +28,8 @@ namespace SITL {
  */
 class Motor {
 public:
+    friend class MotorBench;
+
     float angle;
     float yaw_factor;
     uint8_t servo;
@@ -96,6 +98,28 @@ public:
                           float voltage,
                           bool use_drag);
 
+    /*
+      calculate forces with the per-step values supplied by the
+      caller. This allows a frame to sample the time and the square
+      root of air density once for all of its motors
+     */
+    void calculate_forces(const struct sitl_input &input,
+                          uint8_t motor_offset,
+                          Vector3f &torque, // Newton meters
+                          Vector3f &thrust, // Z is down, Newtons
+                          const Vector3f &velocity_air_bf,
+                          const Vector3f &gyro, // rad/sec
+                          float air_density,
+                          float sqrt_air_density,
+                          float voltage,
+                          bool use_drag,
+                          uint64_t now_us);
+
+    // true if this motor can be tilted by a roll or pitch servo
+    bool is_tiltable(void) const {
+        return roll_servo >= 0 || pitch_servo >= 0;
+    }
+
     uint16_t update_servo(uint16_t demand, uint64_t time_usec, float &last_value) const;
 
     // get current
@@ -138,6 +162,13 @@ private:
     float momentum_drag_coefficient;
     float diagonal_size;
 
+    // values derived from the parameters in setup_params()
+    float pwm_thrust_min;
+    float pwm_thrust_range_inv;
+    float voltage_max_inv;
+    float momentum_drag_area;   // momentum_drag_coefficient * sqrt(true_prop_area)
+    float yaw_scale_factor;     // 0.05 * diagonal_size
+
     float last_command;
     uint64_t last_calc_us;
 
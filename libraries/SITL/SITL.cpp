@@ -432,6 +432,13 @@ const AP_Param::GroupInfo SIM::var_info3[] = {
     // @Description: Number of simulated IMUs to create
     AP_GROUPINFO("IMU_COUNT",    23, SIM,  imu_count,  2),
 
+    // @Param: INTEG_TYPE
+    // @DisplayName: Physics integration method
+    // @Description: Method used to integrate the rigid body dynamics of the simulated vehicle. Trapezoidal integration uses the average of the rates at the start and end of each physics step, giving second order accuracy and allowing a lower SIM_RATE_HZ for the same accuracy
+    // @Values: 0:Euler,1:Trapezoidal
+    // @User: Advanced
+    AP_GROUPINFO("INTEG_TYPE",   24, SIM,  integration_type, 0),
+
     // @Path: ./SIM_FETtecOneWireESC.cpp
     AP_SUBGROUPINFO(fetteconewireesc_sim, "FTOWESC_", 30, SIM, FETtecOneWireESC),
 
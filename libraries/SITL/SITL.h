@@ -250,6 +250,13 @@ public:
     AP_Float buoyancy; // submarine buoyancy in Newtons
     AP_Int16 loop_rate_hz;
     AP_Int16 loop_time_jitter_us;
+
+    // rigid body integration method
+    enum class IntegrationType : uint8_t {
+        EULER = 0,
+        TRAPEZOIDAL = 1,
+    };
+    AP_Enum<IntegrationType> integration_type;
     AP_Int32 on_hardware_output_enable_mask;  // mask of output channels passed through to actual hardware
     AP_Int16 on_hardware_relay_enable_mask;   // mask of relays passed through to actual hardware
 
@@ -0,0 +1,207 @@
+#include <AP_gbenchmark.h>
+
+#include <AP_HAL/AP_HAL.h>
+#include <SITL/SIM_Frame.h>
+
+const AP_HAL::HAL& hal = AP_HAL::get_HAL();
+
+/*
+  frames from SIM_Frame.cpp to evaluate, in increasing motor count
+ */
+static const char *frame_names[] = {
+    "tri",
+    "quad",
+    "hexa",
+    "octa",
+    "deca",
+    "dodeca-hexa",
+};
+
+namespace SITL {
+
+class MotorBench {
+public:
+    /*
+      setup the motors of a frame with the default model parameters,
+      as done by Frame::init()
+     */
+    static Frame *setup_frame(const char *name)
+    {
+        Frame *frame = Frame::find_frame(name);
+        if (frame == nullptr) {
+            return nullptr;
+        }
+        const Frame::Model &model = frame->default_model;
+        for (uint8_t i=0; i<frame->num_motors; i++) {
+            frame->motors[i].setup_params(model.pwmMin, model.pwmMax, model.spin_min, model.spin_max, model.propExpo, model.slew_max,
+                                          model.diagonal_size, 1.5, model.maxVoltage, model.disc_area / frame->num_motors, 20,
+                                          model.motor_pos[i], model.motor_thrust_vec[i], model.yaw_factor[i],
+                                          model.disc_area / frame->num_motors, model.mdrag_coef);
+        }
+        return frame;
+    }
+
+    /*
+      the per-motor calculation as it was before the per-step values
+      were hoisted out of Motor::calculate_forces(), kept here as the
+      baseline for the benchmark
+     */
+    static void calculate_forces_baseline(Motor &m,
+                                          const struct sitl_input &input,
+                                          uint8_t motor_offset,
+                                          Vector3f &torque,
+                                          Vector3f &thrust,
+                                          const Vector3f &velocity_air_bf,
+                                          const Vector3f &gyro,
+                                          float air_density,
+                                          float voltage,
+                                          bool use_drag)
+    {
+        const float pwm = input.servos[motor_offset+m.servo];
+        const float pwm_thrust_max = m.mot_pwm_min + m.mot_spin_max * (m.mot_pwm_max - m.mot_pwm_min);
+        const float pwm_thrust_min = m.mot_pwm_min + m.mot_spin_min * (m.mot_pwm_max - m.mot_pwm_min);
+        const float pwm_thrust_range = pwm_thrust_max - pwm_thrust_min;
+        float command = constrain_float((pwm-pwm_thrust_min)/pwm_thrust_range, 0, 1);
+        float voltage_scale = voltage / m.voltage_max;
+
+        if (voltage_scale < 0.1) {
+            torque.zero();
+            thrust.zero();
+            m.current = 0;
+            return;
+        }
+
+        uint64_t now_us = AP_HAL::micros64();
+        if (m.last_calc_us != 0 && m.slew_max > 0) {
+            float dt = (now_us - m.last_calc_us)*1.0e-6;
+            float slew_max_change = m.slew_max * dt;
+            command = constrain_float(command, m.last_command-slew_max_change, m.last_command+slew_max_change);
+        }
+        m.last_calc_us = now_us;
+        m.last_command = command;
+
+        Vector3f motor_vel = velocity_air_bf;
+        motor_vel += -(m.position % gyro);
+
+        float velocity_in = MAX(0, -motor_vel.projected(m.thrust_vector).z);
+        float motor_thrust = m.calc_thrust(command, air_density, velocity_in, voltage_scale);
+
+        const float yaw_scale = 0.05 * m.diagonal_size * motor_thrust;
+        Vector3f rotor_torque = m.thrust_vector * m.yaw_factor * command * yaw_scale * -1.0;
+
+        thrust = m.thrust_vector * motor_thrust;
+
+        float roll = 0, pitch = 0;
+        uint64_t now = AP_HAL::micros64();
+        if (m.roll_servo >= 0) {
+            uint16_t servoval = m.update_servo(input.servos[m.roll_servo+motor_offset], now, m.last_roll_value);
+            if (m.roll_min < m.roll_max) {
+                roll = constrain_float(m.roll_min + (servoval-1000)*0.001*(m.roll_max-m.roll_min), m.roll_min, m.roll_max);
+            } else {
+                roll = constrain_float(m.roll_max + (2000-servoval)*0.001*(m.roll_min-m.roll_max), m.roll_max, m.roll_min);
+            }
+        }
+        if (m.pitch_servo >= 0) {
+            uint16_t servoval = m.update_servo(input.servos[m.pitch_servo+motor_offset], now, m.last_pitch_value);
+            if (m.pitch_min < m.pitch_max) {
+                pitch = constrain_float(m.pitch_min + (servoval-1000)*0.001*(m.pitch_max-m.pitch_min), m.pitch_min, m.pitch_max);
+            } else {
+                pitch = constrain_float(m.pitch_max + (2000-servoval)*0.001*(m.pitch_min-m.pitch_max), m.pitch_max, m.pitch_min);
+            }
+        }
+        m.last_change_usec = now;
+
+        if (!is_zero(roll) || !is_zero(pitch)) {
+            Matrix3f rotation;
+            rotation.from_euler(radians(roll), radians(pitch), 0);
+            thrust = rotation * thrust;
+            rotor_torque = rotation * rotor_torque;
+        }
+
+        if (use_drag) {
+            const float momentum_drag_factor = m.momentum_drag_coefficient * sqrtf(air_density * m.true_prop_area);
+            Vector3f momentum_drag;
+            momentum_drag.x = momentum_drag_factor * motor_vel.x * (sqrtf(fabsf(thrust.y)) + sqrtf(fabsf(thrust.z)));
+            momentum_drag.y = momentum_drag_factor * motor_vel.y * (sqrtf(fabsf(thrust.x)) + sqrtf(fabsf(thrust.z)));
+            momentum_drag.z = momentum_drag_factor * motor_vel.z * (sqrtf(fabsf(thrust.x)) + sqrtf(fabsf(thrust.y)) + sqrtf(fabsf(thrust.z)));
+            thrust -= momentum_drag;
+        }
+
+        torque = (m.position % thrust) + rotor_torque;
+
+        float power = m.power_factor * fabsf(motor_thrust);
+        m.current = power / MAX(voltage, 0.1);
+    }
+};
+
+}
+
+using namespace SITL;
+
+static const Vector3f velocity_air_bf(5.0, 1.0, -0.5);
+static const Vector3f gyro(0.1, -0.2, 0.05);
+static const float air_density = 1.225;
+static const float voltage = 16.8;
+
+static void setup_input(struct sitl_input &input)
+{
+    for (uint8_t i=0; i<ARRAY_SIZE(input.servos); i++) {
+        input.servos[i] = 1500;
+    }
+}
+
+static void BM_FrameMotorForcesBaseline(benchmark::State& state)
+{
+    Frame *frame = MotorBench::setup_frame(frame_names[state.range(0)]);
+    if (frame == nullptr) {
+        return;
+    }
+
+    struct sitl_input input {};
+    setup_input(input);
+
+    while (state.KeepRunning()) {
+        Vector3f torque, thrust;
+        for (uint8_t i=0; i<frame->num_motors; i++) {
+            Vector3f mtorque, mthrust;
+            MotorBench::calculate_forces_baseline(frame->motors[i], input, 0, mtorque, mthrust, velocity_air_bf, gyro,
+                                                  air_density, voltage, true);
+            torque += mtorque;
+            thrust += mthrust;
+        }
+        gbenchmark_escape(&torque);
+        gbenchmark_escape(&thrust);
+    }
+}
+
+static void BM_FrameMotorForces(benchmark::State& state)
+{
+    Frame *frame = MotorBench::setup_frame(frame_names[state.range(0)]);
+    if (frame == nullptr) {
+        return;
+    }
+
+    struct sitl_input input {};
+    setup_input(input);
+
+    while (state.KeepRunning()) {
+        // per-step values are sampled once for all motors, as in Frame::calculate_forces()
+        const float sqrt_air_density = sqrtf(air_density);
+        const uint64_t now_us = AP_HAL::micros64();
+        Vector3f torque, thrust;
+        for (uint8_t i=0; i<frame->num_motors; i++) {
+            Vector3f mtorque, mthrust;
+            frame->motors[i].calculate_forces(input, 0, mtorque, mthrust, velocity_air_bf, gyro,
+                                              air_density, sqrt_air_density, voltage, true, now_us);
+            torque += mtorque;
+            thrust += mthrust;
+        }
+        gbenchmark_escape(&torque);
+        gbenchmark_escape(&thrust);
+    }
+}
+
+BENCHMARK(BM_FrameMotorForcesBaseline)->DenseRange(0, ARRAY_SIZE(frame_names)-1);
+BENCHMARK(BM_FrameMotorForces)->DenseRange(0, ARRAY_SIZE(frame_names)-1);
+
+BENCHMARK_MAIN();